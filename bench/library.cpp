@@ -0,0 +1,56 @@
+// includes only libezsimd.hpp like a program using the static or shared library, so anything the header
+// or libezsimd.tpp uses without including fails to compile here (flags as in README.txt):
+//     g++ -O2 -mmmx -msse -msse2 -mavx -mavx2 -I.. -c library.cpp -o library.o
+// and to run it, link it with the library built from ezsimd.cpp:
+//     g++ -O2 -mmmx -msse -msse2 -mavx -mavx2 -I.. -c ../ezsimd.cpp -o ezsimd.o
+//     g++ library.o ezsimd.o -pthread -o library
+//     ./library
+// exits with 1 if any result is wrong
+
+#include "libezsimd.hpp"
+
+#include <cstdio>
+
+int main() {
+    std::vector<float> a = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<float> b = {9, 8, 7, 6, 5, 4, 3, 2, 1};
+    std::vector<float> c(a.size());
+    std::array<int32_t, 10> x = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::array<int32_t, 10> y;
+    bool failed = false;
+
+    ezsimd::add(a, b, c);
+    for (const float e : c) {
+        failed = failed || e != 10;
+    }
+
+    ezsimd::mul<10>(x, 2, y);
+    for (size_t i = 0; i < y.size(); i++) {
+        failed = failed || y[i] != x[i] * 2;
+    }
+
+    ezsimd::eval(ezsimd::expr(a) * b + 1.0f, c);
+    for (size_t i = 0; i < c.size(); i++) {
+        failed = failed || c[i] != a[i] * b[i] + 1;
+    }
+
+    failed = failed || ezsimd::sum(a) != 45;
+
+    // every entry point takes aligned_vector as well as std::vector
+    ezsimd::aligned_vector<float> d(a.begin(), a.end());
+    ezsimd::aligned_vector<float> e(b.begin(), b.end());
+    ezsimd::aligned_vector<double> f(d.size());
+    ezsimd::addInplace(d, e);
+    ezsimd::mulInplace(ezsimd::parallel, d, 2.0f);
+    failed = failed || ezsimd::sum(d) != 180 || ezsimd::min(d) != 20 || ezsimd::max(ezsimd::parallel, d) != 20;
+    failed = failed || ezsimd::dot(d, e) != 900;
+    ezsimd::widen(d, f);
+    ezsimd::narrow(f, e);
+    ezsimd::eval(ezsimd::expr(d) - e + 1.0f, d);
+    for (size_t i = 0; i < d.size(); i++) {
+        failed = failed || f[i] != 20 || d[i] != 1;
+    }
+
+    std::printf(failed ? "wrong\n" : "ok\n");
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+// measures ezsimd::add, sub, mul, and div on every type with the backend of every instruction set
+// this CPU supports, for arrays from 16 elements up to 1 GiB each (flags as in README.txt):
+//     g++ -O2 -mmmx -msse -msse2 -mavx -mavx2 -mfma -I.. ops.cpp -o ops
+//     ./ops > ops.csv
+//     ./ops --json --max-bytes 67108864 > ops.json
+// prints one row per op, type, instruction set, and size. GB/s counts the bytes of a, b, and c,
+// and elements per cycle uses the time stamp counter, which ticks at the base clock rather than the current one
+
+#include "ezsimd.hpp"
+
+#include <x86intrin.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+    struct Result {
+        const char* op;
+        const char* type;
+        ezsimd::Tier tier;
+        size_t l;
+        size_t bytes;
+        double seconds;
+        double cycles;
+    };
+
+    size_t maxBytes = size_t(1) << 30;
+    bool json = false;
+    bool first = true;
+
+    void print(const Result& r) {
+        const double gbs = 3.0 * r.bytes / r.seconds / 1e9;
+        const double perCycle = r.l / r.cycles;
+
+        if (json) {
+            std::printf("%s\n    {\"op\": \"%s\", \"type\": \"%s\", \"isa\": \"%s\", \"elements\": %zu, \"bytes\": %zu, \"ns\": %.3f, \"gbs\": %.3f, \"elements_per_cycle\": %.4f}",
+                first ? "[" : ",", r.op, r.type, ezsimd::tierName(r.tier), r.l, r.bytes, r.seconds * 1e9, gbs, perCycle);
+        } else {
+            if (first) {
+                std::printf("op,type,isa,elements,bytes,ns,gbs,elements_per_cycle\n");
+            }
+            std::printf("%s,%s,%s,%zu,%zu,%.3f,%.3f,%.4f\n", r.op, r.type, ezsimd::tierName(r.tier), r.l, r.bytes, r.seconds * 1e9, gbs, perCycle);
+        }
+
+        first = false;
+        std::fflush(stdout);
+    }
+
+    // best of 3 runs, each repeating the call until it takes at least 10 ms
+    template <typename F>
+    void time(F&& f, double& seconds, double& cycles) {
+        size_t reps = 1;
+        seconds = 1e30;
+        cycles = 1e30;
+
+        for (int run = 0; run < 3; run++) {
+            for (;;) {
+                const auto start = std::chrono::steady_clock::now();
+                const unsigned long long startCycles = __rdtsc();
+                for (size_t r = 0; r < reps; r++) {
+                    f();
+                }
+                const unsigned long long endCycles = __rdtsc();
+                const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+                if (elapsed.count() < 0.01 && run == 0) {
+                    reps *= 2;
+                    continue;
+                }
+
+                seconds = std::min(seconds, elapsed.count() / reps);
+                cycles = std::min(cycles, double(endCycles - startCycles) / reps);
+                break;
+            }
+        }
+    }
+
+    template <typename Op, typename T>
+    void benchOp(const char* op, const char* type) {
+        for (size_t l = 16; l * sizeof(T) <= maxBytes; l *= 4) {
+            std::vector<T> a(l, T(3));
+            std::vector<T> b(l, T(2)); // never 0 so div is defined
+            std::vector<T> c(l);
+
+            for (int i = int(ezsimd::Tier::Default); i <= int(ezsimd::Tier::AVX512FP16); i++) {
+                const ezsimd::Tier tier = ezsimd::Tier(i);
+                const auto kernel = ezsimd::Kernel<Op, T>::get(tier);
+
+                if (kernel == nullptr || !ezsimd::cpuSupports(tier)) {
+                    continue;
+                }
+
+                Result r{op, type, tier, l, l * sizeof(T), 0, 0};
+                time([&]() {kernel(a.data(), b.data(), c.data(), l);}, r.seconds, r.cycles);
+                print(r);
+            }
+        }
+    }
+
+    template <typename T>
+    void benchType(const char* type) {
+        benchOp<ezsimd::op::Add, T>("add", type);
+        benchOp<ezsimd::op::Sub, T>("sub", type);
+        benchOp<ezsimd::op::Mul, T>("mul", type);
+        benchOp<ezsimd::op::Div, T>("div", type);
+    }
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (std::strcmp(argv[i], "--max-bytes") == 0 && i + 1 < argc) {
+            maxBytes = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::fprintf(stderr, "usage: %s [--json] [--max-bytes n]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    benchType<int8_t>("int8_t");
+    benchType<int16_t>("int16_t");
+    benchType<int32_t>("int32_t");
+    benchType<int64_t>("int64_t");
+    benchType<__int128_t>("__int128_t");
+    benchType<uint8_t>("uint8_t");
+    benchType<uint16_t>("uint16_t");
+    benchType<uint32_t>("uint32_t");
+    benchType<uint64_t>("uint64_t");
+    benchType<__uint128_t>("__uint128_t");
+    #ifdef EZSIMD_FLOAT16
+        benchType<_Float16>("_Float16");
+    #endif
+    benchType<ezsimd::bfloat16>("bfloat16");
+    benchType<float>("float");
+    benchType<double>("double");
+    benchType<long double>("long double");
+
+    if (json) {
+        std::printf("%s\n", first ? "[]" : "\n]");
+    }
+}
@@ -0,0 +1,40 @@
+// measures ezsimd::add on float arrays of growing size, compile once without and once with
+// EZSIMD_PREFETCH_DISTANCE to compare (flags as in README.txt):
+//     g++ -O2 -mmmx -msse -msse2 -mavx -mavx2 -I.. prefetch.cpp -o prefetch
+//     g++ -O2 -mmmx -msse -msse2 -mavx -mavx2 -I.. -DEZSIMD_PREFETCH_DISTANCE=2048 prefetch.cpp -o prefetch2048
+
+#include "ezsimd.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+int main() {
+    #ifdef EZSIMD_PREFETCH_DISTANCE
+        std::printf("prefetch distance: %d bytes\n", EZSIMD_PREFETCH_DISTANCE);
+    #else
+        std::printf("prefetch distance: off\n");
+    #endif
+
+    // keep every size below the stream threshold so only prefetching changes between builds
+    ezsimd::setStreamThreshold(SIZE_MAX);
+
+    for (size_t bytes = size_t(1) << 14; bytes <= size_t(1) << 28; bytes <<= 2) {
+        const size_t l = bytes / sizeof(float);
+        std::vector<float> a(l, 1.0f);
+        std::vector<float> b(l, 2.0f);
+        std::vector<float> c(l);
+        const size_t reps = std::max<size_t>((size_t(1) << 30) / bytes, 3);
+        double best = 1e30;
+
+        for (int run = 0; run < 5; run++) {
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t r = 0; r < reps; r++) {
+                ezsimd::add(a, b, c);
+            }
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            best = std::min(best, elapsed.count() / reps);
+        }
+
+        std::printf("%10zu KiB per array: %7.2f GB/s\n", bytes >> 10, 3.0 * bytes / best / 1e9);
+    }
+}
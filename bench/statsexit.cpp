@@ -0,0 +1,32 @@
+// exits right after an ezsimd::parallel call with stats on, so the pool workers' counts are added to the
+// stats registry while static destructors run. it must not touch freed memory on the way out:
+//     g++ -O1 -g -fsanitize=address -mmmx -msse -msse2 -mavx -mavx2 -DEZSIMD_STATS -I.. statsexit.cpp -pthread -o statsexit
+//     ./statsexit
+// exits with 1 if the result or the counts are wrong, and AddressSanitizer aborts it if the exit is unsafe
+
+#include "ezsimd.hpp"
+
+#include <cstdio>
+
+int main() {
+    std::vector<float> a(size_t(1) << 22, 1.0f);
+    std::vector<float> b(a.size(), 2.0f);
+    std::vector<float> c(a.size());
+    bool failed = false;
+
+    ezsimd::setThreadCount(4);
+    ezsimd::add(ezsimd::parallel, a, b, c);
+
+    for (const float e : c) {
+        failed = failed || e != 3;
+    }
+
+    uint64_t elements = 0;
+    for (const ezsimd::Stat& stat : ezsimd::stats()) {
+        elements += stat.elements;
+    }
+
+    failed = failed || elements != a.size();
+    std::printf(failed ? "wrong\n" : "ok\n");
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,958 @@
+// runs every instruction set's backends on random inputs, sizes, and misalignments, compares the results with
+// plain loops written here, and times each backend (flags as in README.txt, the more instruction sets enabled
+// the more backends are checked):
+//     g++ -O2 -mmmx -msse -msse2 -mavx -mavx2 -mfma -mf16c -I.. tiers.cpp -pthread -o tiers
+//     ./tiers > tiers.csv
+// for each instruction set it checks the elementwise ops, sum, min, max, dot, widen, narrow, and the widening ops
+// through Kernel<Op, T>::get(tier), then with setMaxIsa(tier) the public functions on top of them: in place and
+// partially overlapping outputs, the aligned_vector kernels, ezsimd::parallel calls several chunks long,
+// the std::array kernels of its ezsimd::isa tag, and expressions.
+// prints one row per check, type, and instruction set, and exits with 1 if any element is wrong or anything
+// after an output was written. integers must match exactly, floats within 1 ulp since AVX512-FP16 rounds
+// _Float16 fma once instead of twice. sum and dot get small integers, so every order of adding them is exact.
+// ns_per_element is the best time on 4096 aligned elements, speedup is relative to Default, and both are only
+// measured for the backends themselves
+
+#include "ezsimd.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+
+namespace {
+    constexpr size_t cases = 200;
+    constexpr size_t apiCases = 50; // of each check through the public functions
+    constexpr size_t parallelCases = 6; // each one to three chunks long
+    constexpr size_t fixedCases = 10; // of each std::array size
+    constexpr size_t maxLength = 5000;
+    constexpr size_t maxOffset = 8; // elements each array is moved off its allocation, so every misalignment is hit
+    constexpr size_t guard = 8; // elements after the output that must stay untouched
+    constexpr size_t timedLength = 4096;
+    constexpr size_t halfSumLength = 200; // nonzero elements of a _Float16 or bfloat16 sum or dot at most
+
+    std::mt19937_64 rng(12345);
+    bool failed = false;
+
+    template <typename T>
+    constexpr bool isInteger = std::numeric_limits<T>::is_integer;
+
+    // the type the reference does float math in, half-precision goes through float like the library
+    template <typename T>
+    struct Math {
+        using type = T;
+    };
+
+    #ifdef EZSIMD_FLOAT16
+        template <>
+        struct Math<_Float16> {
+            using type = float;
+        };
+    #endif
+
+    template <>
+    struct Math<ezsimd::bfloat16> {
+        using type = float;
+    };
+
+    template <typename T>
+    T randomValue() {
+        if constexpr (isInteger<T>) {
+            // random bits, with small numbers mixed in so division sees more than quotients of 0 and 1
+            uint64_t bits[2] = {rng(), rng()};
+            T value;
+            std::memcpy(&value, bits, sizeof(T));
+            return rng() % 4 == 0 ? T(value % 100) : value;
+        } else {
+            const float value = std::uniform_real_distribution<float>(0.5f, 100.0f)(rng);
+            return T(rng() % 2 ? value : -value);
+        }
+    }
+
+    // values for a sum or dot of l elements that any order of adding up gives exactly: integers from -8 to 8, and
+    // for _Float16 and bfloat16, which only hold integers exactly up to 2048 and 256, at most 200 of -1 and 1
+    template <typename T>
+    auto exactValues(const size_t l) {
+        return [l, count = size_t(0)]() mutable {
+            if constexpr (isInteger<T>) {
+                return randomValue<T>();
+            } else if constexpr (sizeof(T) == 2) {
+                if (count < halfSumLength && rng() % l < halfSumLength) {
+                    count++;
+                    return T(rng() % 2 ? 1.0f : -1.0f);
+                }
+                return T(0.0f);
+            } else {
+                return T(float(rng() % 17) - 8.0f);
+            }
+        };
+    }
+
+    // inputs of a narrowing op that don't fit the narrower type exactly, so its rounding is checked too
+    template <typename T>
+    T conversionValue() {
+        if constexpr (isInteger<T>) {
+            return randomValue<T>();
+        } else {
+            return T(randomValue<float>()) / T(3.0f);
+        }
+    }
+
+    template <typename T>
+    bool sameBits(const T x, const T y) {
+        // x87 long double is 10 bytes padded to 16, and the padding isn't kept by copies
+        constexpr size_t bytes = std::is_same<T, long double>::value && std::numeric_limits<long double>::digits == 64 ? 10 : sizeof(T);
+        return std::memcmp(&x, &y, bytes) == 0;
+    }
+
+    // distance between x and y in representable values, only for the 16, 32, and 64-bit floats
+    template <typename T>
+    uint64_t ulps(const T x, const T y) {
+        if constexpr (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) {
+            using Bits = typename std::conditional<sizeof(T) == 2, int16_t, typename std::conditional<sizeof(T) == 4, int32_t, int64_t>::type>::type;
+            Bits bx;
+            Bits by;
+            std::memcpy(&bx, &x, sizeof(T));
+            std::memcpy(&by, &y, sizeof(T));
+            // sign and magnitude to two's complement, so neighbouring floats are neighbouring integers
+            const int64_t ix = bx < 0 ? std::numeric_limits<Bits>::min() - int64_t(bx) : int64_t(bx);
+            const int64_t iy = by < 0 ? std::numeric_limits<Bits>::min() - int64_t(by) : int64_t(by);
+            return ix > iy ? uint64_t(ix - iy) : uint64_t(iy - ix);
+        } else {
+            return x == y ? 0 : UINT64_MAX;
+        }
+    }
+
+    // wraps around like the SIMD instructions, without the undefined behavior of signed overflow
+    template <typename T>
+    T wrapAdd(const T a, const T b) {
+        T r;
+        __builtin_add_overflow(a, b, &r);
+        return r;
+    }
+
+    template <typename T>
+    T wrapSub(const T a, const T b) {
+        T r;
+        __builtin_sub_overflow(a, b, &r);
+        return r;
+    }
+
+    template <typename T>
+    T wrapMul(const T a, const T b) {
+        T r;
+        __builtin_mul_overflow(a, b, &r);
+        return r;
+    }
+
+    template <typename T>
+    T refAdd(const T a, const T b) {
+        using M = typename Math<T>::type;
+        if constexpr (isInteger<T>) {
+            return wrapAdd(a, b);
+        } else {
+            return T(M(a) + M(b));
+        }
+    }
+
+    template <typename T>
+    T refSub(const T a, const T b) {
+        using M = typename Math<T>::type;
+        if constexpr (isInteger<T>) {
+            return wrapSub(a, b);
+        } else {
+            return T(M(a) - M(b));
+        }
+    }
+
+    template <typename T>
+    T refAdds(const T a, const T b) {
+        T r;
+        return __builtin_add_overflow(a, b, &r) ? (b > T(0) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min()) : r;
+    }
+
+    template <typename T>
+    T refSubs(const T a, const T b) {
+        T r;
+        return __builtin_sub_overflow(a, b, &r) ? (b < T(0) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min()) : r;
+    }
+
+    template <typename T>
+    T refMul(const T a, const T b) {
+        using M = typename Math<T>::type;
+        if constexpr (isInteger<T>) {
+            return wrapMul(a, b);
+        } else {
+            return T(M(a) * M(b));
+        }
+    }
+
+    template <typename T>
+    T refDiv(const T a, const T b) {
+        using M = typename Math<T>::type;
+        return T(M(a) / M(b));
+    }
+
+    template <typename T>
+    T refFma(const T a, const T b, const T c) {
+        using M = typename Math<T>::type;
+        if constexpr (isInteger<T>) {
+            return wrapAdd(wrapMul(a, b), c);
+        } else {
+            return T(std::fma(M(a), M(b), M(c)));
+        }
+    }
+
+    // one element of a widening or narrowing op, the inputs are converted to Out before the op
+    template <typename Op, typename Out, typename In>
+    Out refConvert(const In a, const In b = In()) {
+        if constexpr (std::is_same<Op, ezsimd::op::AddWiden>::value) {
+            return refAdd(Out(a), Out(b));
+        } else if constexpr (std::is_same<Op, ezsimd::op::SubWiden>::value) {
+            return refSub(Out(a), Out(b));
+        } else if constexpr (std::is_same<Op, ezsimd::op::MulWiden>::value) {
+            return refMul(Out(a), Out(b));
+        } else {
+            return Out(a);
+        }
+    }
+
+    // makes a / b defined: b is never 0, and the smallest signed value is never divided by -1
+    template <typename T>
+    void divisible(T& a, T& b) {
+        if (b == T(0)) {
+            b = T(1);
+        }
+        if constexpr (isInteger<T>) {
+            if (a == std::numeric_limits<T>::min() && b == T(-1)) {
+                b = T(1);
+            }
+        }
+    }
+
+    // makes every element of a Div or DivScalar case defined, the inputs of other ops are left alone
+    template <typename Op, typename T>
+    void prepare(T* const* p, T& b, const size_t l) {
+        if constexpr (std::is_same<Op, ezsimd::op::Div>::value) {
+            for (size_t e = 0; e < l; e++) {
+                divisible(p[0][e], p[1][e]);
+            }
+        } else if constexpr (std::is_same<Op, ezsimd::op::DivScalar>::value) {
+            if (b == T(0)) {
+                b = T(1);
+            }
+            for (size_t e = 0; e < l; e++) {
+                T a = p[0][e];
+                divisible(a, b);
+            }
+        }
+    }
+
+    // the inputs of one case, l elements of each array at a random offset of its own buffer, and the single value b
+    template <typename Op, typename T, size_t inputs, typename Buffer = std::vector<T>>
+    struct Inputs {
+        Buffer buffers[inputs];
+        T* p[inputs];
+        T b = randomValue<T>();
+
+        Inputs(const Inputs&) = delete;
+        Inputs& operator=(const Inputs&) = delete;
+
+        // offsets 1 puts every array at the start of its buffer, which is then exactly l long
+        template <typename G = T (*)()>
+        explicit Inputs(const size_t l, G value = randomValue<T>, const size_t offsets = maxOffset) {
+            for (size_t k = 0; k < inputs; k++) {
+                buffers[k].resize(l + offsets - 1);
+                p[k] = buffers[k].data() + rng() % offsets;
+                for (size_t e = 0; e < l; e++) {
+                    p[k][e] = value();
+                }
+            }
+
+            prepare<Op>(p, b, l);
+        }
+    };
+
+    // calls f with the inputs in, or in[0] and the single value b for the Scalar ops, then rest
+    template <size_t inputs, bool scalarB, typename F, typename In, typename B, typename... Rest>
+    decltype(auto) apply(F&& f, In* in, const B& b, Rest&&... rest) {
+        if constexpr (scalarB) {
+            return f(in[0], b, rest...);
+        } else if constexpr (inputs == 1) {
+            return f(in[0], rest...);
+        } else if constexpr (inputs == 2) {
+            return f(in[0], in[1], rest...);
+        } else {
+            return f(in[0], in[1], in[2], rest...);
+        }
+    }
+
+    // element e of an elementwise op, from arrays or vectors p
+    template <size_t inputs, bool scalarB, typename Ref, typename P, typename T>
+    T reference(Ref ref, const P& p, const T b, const size_t e) {
+        if constexpr (scalarB) {
+            return ref(p[0][e], b);
+        } else if constexpr (inputs == 2) {
+            return ref(p[0][e], p[1][e]);
+        } else {
+            return ref(p[0][e], p[1][e], p[2][e]);
+        }
+    }
+
+    // l random lengths, mostly short ones so the peels and remainders of every width are hit often
+    size_t randomLength(const size_t n) {
+        return n % 4 == 0 ? rng() % maxLength : rng() % 100;
+    }
+
+    // past a few chunks of T, so an ezsimd::parallel call is split across the pool
+    template <typename T>
+    size_t parallelLength() {
+        const size_t chunk = ezsimd::parallelChunkBytes / sizeof(T);
+        return chunk + 1 + rng() % (2 * chunk);
+    }
+
+    // the wrong elements and the largest float error of one check on one instruction set, printed as a row of the csv
+    struct Row {
+        std::string op;
+        const char* type;
+        ezsimd::Tier tier;
+        size_t mismatches = 0;
+        uint64_t maxUlps = 0;
+
+        template <typename T>
+        void compare(const T got, const T want, const size_t e, const size_t l) {
+            const uint64_t u = ulps(got, want);
+            const bool wrong = isInteger<T> ? !sameBits(got, want) : u > 1;
+
+            if (wrong && mismatches++ == 0) {
+                std::fprintf(stderr, "%s %s %s: element %zu of %zu is wrong\n", op.c_str(), type, ezsimd::tierName(tier), e, l);
+            }
+            if (!isInteger<T>) {
+                maxUlps = std::max(maxUlps, u);
+            }
+        }
+
+        // elements [begin, end) of got, around an output, must still be the ones in sentinel
+        template <typename T>
+        void untouched(const T* got, const T* sentinel, const size_t begin, const size_t end) {
+            for (size_t e = begin; e < end; e++) {
+                if (!sameBits(got[e], sentinel[e]) && mismatches++ == 0) {
+                    std::fprintf(stderr, "%s %s %s: element %zu outside the output was written\n", op.c_str(), type, ezsimd::tierName(tier), e);
+                }
+            }
+        }
+
+        // seconds is the time of timedLength elements, 0 for checks that aren't timed
+        void print(const size_t n, const double seconds = 0, const double defaultSeconds = 0) {
+            failed = failed || mismatches != 0;
+            std::printf("%s,%s,%s,%zu,%zu,%llu,", op.c_str(), type, ezsimd::tierName(tier), n, mismatches, (unsigned long long) maxUlps);
+            if (seconds != 0) {
+                std::printf("%.4f,%.2f\n", seconds / timedLength * 1e9, defaultSeconds / seconds);
+            } else {
+                std::printf(",\n");
+            }
+            std::fflush(stdout);
+        }
+    };
+
+    // best time per call of f over 3 runs, each repeating it until it takes at least 10 ms
+    template <typename F>
+    double time(F&& f) {
+        size_t reps = 1;
+        double best = 1e30;
+
+        for (int run = 0; run < 3; run++) {
+            for (;;) {
+                const auto start = std::chrono::steady_clock::now();
+                for (size_t r = 0; r < reps; r++) {
+                    f();
+                }
+                const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+                if (elapsed.count() < 0.01 && run == 0) {
+                    reps *= 2;
+                    continue;
+                }
+
+                best = std::min(best, elapsed.count() / reps);
+                break;
+            }
+        }
+
+        return best;
+    }
+
+    // runs f(tier) for every instruction set this CPU has, with maxIsa() set to it so the public functions
+    // use its backends, or those of the ones before it for ops it has none for
+    template <typename F>
+    void forEachTier(F f) {
+        const ezsimd::Tier max = ezsimd::maxIsa();
+
+        for (int i = int(ezsimd::Tier::Default); i <= int(ezsimd::Tier::AVX512FP16); i++) {
+            const ezsimd::Tier tier = ezsimd::Tier(i);
+            if (ezsimd::cpuSupports(tier)) {
+                ezsimd::setMaxIsa(tier);
+                f(tier);
+            }
+        }
+
+        ezsimd::setMaxIsa(max);
+    }
+
+    // calls f with the ezsimd::isa tag of tier, isa::Dispatch for Default, and not at all for MMX which has none
+    template <typename F>
+    void withIsa(const ezsimd::Tier tier, F f) {
+        switch (tier) {
+            case ezsimd::Tier::Default: f(ezsimd::isa::Dispatch{}); break;
+            case ezsimd::Tier::SSE: f(ezsimd::isa::SSE{}); break;
+            case ezsimd::Tier::SSE2: f(ezsimd::isa::SSE2{}); break;
+            case ezsimd::Tier::AVX: f(ezsimd::isa::AVX{}); break;
+            case ezsimd::Tier::AVX2: f(ezsimd::isa::AVX2{}); break;
+            case ezsimd::Tier::FMA: f(ezsimd::isa::FMA{}); break;
+            case ezsimd::Tier::F16C: f(ezsimd::isa::F16C{}); break;
+            case ezsimd::Tier::AVX512: f(ezsimd::isa::AVX512{}); break;
+            case ezsimd::Tier::AVX512BF16: f(ezsimd::isa::AVX512BF16{}); break;
+            case ezsimd::Tier::AVX512FP16: f(ezsimd::isa::AVX512FP16{}); break;
+            default: break;
+        }
+    }
+
+    // the backend of tier on its own, returns its time for timedLength elements
+    template <typename Op, typename T, size_t inputs, bool scalarB, typename Ref>
+    double checkBackend(Row& row, const typename ezsimd::Kernel<Op, T>::type kernel, Ref ref) {
+        std::vector<T> got(maxLength + maxOffset + guard);
+        std::vector<T> sentinel(got.size());
+
+        for (T& x : sentinel) {
+            x = randomValue<T>();
+        }
+
+        for (size_t n = 0; n < cases; n++) {
+            const size_t l = randomLength(n);
+            const Inputs<Op, T, inputs> in(l);
+            const size_t offset = rng() % maxOffset;
+            T* const c = got.data() + offset;
+            got = sentinel;
+            // the streaming path needs an aligned output and a big enough one, half the cases force it
+            ezsimd::setStreamThreshold(n % 2 ? 0 : SIZE_MAX);
+            apply<inputs, scalarB>(kernel, in.p, in.b, c, l);
+
+            for (size_t e = 0; e < l; e++) {
+                row.compare(c[e], reference<inputs, scalarB>(ref, in.p, in.b, e), e, l);
+            }
+
+            row.untouched(got.data(), sentinel.data(), 0, offset);
+            row.untouched(got.data(), sentinel.data(), offset + l, offset + l + guard);
+        }
+
+        ezsimd::setStreamThreshold(SIZE_MAX);
+        const Inputs<Op, T, inputs> timed(timedLength, randomValue<T>, 1);
+        return time([&]() {apply<inputs, scalarB>(kernel, timed.p, timed.b, got.data(), timedLength);});
+    }
+
+    // the public function with its output in place of one input (through the Inplace function for the first one
+    // when the op has it) or partially overlapping it, which must give what separate arrays give
+    template <typename Op, typename T, size_t inputs, bool scalarB, typename Ref, typename Api, typename Inplace>
+    void checkOverlap(Row& row, Ref ref, Api api, Inplace inplace) {
+        for (size_t n = 0; n < apiCases; n++) {
+            const size_t l = randomLength(n);
+            Inputs<Op, T, inputs> in(l);
+            const size_t k = rng() % inputs;
+            const size_t shift = rng() % (2 * maxOffset + 1); // of the output from input k, maxOffset is in place
+            std::vector<T> want(l);
+
+            for (size_t e = 0; e < l; e++) {
+                want[e] = reference<inputs, scalarB>(ref, in.p, in.b, e);
+            }
+
+            std::vector<T> shared(l + 2 * maxOffset + guard);
+            for (T& x : shared) {
+                x = randomValue<T>();
+            }
+
+            std::copy(in.p[k], in.p[k] + l, shared.data() + maxOffset);
+            in.p[k] = shared.data() + maxOffset;
+            T* const c = shared.data() + shift;
+            std::vector<T> sentinel = shared;
+            std::copy(want.begin(), want.end(), sentinel.begin() + shift);
+
+            if constexpr (!std::is_null_pointer<Inplace>::value) {
+                if (k == 0 && shift == maxOffset) {
+                    if constexpr (scalarB) {
+                        inplace(in.p[0], in.b, l);
+                    } else {
+                        inplace(in.p[0], in.p[1], l);
+                    }
+                } else {
+                    apply<inputs, scalarB>(api, in.p, in.b, c, l);
+                }
+            } else {
+                apply<inputs, scalarB>(api, in.p, in.b, c, l);
+            }
+
+            for (size_t e = 0; e < l; e++) {
+                row.compare(c[e], want[e], e, l);
+            }
+
+            row.untouched(shared.data(), sentinel.data(), 0, shift);
+            row.untouched(shared.data(), sentinel.data(), shift + l, shared.size());
+        }
+
+        row.print(apiCases);
+    }
+
+    // Kernel<Op, T>::getAligned() on arrays from aligned_allocator, which may write the padding after the last
+    // element but nothing after that
+    template <typename Op, typename T, size_t inputs, bool scalarB, typename Ref>
+    void checkAligned(Row& row, Ref ref) {
+        const typename ezsimd::Kernel<Op, T>::type kernel = ezsimd::Kernel<Op, T>::getAligned();
+        constexpr size_t vector = ezsimd::simdAlignment / sizeof(T);
+
+        for (size_t n = 0; n < apiCases; n++) {
+            const size_t l = randomLength(n);
+            const Inputs<Op, T, inputs, ezsimd::aligned_vector<T>> in(l, randomValue<T>, 1);
+            const size_t padded = (l + vector - 1) / vector * vector;
+            ezsimd::aligned_vector<T> got(padded + guard);
+
+            for (T& x : got) {
+                x = randomValue<T>();
+            }
+
+            const ezsimd::aligned_vector<T> sentinel = got;
+            ezsimd::setStreamThreshold(n % 2 ? 0 : SIZE_MAX);
+            apply<inputs, scalarB>(kernel, in.p, in.b, got.data(), l);
+
+            for (size_t e = 0; e < l; e++) {
+                row.compare(got[e], reference<inputs, scalarB>(ref, in.p, in.b, e), e, l);
+            }
+
+            row.untouched(got.data(), sentinel.data(), padded, got.size());
+        }
+
+        ezsimd::setStreamThreshold(SIZE_MAX);
+        row.print(apiCases);
+    }
+
+    // ezsimd::parallel calls split into chunks, alternately on misaligned arrays and on aligned_vector
+    template <typename Op, typename T, size_t inputs, bool scalarB, typename Ref, typename Api>
+    void checkParallel(Row& row, Ref ref, Api api) {
+        const auto parallel = [&](auto&&... x) {api(ezsimd::parallel, x...);};
+
+        for (size_t n = 0; n < parallelCases; n++) {
+            const size_t l = parallelLength<T>();
+            ezsimd::setStreamThreshold(n % 4 < 2 ? 0 : SIZE_MAX);
+
+            if (n % 2 == 0) {
+                const Inputs<Op, T, inputs> in(l);
+                std::vector<T> got(l + maxOffset + guard);
+
+                for (T& x : got) {
+                    x = randomValue<T>();
+                }
+
+                const std::vector<T> sentinel = got;
+                const size_t offset = rng() % maxOffset;
+                T* const c = got.data() + offset;
+                apply<inputs, scalarB>(parallel, in.p, in.b, c, l);
+
+                for (size_t e = 0; e < l; e++) {
+                    row.compare(c[e], reference<inputs, scalarB>(ref, in.p, in.b, e), e, l);
+                }
+
+                row.untouched(got.data(), sentinel.data(), 0, offset);
+                row.untouched(got.data(), sentinel.data(), offset + l, got.size());
+            } else {
+                Inputs<Op, T, inputs, ezsimd::aligned_vector<T>> in(l, randomValue<T>, 1);
+                ezsimd::aligned_vector<T> c(l);
+                apply<inputs, scalarB>(parallel, in.buffers, in.b, c);
+
+                for (size_t e = 0; e < l; e++) {
+                    row.compare(c[e], reference<inputs, scalarB>(ref, in.p, in.b, e), e, l);
+                }
+            }
+        }
+
+        ezsimd::setStreamThreshold(SIZE_MAX);
+        row.print(parallelCases);
+    }
+
+    // the std::array kernel of Isa for arrays of S elements, with guard elements right after the output
+    template <typename Op, typename T, size_t inputs, bool scalarB, size_t S, typename Isa, typename Ref, typename Fixed>
+    void checkFixedSize(Row& row, Ref ref, Fixed fixed) {
+        struct Guarded {
+            std::array<T, S> c;
+            std::array<T, guard> after;
+        };
+
+        for (size_t n = 0; n < fixedCases; n++) {
+            std::array<T, S> in[inputs];
+            T* p[inputs];
+            T b = randomValue<T>();
+
+            for (size_t k = 0; k < inputs; k++) {
+                for (T& x : in[k]) {
+                    x = randomValue<T>();
+                }
+                p[k] = in[k].data();
+            }
+
+            prepare<Op>(p, b, S);
+            Guarded got;
+
+            for (T& x : got.after) {
+                x = randomValue<T>();
+            }
+
+            const std::array<T, guard> sentinel = got.after;
+            apply<inputs, scalarB>([&](auto&&... x) {fixed(std::integral_constant<size_t, S>{}, Isa{}, x...);}, in, b, got.c);
+
+            for (size_t e = 0; e < S; e++) {
+                row.compare(got.c[e], reference<inputs, scalarB>(ref, p, b, e), e, S);
+            }
+
+            row.untouched(got.after.data(), sentinel.data(), 0, guard);
+        }
+    }
+
+    // inputs is how many arrays the op reads (1 with a single value for b), ref computes one element from them,
+    // api, inplace, and fixed call the public functions of the op, inplace is nullptr if it has no Inplace version
+    template <typename Op, typename T, size_t inputs, bool scalarB, typename Ref, typename Api, typename Inplace, typename Fixed>
+    void check(const char* op, const char* type, Ref ref, Api api, Inplace inplace, Fixed fixed) {
+        double defaultTime = 0;
+
+        forEachTier([&](const ezsimd::Tier tier) {
+            const typename ezsimd::Kernel<Op, T>::type kernel = ezsimd::Kernel<Op, T>::get(tier);
+            if (kernel == nullptr) {
+                return;
+            }
+
+            rng.seed(12345); // every instruction set sees the same cases
+            Row row{op, type, tier};
+            const double seconds = checkBackend<Op, T, inputs, scalarB>(row, kernel, ref);
+            if (tier == ezsimd::Tier::Default) {
+                defaultTime = seconds;
+            }
+            row.print(cases, seconds, defaultTime);
+
+            Row overlap{std::string(op) + " overlap", type, tier};
+            checkOverlap<Op, T, inputs, scalarB>(overlap, ref, api, inplace);
+            Row aligned{std::string(op) + " aligned", type, tier};
+            checkAligned<Op, T, inputs, scalarB>(aligned, ref);
+            Row parallel{std::string(op) + " parallel", type, tier};
+            checkParallel<Op, T, inputs, scalarB>(parallel, ref, api);
+
+            withIsa(tier, [&](auto isa) {
+                Row array{std::string(op) + " std::array", type, tier};
+                checkFixedSize<Op, T, inputs, scalarB, 37, decltype(isa)>(array, ref, fixed);
+                checkFixedSize<Op, T, inputs, scalarB, 128, decltype(isa)>(array, ref, fixed);
+                array.print(2 * fixedCases);
+            });
+        });
+    }
+
+    // a reduction of inputs arrays, ref merges one element (or pair for dot) into the result so far,
+    // which starts from 0 for sum and dot and from the first element for min and max
+    template <typename Op, typename T, size_t inputs, typename Ref, typename Api>
+    void checkReduction(const char* op, const char* type, Ref ref, Api api) {
+        constexpr bool fromFirst = std::is_same<Op, ezsimd::op::Min>::value || std::is_same<Op, ezsimd::op::Max>::value;
+        double defaultTime = 0;
+
+        // the inputs of one case of l elements, misaligned unless offsets is 1
+        const auto inputsOf = [](const size_t l, const size_t offsets = maxOffset) {
+            if constexpr (fromFirst) {
+                return Inputs<Op, T, inputs>(l, randomValue<T>, offsets);
+            } else {
+                return Inputs<Op, T, inputs>(l, exactValues<T>(l), offsets);
+            }
+        };
+
+        const auto want = [&](const Inputs<Op, T, inputs>& in, const size_t l) {
+            T r = fromFirst ? in.p[0][0] : T(0);
+            for (size_t e = 0; e < l; e++) {
+                if constexpr (inputs == 1) {
+                    r = ref(r, in.p[0][e]);
+                } else {
+                    r = ref(r, in.p[0][e], in.p[1][e]);
+                }
+            }
+            return r;
+        };
+
+        forEachTier([&](const ezsimd::Tier tier) {
+            const typename ezsimd::Kernel<Op, T>::type kernel = ezsimd::Kernel<Op, T>::get(tier);
+            if (kernel == nullptr) {
+                return;
+            }
+
+            rng.seed(12345);
+            Row row{op, type, tier};
+
+            for (size_t n = 0; n < cases; n++) {
+                // min and max of nothing have no result
+                const size_t l = randomLength(n) + fromFirst;
+                const Inputs<Op, T, inputs> in = inputsOf(l);
+                row.compare(apply<inputs, false>(kernel, in.p, in.b, l), want(in, l), 0, l);
+            }
+
+            const Inputs<Op, T, inputs> timed = inputsOf(timedLength, 1);
+            // the barriers make every call read the inputs again and keep its result, since a backend the compiler
+            // sees is pure could otherwise be called once for the whole loop, or not at all
+            const double seconds = time([&]() {
+                asm volatile("" ::: "memory");
+                T r = apply<inputs, false>(kernel, timed.p, timed.b, timedLength);
+                asm volatile("" : : "g"(&r) : "memory");
+            });
+            if (tier == ezsimd::Tier::Default) {
+                defaultTime = seconds;
+            }
+            row.print(cases, seconds, defaultTime);
+
+            Row parallel{std::string(op) + " parallel", type, tier};
+            for (size_t n = 0; n < parallelCases; n++) {
+                const size_t l = parallelLength<T>();
+                const Inputs<Op, T, inputs> in = inputsOf(l);
+                const T got = apply<inputs, false>([&](auto&&... x) {return api(ezsimd::parallel, x...);}, in.p, in.b, l);
+                parallel.compare(got, want(in, l), 0, l);
+            }
+            parallel.print(parallelCases);
+        });
+    }
+
+    // the element types a widening or narrowing backend reads and writes, and how many arrays it reads
+    template <typename F>
+    struct Conversion;
+
+    template <typename A, typename C>
+    struct Conversion<void (*)(const A*, C*, size_t)> {
+        using in = A;
+        using out = C;
+        static constexpr size_t inputs = 1;
+    };
+
+    template <typename A, typename C>
+    struct Conversion<void (*)(const A*, const A*, C*, size_t)> {
+        using in = A;
+        using out = C;
+        static constexpr size_t inputs = 2;
+    };
+
+    // widen, narrow, and the widening ops on T, api calls the public function for the ezsimd::parallel check
+    template <typename Op, typename T, typename Api>
+    void checkConversion(const char* op, const char* type, Api api) {
+        using Kernel = ezsimd::Kernel<Op, T>;
+        using In = typename Conversion<typename Kernel::type>::in;
+        using Out = typename Conversion<typename Kernel::type>::out;
+        constexpr size_t inputs = Conversion<typename Kernel::type>::inputs;
+        double defaultTime = 0;
+
+        const auto want = [](const Inputs<Op, In, inputs>& in, const size_t e) {
+            if constexpr (inputs == 1) {
+                return refConvert<Op, Out>(in.p[0][e]);
+            } else {
+                return refConvert<Op, Out>(in.p[0][e], in.p[1][e]);
+            }
+        };
+
+        forEachTier([&](const ezsimd::Tier tier) {
+            const typename Kernel::type kernel = Kernel::get(tier);
+            if (kernel == nullptr) {
+                return;
+            }
+
+            rng.seed(12345);
+            Row row{op, type, tier};
+            std::vector<Out> got(maxLength + maxOffset + guard);
+            std::vector<Out> sentinel(got.size());
+
+            for (Out& x : sentinel) {
+                x = randomValue<Out>();
+            }
+
+            for (size_t n = 0; n < cases; n++) {
+                const size_t l = randomLength(n);
+                const Inputs<Op, In, inputs> in(l, conversionValue<In>);
+                const size_t offset = rng() % maxOffset;
+                Out* const c = got.data() + offset;
+                got = sentinel;
+                ezsimd::setStreamThreshold(n % 2 ? 0 : SIZE_MAX);
+                apply<inputs, false>(kernel, in.p, in.b, c, l);
+
+                for (size_t e = 0; e < l; e++) {
+                    row.compare(c[e], want(in, e), e, l);
+                }
+
+                row.untouched(got.data(), sentinel.data(), 0, offset);
+                row.untouched(got.data(), sentinel.data(), offset + l, offset + l + guard);
+            }
+
+            ezsimd::setStreamThreshold(SIZE_MAX);
+            const Inputs<Op, In, inputs> timed(timedLength, conversionValue<In>, 1);
+            const double seconds = time([&]() {apply<inputs, false>(kernel, timed.p, timed.b, got.data(), timedLength);});
+            if (tier == ezsimd::Tier::Default) {
+                defaultTime = seconds;
+            }
+            row.print(cases, seconds, defaultTime);
+
+            Row parallel{std::string(op) + " parallel", type, tier};
+            for (size_t n = 0; n < parallelCases; n++) {
+                const size_t l = parallelLength<typename std::conditional<(sizeof(In) < sizeof(Out)), In, Out>::type>();
+                const Inputs<Op, In, inputs> in(l, conversionValue<In>);
+                std::vector<Out> out(l + guard);
+
+                for (Out& x : out) {
+                    x = randomValue<Out>();
+                }
+
+                const std::vector<Out> outSentinel = out;
+                apply<inputs, false>([&](auto&&... x) {api(ezsimd::parallel, x...);}, in.p, in.b, out.data(), l);
+
+                for (size_t e = 0; e < l; e++) {
+                    parallel.compare(out[e], want(in, e), e, l);
+                }
+
+                parallel.untouched(out.data(), outSentinel.data(), l, out.size());
+            }
+            parallel.print(parallelCases);
+        });
+    }
+
+    // (a + b) * c, (a - b) * 3, and a / b through ezsimd::eval, which picks its instruction set by maxIsa() too
+    template <typename T>
+    void checkExpr(const char* type) {
+        forEachTier([&](const ezsimd::Tier tier) {
+            rng.seed(12345);
+            Row row{"expr", type, tier};
+            std::vector<T> got(maxLength + maxOffset + guard);
+            std::vector<T> sentinel(got.size());
+
+            for (T& x : sentinel) {
+                x = randomValue<T>();
+            }
+
+            for (size_t n = 0; n < apiCases; n++) {
+                const size_t l = randomLength(n);
+                const Inputs<ezsimd::op::Div, T, 3> in(l);
+                const auto a = ezsimd::expr(in.p[0], l);
+                const auto b = ezsimd::expr(in.p[1], l);
+                const auto c = ezsimd::expr(in.p[2], l);
+
+                for (int form = 0; form < 3; form++) {
+                    const size_t offset = rng() % maxOffset;
+                    T* const d = got.data() + offset;
+                    got = sentinel;
+
+                    if (form == 0) {
+                        ezsimd::eval((a + b) * c, d);
+                    } else if (form == 1) {
+                        ezsimd::eval((a - b) * T(3), d);
+                    } else {
+                        ezsimd::eval(a / b, d);
+                    }
+
+                    for (size_t e = 0; e < l; e++) {
+                        const T x = in.p[0][e];
+                        const T y = in.p[1][e];
+                        const T want = form == 0 ? refMul(refAdd(x, y), in.p[2][e]) : form == 1 ? refMul(refSub(x, y), T(3)) : refDiv(x, y);
+                        row.compare(d[e], want, e, l);
+                    }
+
+                    row.untouched(got.data(), sentinel.data(), 0, offset);
+                    row.untouched(got.data(), sentinel.data(), offset + l, offset + l + guard);
+                }
+            }
+
+            row.print(3 * apiCases);
+        });
+    }
+
+    template <typename T>
+    void checkType(const char* type) {
+        const auto add = [](auto&&... x) {ezsimd::add(x...);};
+        const auto addInplace = [](auto&&... x) {ezsimd::addInplace(x...);};
+        const auto addFixed = [](auto s, auto isa, auto&&... x) {ezsimd::add<decltype(s)::value, decltype(isa)>(x...);};
+        const auto sub = [](auto&&... x) {ezsimd::sub(x...);};
+        const auto subInplace = [](auto&&... x) {ezsimd::subInplace(x...);};
+        const auto subFixed = [](auto s, auto isa, auto&&... x) {ezsimd::sub<decltype(s)::value, decltype(isa)>(x...);};
+        const auto mul = [](auto&&... x) {ezsimd::mul(x...);};
+        const auto mulInplace = [](auto&&... x) {ezsimd::mulInplace(x...);};
+        const auto mulFixed = [](auto s, auto isa, auto&&... x) {ezsimd::mul<decltype(s)::value, decltype(isa)>(x...);};
+        const auto div = [](auto&&... x) {ezsimd::div(x...);};
+        const auto divInplace = [](auto&&... x) {ezsimd::divInplace(x...);};
+        const auto divFixed = [](auto s, auto isa, auto&&... x) {ezsimd::div<decltype(s)::value, decltype(isa)>(x...);};
+        const auto fma = [](auto&&... x) {ezsimd::fma(x...);};
+        const auto fmaFixed = [](auto s, auto isa, auto&&... x) {ezsimd::fma<decltype(s)::value, decltype(isa)>(x...);};
+
+        check<ezsimd::op::Add, T, 2, false>("add", type, refAdd<T>, add, addInplace, addFixed);
+        check<ezsimd::op::AddScalar, T, 1, true>("add scalar", type, refAdd<T>, add, addInplace, addFixed);
+        check<ezsimd::op::Sub, T, 2, false>("sub", type, refSub<T>, sub, subInplace, subFixed);
+        check<ezsimd::op::SubScalar, T, 1, true>("sub scalar", type, refSub<T>, sub, subInplace, subFixed);
+        if constexpr (isInteger<T>) {
+            const auto adds = [](auto&&... x) {ezsimd::adds(x...);};
+            const auto addsInplace = [](auto&&... x) {ezsimd::addsInplace(x...);};
+            const auto addsFixed = [](auto s, auto isa, auto&&... x) {ezsimd::adds<decltype(s)::value, decltype(isa)>(x...);};
+            const auto subs = [](auto&&... x) {ezsimd::subs(x...);};
+            const auto subsInplace = [](auto&&... x) {ezsimd::subsInplace(x...);};
+            const auto subsFixed = [](auto s, auto isa, auto&&... x) {ezsimd::subs<decltype(s)::value, decltype(isa)>(x...);};
+
+            check<ezsimd::op::Adds, T, 2, false>("adds", type, refAdds<T>, adds, addsInplace, addsFixed);
+            check<ezsimd::op::AddsScalar, T, 1, true>("adds scalar", type, refAdds<T>, adds, addsInplace, addsFixed);
+            check<ezsimd::op::Subs, T, 2, false>("subs", type, refSubs<T>, subs, subsInplace, subsFixed);
+            check<ezsimd::op::SubsScalar, T, 1, true>("subs scalar", type, refSubs<T>, subs, subsInplace, subsFixed);
+        }
+        check<ezsimd::op::Mul, T, 2, false>("mul", type, refMul<T>, mul, mulInplace, mulFixed);
+        check<ezsimd::op::MulScalar, T, 1, true>("mul scalar", type, refMul<T>, mul, mulInplace, mulFixed);
+        check<ezsimd::op::Div, T, 2, false>("div", type, refDiv<T>, div, divInplace, divFixed);
+        check<ezsimd::op::DivScalar, T, 1, true>("div scalar", type, refDiv<T>, div, divInplace, divFixed);
+        check<ezsimd::op::Fma, T, 3, false>("fma", type, refFma<T>, fma, nullptr, fmaFixed);
+
+        checkReduction<ezsimd::op::Sum, T, 1>("sum", type, [](const T r, const T a) {return refAdd(r, a);},
+            [](auto&&... x) {return ezsimd::sum(x...);});
+        checkReduction<ezsimd::op::Min, T, 1>("min", type, [](const T r, const T a) {return std::min(r, a);},
+            [](auto&&... x) {return ezsimd::min(x...);});
+        checkReduction<ezsimd::op::Max, T, 1>("max", type, [](const T r, const T a) {return std::max(r, a);},
+            [](auto&&... x) {return ezsimd::max(x...);});
+        checkReduction<ezsimd::op::Dot, T, 2>("dot", type, [](const T r, const T a, const T b) {return refAdd(r, refMul(a, b));},
+            [](auto&&... x) {return ezsimd::dot(x...);});
+
+        // widen reads T and narrow writes it, for every type with a twice as wide one
+        if constexpr (sizeof(T) <= 4) {
+            checkConversion<ezsimd::op::Widen, T>("widen", type, [](auto&&... x) {ezsimd::widen(x...);});
+            checkConversion<ezsimd::op::Narrow, T>("narrow", type, [](auto&&... x) {ezsimd::narrow(x...);});
+            checkConversion<ezsimd::op::AddWiden, T>("add widen", type, [](auto&&... x) {ezsimd::addWiden(x...);});
+            checkConversion<ezsimd::op::SubWiden, T>("sub widen", type, [](auto&&... x) {ezsimd::subWiden(x...);});
+            checkConversion<ezsimd::op::MulWiden, T>("mul widen", type, [](auto&&... x) {ezsimd::mulWiden(x...);});
+        }
+
+        checkExpr<T>(type);
+    }
+}
+
+int main() {
+    std::printf("op,type,isa,cases,mismatches,max_ulps,ns_per_element,speedup\n");
+    // enough threads that ezsimd::parallel checks run chunks on the pool even on a small machine
+    ezsimd::setThreadCount(4);
+    ezsimd::setParallelThreshold(0);
+
+    checkType<int8_t>("int8_t");
+    checkType<int16_t>("int16_t");
+    checkType<int32_t>("int32_t");
+    checkType<int64_t>("int64_t");
+    checkType<__int128_t>("__int128_t");
+    checkType<uint8_t>("uint8_t");
+    checkType<uint16_t>("uint16_t");
+    checkType<uint32_t>("uint32_t");
+    checkType<uint64_t>("uint64_t");
+    checkType<__uint128_t>("__uint128_t");
+    #ifdef EZSIMD_FLOAT16
+        checkType<_Float16>("_Float16");
+    #endif
+    checkType<ezsimd::bfloat16>("bfloat16");
+    checkType<float>("float");
+    checkType<double>("double");
+    checkType<long double>("long double");
+
+    return failed ? 1 : 0;
+}
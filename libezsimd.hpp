@@ -1,13 +1,27 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <vector>
 #include <array>
 
+// AVX-512 functions use the F, BW, DQ, and VL subsets together
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__) && defined(__AVX512VL__)
+    #define EZSIMD_AVX512
+#endif
+
 #if defined(__clang__)
     #warning "clang currently produces unwanted behavior for large amounts of multiversioned functions, keeping only default and best supported SIMD. use g++ for best results."
 
-    #if (defined(__MMX__) && defined(__SSE2__) && defined(__AVX2__))
+    #if defined(EZSIMD_AVX512)
+        #undef __FMA__
+        #undef __MMX__
+        #undef __SSE__
+        #undef __SSE2__
+        #undef __AVX__
+        #undef __AVX2__
+    #elif (defined(__MMX__) && defined(__SSE2__) && defined(__AVX2__))
         #undef __MMX__
         #undef __SSE2__
     #elif defined(__SSE2__)
@@ -23,389 +37,6512 @@
     #warning "compiler may not be supported. use g++ for best results."
 #endif
 
+// half-precision functions convert to float with F16C and AVX2 integer ops, or use AVX-512's FP16 and BF16 extensions
+#if defined(__AVX2__) && defined(__F16C__)
+    #define EZSIMD_F16C
+#endif
+#if defined(EZSIMD_AVX512) && defined(__AVX512BF16__)
+    #define EZSIMD_AVX512BF16
+#endif
+#if defined(EZSIMD_AVX512) && defined(__AVX512FP16__)
+    #define EZSIMD_AVX512FP16
+#endif
+
+// _Float16 functions are only declared when the compiler has the type
+#if defined(__FLT16_MAX__)
+    #define EZSIMD_FLOAT16
+#endif
+
 namespace ezsimd {
     template <typename T, size_t N>
     constexpr inline size_t arrayLength(T (&)[N]) noexcept;
     
+    #if defined(__BFLT16_MAX__)
+        using bfloat16 = __bf16;
+    #else
+        // the top 16 bits of a float, for compilers without __bf16. arithmetic converts to float,
+        // and converting back rounds to nearest even like the SIMD functions do
+        struct bfloat16 {
+            uint16_t bits;
+            
+            bfloat16() = default;
+            
+            bfloat16(const float value) {
+                uint32_t u;
+                std::memcpy(&u, &value, sizeof(u));
+                bits = (u & 0x7FFFFFFF) > 0x7F800000
+                    ? uint16_t((u >> 16) | 0x40) // NaN, kept quiet instead of letting the rounding carry into the exponent
+                    : uint16_t((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+            }
+            
+            operator float() const {
+                const uint32_t u = uint32_t(bits) << 16;
+                float value;
+                std::memcpy(&value, &u, sizeof(value));
+                return value;
+            }
+        };
+    #endif
+    
+    // pass as the first argument to split large arrays across a thread pool
+    struct Parallel {};
+    constexpr Parallel parallel{};
+    
+    // threads used by ezsimd::parallel calls including the calling thread, 0 for one per hardware thread
+    void setThreadCount(size_t n);
+    // ezsimd::parallel calls on arrays smaller than this many bytes run on the calling thread only
+    void setParallelThreshold(size_t bytes);
+    // outputs of at least this many bytes are written with non-temporal stores that bypass the cache,
+    // 0 to always use them, SIZE_MAX to never use them
+    void setStreamThreshold(size_t bytes);
+    
+    // instruction sets the backends are built for, as runtime values, Default is the scalar loop every op has.
+    // the compile-time tags in ezsimd::isa carry theirs as isa::X::tier
+    enum class Tier {Default, MMX, SSE, SSE2, AVX, AVX2, FMA, F16C, AVX512, AVX512BF16, AVX512FP16};
+    
+    // "AVX2" for Tier::AVX2
+    const char* tierName(Tier tier);
+    // true if the running CPU has every feature tier's backends are compiled for, checked once per tier
+    bool cpuSupports(Tier tier);
+    // backends newer than tier aren't used even if the CPU has them, like on shared hosts where AVX-512 lowers the clock.
+    // starts as the EZSIMD_MAX_ISA environment variable (EZSIMD_MAX_ISA=SSE2), and can be changed at any time
+    void setMaxIsa(Tier tier);
+    Tier maxIsa();
+    
+    // how much one backend was used, summed over every thread
+    struct Stat {
+        const char* op; // op tag, like "Add" or "MulScalar"
+        const char* type; // element type, like "float"
+        Tier tier;
+        uint64_t calls; // a parallel call counts once per chunk
+        uint64_t elements;
+        uint64_t bytes; // read and written
+    };
+    
+    // every backend called since the program started or resetStats was called, in no particular order.
+    // counting is compiled in only when EZSIMD_STATS is defined, otherwise this is always empty
+    std::vector<Stat> stats();
+    void resetStats();
+    
+    // Kernel<Op, T>::type is the backend function pointer type for op tag Op on element type T,
+    // Kernel<Op, T>::get() returns the best one for this CPU, chosen on the first call,
+    // and Kernel<Op, T>::get(tier) returns the one built for tier without checking the CPU, nullptr if there is none
+    template <typename Op, typename T>
+    struct Kernel;
+    
+    // backend for Op on T, fetch it once and call it directly in hot loops:
+    // auto add = ezsimd::dispatch<ezsimd::op::Add, float>(); add(a, b, c, l);
+    template <typename Op, typename T>
+    typename Kernel<Op, T>::type dispatch();
+    
+    // op tags for ezsimd::dispatch, the Scalar ones take b as a single value
+    namespace op {
+        struct Add {};
+        struct AddScalar {};
+        struct Sub {};
+        struct SubScalar {};
+        struct Adds {};
+        struct AddsScalar {};
+        struct Subs {};
+        struct SubsScalar {};
+        struct Mul {};
+        struct MulScalar {};
+        struct Div {};
+        struct DivScalar {};
+        struct Fma {};
+        struct Sum {};
+        struct Min {};
+        struct Max {};
+        struct Dot {};
+        struct AddWiden {};
+        struct SubWiden {};
+        struct MulWiden {};
+        struct Widen {};
+        struct Narrow {};
+    }
+    
+    // instruction sets for the std::array overloads, which are built for one at compile time and inlined,
+    // like ezsimd::add<S, ezsimd::isa::AVX2>(a, b, c). each also uses the narrower ones after it for what's left over.
+    // Dispatch is the default, it picks the backend by the CPU and maxIsa() at runtime like the other overloads
+    namespace isa {
+        struct Dispatch {};
+        struct AVX512FP16 {static constexpr Tier tier = Tier::AVX512FP16;};
+        struct AVX512BF16 {static constexpr Tier tier = Tier::AVX512BF16;};
+        struct AVX512 {static constexpr Tier tier = Tier::AVX512;};
+        struct F16C {static constexpr Tier tier = Tier::F16C;};
+        struct FMA {static constexpr Tier tier = Tier::FMA;};
+        struct AVX2 {static constexpr Tier tier = Tier::AVX2;};
+        struct AVX {static constexpr Tier tier = Tier::AVX;};
+        struct SSE2 {static constexpr Tier tier = Tier::SSE2;};
+        struct SSE {static constexpr Tier tier = Tier::SSE;};
+    }
+    
+    template <typename T>
+    struct ExprArray;
+    
+    template <typename T>
+    struct ExprValue;
+    
+    template <typename Op, typename A, typename B>
+    struct ExprNode;
+    
+    // lazy expressions, ezsimd::eval(ezsimd::expr(a) * b + 1.0f, c) computes c = a * b + 1 in one pass over the arrays,
+    // with the widest instruction set that has every op in the expression and that this CPU supports
+    template <typename T, typename Alloc>
+    ExprArray<T> expr(const std::vector<T, Alloc>& a);
+    template <typename T, size_t S>
+    ExprArray<T> expr(const std::array<T, S>& a);
+    template <typename T>
+    ExprArray<T> expr(const T* a, const size_t l);
+    
+    template <typename Op, typename A, typename B>
+    void eval(const ExprNode<Op, A, B>& e, typename A::type* c);
+    template <typename Op, typename A, typename B, typename Alloc>
+    void eval(const ExprNode<Op, A, B>& e, std::vector<typename A::type, Alloc>& c);
+    template <typename Op, typename A, typename B, size_t S>
+    void eval(const ExprNode<Op, A, B>& e, std::array<typename A::type, S>& c);
+    
+    // bytes of the widest vector any backend loads or stores, an AVX-512 register. it is the same in every build
+    // so that aligned_vector<T> is one type in ezsimd.cpp and in programs compiled with other -m flags
+    constexpr size_t simdAlignment = 64;
+    
+    // allocates memory aligned to Align and rounded up to a whole Align bytes, so the vector overloads of
+    // ezsimd::aligned_vector skip the alignment checks and do the last few elements as one more whole vector
+    template <typename T, size_t Align = simdAlignment>
+    struct aligned_allocator {
+        using value_type = T;
+        
+        // __int128_t and long double need 16 bytes even when Align is 8
+        static constexpr size_t alignment = Align > alignof(T) ? Align : alignof(T);
+        
+        template <typename U>
+        struct rebind {
+            using other = aligned_allocator<U, Align>;
+        };
+        
+        aligned_allocator() = default;
+        template <typename U>
+        aligned_allocator(const aligned_allocator<U, Align>&) noexcept;
+        
+        T* allocate(size_t n);
+        void deallocate(T* ptr, size_t n) noexcept;
+        
+        template <typename U>
+        bool operator==(const aligned_allocator<U, Align>&) const noexcept;
+        template <typename U>
+        bool operator!=(const aligned_allocator<U, Align>&) const noexcept;
+    };
+    
+    // std::vector aligned and padded for the widest tier, ezsimd::add(a, b, c) on these takes the aligned path
+    template <typename T>
+    using aligned_vector = std::vector<T, aligned_allocator<T>>;
+    
+    // arena for temporary arrays, each allocation aligned and padded to whole vectors like aligned_allocator.
+    // released memory is kept and handed out again, so a loop that marks, allocates, and releases
+    // only calls malloc while the arena grows on its first few iterations:
+    //     const ezsimd::Scratch::Mark m = ezsimd::scratch().mark();
+    //     float* t = ezsimd::scratch().allocate<float>(l);
+    //     ezsimd::mul(a, b, t, l);
+    //     ezsimd::add(t, c, d, l);
+    //     ezsimd::scratch().release(m);
+    class Scratch {
+        public:
+            // how much of the arena was in use
+            struct Mark {
+                size_t block;
+                size_t used;
+            };
+            
+            Scratch() = default;
+            Scratch(const Scratch&) = delete;
+            Scratch& operator=(const Scratch&) = delete;
+            ~Scratch();
+            
+            // n uninitialized elements, valid until a mark taken before this call is released
+            template <typename T>
+            T* allocate(size_t n);
+            
+            Mark mark() const;
+            // frees everything allocated since m was taken, marks taken after m are invalid afterwards
+            void release(Mark m);
+            // bytes held by the arena, in use or not
+            size_t capacity() const;
+        
+        private:
+            struct Block {
+                unsigned char* data;
+                size_t size;
+            };
+            
+            std::vector<Block> blocks;
+            size_t current = 0; // block allocations come from
+            size_t used = 0; // bytes of it in use
+            
+            void* allocateBytes(size_t bytes);
+    };
+    
+    // this thread's arena, created on the first call and freed when the thread exits
+    Scratch& scratch();
+    
+    // marks scratch() when constructed and releases it when destroyed
+    class ScratchScope {
+        public:
+            ScratchScope();
+            ScratchScope(const ScratchScope&) = delete;
+            ScratchScope& operator=(const ScratchScope&) = delete;
+            ~ScratchScope();
+            
+            template <typename T>
+            T* allocate(size_t n);
+        
+        private:
+            Scratch& arena;
+            Scratch::Mark start;
+    };
+    
     #pragma region // add
         #pragma region // int8_t
+            template <>
+            struct Kernel<op::Add, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c);
             void add(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void add(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
+            void add(Parallel, const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void add(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void add(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void addInplace(std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b);
+            void addInplace(int8_t* a, const int8_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            void addInplace(Parallel, int8_t* a, const int8_t* b, const size_t l);
+            void addInplace(aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            void addInplace(Parallel, aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c);
+            void add(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void add(Parallel, const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            void add(Parallel, const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void add(const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void add(Parallel, const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void addInplace(std::vector<int8_t>& a, const int8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<int8_t, S>& a, const int8_t b);
+            void addInplace(int8_t* a, const int8_t b, const size_t l);
+            void addInplace(Parallel, std::vector<int8_t>& a, const int8_t b);
+            void addInplace(Parallel, int8_t* a, const int8_t b, const size_t l);
+            void addInplace(aligned_vector<int8_t>& a, const int8_t b);
+            void addInplace(Parallel, aligned_vector<int8_t>& a, const int8_t b);
         #pragma endregion // int8_t
 
         #pragma region // int16_t
+            template <>
+            struct Kernel<op::Add, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c);
             void add(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void add(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
+            void add(Parallel, const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void add(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void add(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void addInplace(std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b);
+            void addInplace(int16_t* a, const int16_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            void addInplace(Parallel, int16_t* a, const int16_t* b, const size_t l);
+            void addInplace(aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            void addInplace(Parallel, aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c);
+            void add(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void add(Parallel, const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            void add(Parallel, const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void add(const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void add(Parallel, const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void addInplace(std::vector<int16_t>& a, const int16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<int16_t, S>& a, const int16_t b);
+            void addInplace(int16_t* a, const int16_t b, const size_t l);
+            void addInplace(Parallel, std::vector<int16_t>& a, const int16_t b);
+            void addInplace(Parallel, int16_t* a, const int16_t b, const size_t l);
+            void addInplace(aligned_vector<int16_t>& a, const int16_t b);
+            void addInplace(Parallel, aligned_vector<int16_t>& a, const int16_t b);
         #pragma endregion // int16_t
 
         #pragma region // int32_t
+            template <>
+            struct Kernel<op::Add, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c);
             void add(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void add(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
+            void add(Parallel, const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void add(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void add(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void addInplace(std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b);
+            void addInplace(int32_t* a, const int32_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            void addInplace(Parallel, int32_t* a, const int32_t* b, const size_t l);
+            void addInplace(aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            void addInplace(Parallel, aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c);
+            void add(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void add(Parallel, const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            void add(Parallel, const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void add(const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void add(Parallel, const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void addInplace(std::vector<int32_t>& a, const int32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<int32_t, S>& a, const int32_t b);
+            void addInplace(int32_t* a, const int32_t b, const size_t l);
+            void addInplace(Parallel, std::vector<int32_t>& a, const int32_t b);
+            void addInplace(Parallel, int32_t* a, const int32_t b, const size_t l);
+            void addInplace(aligned_vector<int32_t>& a, const int32_t b);
+            void addInplace(Parallel, aligned_vector<int32_t>& a, const int32_t b);
         #pragma endregion // int32_t
 
         #pragma region // int64_t
+            template <>
+            struct Kernel<op::Add, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c);
             void add(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void add(Parallel, const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
+            void add(Parallel, const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void add(const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void add(Parallel, const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void addInplace(std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b);
+            void addInplace(int64_t* a, const int64_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            void addInplace(Parallel, int64_t* a, const int64_t* b, const size_t l);
+            void addInplace(aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            void addInplace(Parallel, aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c);
+            void add(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void add(Parallel, const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            void add(Parallel, const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void add(const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void add(Parallel, const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void addInplace(std::vector<int64_t>& a, const int64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<int64_t, S>& a, const int64_t b);
+            void addInplace(int64_t* a, const int64_t b, const size_t l);
+            void addInplace(Parallel, std::vector<int64_t>& a, const int64_t b);
+            void addInplace(Parallel, int64_t* a, const int64_t b, const size_t l);
+            void addInplace(aligned_vector<int64_t>& a, const int64_t b);
+            void addInplace(Parallel, aligned_vector<int64_t>& a, const int64_t b);
         #pragma endregion // int64_t
 
         #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Add, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c);
             void add(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void add(Parallel, const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
+            void add(Parallel, const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void add(const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void add(Parallel, const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void addInplace(std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b);
+            void addInplace(__int128_t* a, const __int128_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            void addInplace(Parallel, __int128_t* a, const __int128_t* b, const size_t l);
+            void addInplace(aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            void addInplace(Parallel, aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c);
+            void add(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void add(Parallel, const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            void add(Parallel, const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void add(const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void add(Parallel, const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void addInplace(std::vector<__int128_t>& a, const __int128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<__int128_t, S>& a, const __int128_t b);
+            void addInplace(__int128_t* a, const __int128_t b, const size_t l);
+            void addInplace(Parallel, std::vector<__int128_t>& a, const __int128_t b);
+            void addInplace(Parallel, __int128_t* a, const __int128_t b, const size_t l);
+            void addInplace(aligned_vector<__int128_t>& a, const __int128_t b);
+            void addInplace(Parallel, aligned_vector<__int128_t>& a, const __int128_t b);
         #pragma endregion // __int128_t
 
         #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Add, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c);
             void add(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void add(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
+            void add(Parallel, const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void add(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void add(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void addInplace(std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b);
+            void addInplace(uint8_t* a, const uint8_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            void addInplace(Parallel, uint8_t* a, const uint8_t* b, const size_t l);
+            void addInplace(aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            void addInplace(Parallel, aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c);
+            void add(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void add(Parallel, const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            void add(Parallel, const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void add(const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void add(Parallel, const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void addInplace(std::vector<uint8_t>& a, const uint8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<uint8_t, S>& a, const uint8_t b);
+            void addInplace(uint8_t* a, const uint8_t b, const size_t l);
+            void addInplace(Parallel, std::vector<uint8_t>& a, const uint8_t b);
+            void addInplace(Parallel, uint8_t* a, const uint8_t b, const size_t l);
+            void addInplace(aligned_vector<uint8_t>& a, const uint8_t b);
+            void addInplace(Parallel, aligned_vector<uint8_t>& a, const uint8_t b);
         #pragma endregion // uint8_t
 
         #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Add, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c);
             void add(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void add(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
+            void add(Parallel, const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void add(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void add(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void addInplace(std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b);
+            void addInplace(uint16_t* a, const uint16_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            void addInplace(Parallel, uint16_t* a, const uint16_t* b, const size_t l);
+            void addInplace(aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            void addInplace(Parallel, aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c);
+            void add(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void add(Parallel, const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            void add(Parallel, const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void add(const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void add(Parallel, const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void addInplace(std::vector<uint16_t>& a, const uint16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<uint16_t, S>& a, const uint16_t b);
+            void addInplace(uint16_t* a, const uint16_t b, const size_t l);
+            void addInplace(Parallel, std::vector<uint16_t>& a, const uint16_t b);
+            void addInplace(Parallel, uint16_t* a, const uint16_t b, const size_t l);
+            void addInplace(aligned_vector<uint16_t>& a, const uint16_t b);
+            void addInplace(Parallel, aligned_vector<uint16_t>& a, const uint16_t b);
         #pragma endregion // uint16_t
 
         #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Add, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c);
             void add(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void add(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
+            void add(Parallel, const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void add(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void add(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void addInplace(std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b);
+            void addInplace(uint32_t* a, const uint32_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            void addInplace(Parallel, uint32_t* a, const uint32_t* b, const size_t l);
+            void addInplace(aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            void addInplace(Parallel, aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c);
+            void add(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void add(Parallel, const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            void add(Parallel, const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void add(const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void add(Parallel, const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void addInplace(std::vector<uint32_t>& a, const uint32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<uint32_t, S>& a, const uint32_t b);
+            void addInplace(uint32_t* a, const uint32_t b, const size_t l);
+            void addInplace(Parallel, std::vector<uint32_t>& a, const uint32_t b);
+            void addInplace(Parallel, uint32_t* a, const uint32_t b, const size_t l);
+            void addInplace(aligned_vector<uint32_t>& a, const uint32_t b);
+            void addInplace(Parallel, aligned_vector<uint32_t>& a, const uint32_t b);
         #pragma endregion // uint32_t
 
         #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Add, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c);
             void add(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void add(Parallel, const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
+            void add(Parallel, const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void add(const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void add(Parallel, const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void addInplace(std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b);
+            void addInplace(uint64_t* a, const uint64_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            void addInplace(Parallel, uint64_t* a, const uint64_t* b, const size_t l);
+            void addInplace(aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            void addInplace(Parallel, aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c);
+            void add(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void add(Parallel, const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            void add(Parallel, const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void add(const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void add(Parallel, const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void addInplace(std::vector<uint64_t>& a, const uint64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<uint64_t, S>& a, const uint64_t b);
+            void addInplace(uint64_t* a, const uint64_t b, const size_t l);
+            void addInplace(Parallel, std::vector<uint64_t>& a, const uint64_t b);
+            void addInplace(Parallel, uint64_t* a, const uint64_t b, const size_t l);
+            void addInplace(aligned_vector<uint64_t>& a, const uint64_t b);
+            void addInplace(Parallel, aligned_vector<uint64_t>& a, const uint64_t b);
         #pragma endregion // uint64_t
 
         #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Add, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c);
             void add(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void add(Parallel, const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
+            void add(Parallel, const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void add(const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void add(Parallel, const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void addInplace(std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b);
+            void addInplace(__uint128_t* a, const __uint128_t* b, const size_t l);
+            void addInplace(Parallel, std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            void addInplace(Parallel, __uint128_t* a, const __uint128_t* b, const size_t l);
+            void addInplace(aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            void addInplace(Parallel, aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            template <>
+            struct Kernel<op::AddScalar, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c);
+            void add(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void add(Parallel, const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            void add(Parallel, const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void add(const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void add(Parallel, const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void addInplace(std::vector<__uint128_t>& a, const __uint128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<__uint128_t, S>& a, const __uint128_t b);
+            void addInplace(__uint128_t* a, const __uint128_t b, const size_t l);
+            void addInplace(Parallel, std::vector<__uint128_t>& a, const __uint128_t b);
+            void addInplace(Parallel, __uint128_t* a, const __uint128_t b, const size_t l);
+            void addInplace(aligned_vector<__uint128_t>& a, const __uint128_t b);
+            void addInplace(Parallel, aligned_vector<__uint128_t>& a, const __uint128_t b);
         #pragma endregion // __uint128_t
 
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Add, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<_Float16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<_Float16, S>& c);
+            void add(const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+            void add(Parallel, const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<_Float16>& c);
+            void add(Parallel, const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+            void add(const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<_Float16>& c);
+            void add(Parallel, const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<_Float16>& c);
+            void addInplace(std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<_Float16, S>& a, const std::array<_Float16, S>& b);
+            void addInplace(_Float16* a, const _Float16* b, const size_t l);
+            void addInplace(Parallel, std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            void addInplace(Parallel, _Float16* a, const _Float16* b, const size_t l);
+            void addInplace(aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+            void addInplace(Parallel, aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+            template <>
+            struct Kernel<op::AddScalar, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<_Float16>& a, const _Float16 b, std::vector<_Float16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<_Float16, S>& a, const _Float16 b, std::array<_Float16, S>& c);
+            void add(const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+            void add(Parallel, const std::vector<_Float16>& a, const _Float16 b, std::vector<_Float16>& c);
+            void add(Parallel, const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+            void add(const aligned_vector<_Float16>& a, const _Float16 b, aligned_vector<_Float16>& c);
+            void add(Parallel, const aligned_vector<_Float16>& a, const _Float16 b, aligned_vector<_Float16>& c);
+            void addInplace(std::vector<_Float16>& a, const _Float16 b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<_Float16, S>& a, const _Float16 b);
+            void addInplace(_Float16* a, const _Float16 b, const size_t l);
+            void addInplace(Parallel, std::vector<_Float16>& a, const _Float16 b);
+            void addInplace(Parallel, _Float16* a, const _Float16 b, const size_t l);
+            void addInplace(aligned_vector<_Float16>& a, const _Float16 b);
+            void addInplace(Parallel, aligned_vector<_Float16>& a, const _Float16 b);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Add, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<bfloat16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<bfloat16, S>& c);
+            void add(const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+            void add(Parallel, const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<bfloat16>& c);
+            void add(Parallel, const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+            void add(const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<bfloat16>& c);
+            void add(Parallel, const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<bfloat16>& c);
+            void addInplace(std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b);
+            void addInplace(bfloat16* a, const bfloat16* b, const size_t l);
+            void addInplace(Parallel, std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            void addInplace(Parallel, bfloat16* a, const bfloat16* b, const size_t l);
+            void addInplace(aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+            void addInplace(Parallel, aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+            template <>
+            struct Kernel<op::AddScalar, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<bfloat16>& a, const bfloat16 b, std::vector<bfloat16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<bfloat16, S>& a, const bfloat16 b, std::array<bfloat16, S>& c);
+            void add(const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+            void add(Parallel, const std::vector<bfloat16>& a, const bfloat16 b, std::vector<bfloat16>& c);
+            void add(Parallel, const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+            void add(const aligned_vector<bfloat16>& a, const bfloat16 b, aligned_vector<bfloat16>& c);
+            void add(Parallel, const aligned_vector<bfloat16>& a, const bfloat16 b, aligned_vector<bfloat16>& c);
+            void addInplace(std::vector<bfloat16>& a, const bfloat16 b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<bfloat16, S>& a, const bfloat16 b);
+            void addInplace(bfloat16* a, const bfloat16 b, const size_t l);
+            void addInplace(Parallel, std::vector<bfloat16>& a, const bfloat16 b);
+            void addInplace(Parallel, bfloat16* a, const bfloat16 b, const size_t l);
+            void addInplace(aligned_vector<bfloat16>& a, const bfloat16 b);
+            void addInplace(Parallel, aligned_vector<bfloat16>& a, const bfloat16 b);
+        #pragma endregion // bfloat16
+
         #pragma region // float
+            template <>
+            struct Kernel<op::Add, float> {
+                using type = void (*)(const float* a, const float* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c);
             void add(const float* a, const float* b, float* c, const size_t l);
+            void add(Parallel, const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& c);
+            void add(Parallel, const float* a, const float* b, float* c, const size_t l);
+            void add(const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<float>& c);
+            void add(Parallel, const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<float>& c);
+            void addInplace(std::vector<float>& a, const std::vector<float>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<float, S>& a, const std::array<float, S>& b);
+            void addInplace(float* a, const float* b, const size_t l);
+            void addInplace(Parallel, std::vector<float>& a, const std::vector<float>& b);
+            void addInplace(Parallel, float* a, const float* b, const size_t l);
+            void addInplace(aligned_vector<float>& a, const aligned_vector<float>& b);
+            void addInplace(Parallel, aligned_vector<float>& a, const aligned_vector<float>& b);
+            template <>
+            struct Kernel<op::AddScalar, float> {
+                using type = void (*)(const float* a, const float b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<float>& a, const float b, std::vector<float>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<float, S>& a, const float b, std::array<float, S>& c);
+            void add(const float* a, const float b, float* c, const size_t l);
+            void add(Parallel, const std::vector<float>& a, const float b, std::vector<float>& c);
+            void add(Parallel, const float* a, const float b, float* c, const size_t l);
+            void add(const aligned_vector<float>& a, const float b, aligned_vector<float>& c);
+            void add(Parallel, const aligned_vector<float>& a, const float b, aligned_vector<float>& c);
+            void addInplace(std::vector<float>& a, const float b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<float, S>& a, const float b);
+            void addInplace(float* a, const float b, const size_t l);
+            void addInplace(Parallel, std::vector<float>& a, const float b);
+            void addInplace(Parallel, float* a, const float b, const size_t l);
+            void addInplace(aligned_vector<float>& a, const float b);
+            void addInplace(Parallel, aligned_vector<float>& a, const float b);
         #pragma endregion // float
 
         #pragma region // double
+            template <>
+            struct Kernel<op::Add, double> {
+                using type = void (*)(const double* a, const double* b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c);
             void add(const double* a, const double* b, double* c, const size_t l);
+            void add(Parallel, const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c);
+            void add(Parallel, const double* a, const double* b, double* c, const size_t l);
+            void add(const aligned_vector<double>& a, const aligned_vector<double>& b, aligned_vector<double>& c);
+            void add(Parallel, const aligned_vector<double>& a, const aligned_vector<double>& b, aligned_vector<double>& c);
+            void addInplace(std::vector<double>& a, const std::vector<double>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<double, S>& a, const std::array<double, S>& b);
+            void addInplace(double* a, const double* b, const size_t l);
+            void addInplace(Parallel, std::vector<double>& a, const std::vector<double>& b);
+            void addInplace(Parallel, double* a, const double* b, const size_t l);
+            void addInplace(aligned_vector<double>& a, const aligned_vector<double>& b);
+            void addInplace(Parallel, aligned_vector<double>& a, const aligned_vector<double>& b);
+            template <>
+            struct Kernel<op::AddScalar, double> {
+                using type = void (*)(const double* a, const double b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<double>& a, const double b, std::vector<double>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<double, S>& a, const double b, std::array<double, S>& c);
+            void add(const double* a, const double b, double* c, const size_t l);
+            void add(Parallel, const std::vector<double>& a, const double b, std::vector<double>& c);
+            void add(Parallel, const double* a, const double b, double* c, const size_t l);
+            void add(const aligned_vector<double>& a, const double b, aligned_vector<double>& c);
+            void add(Parallel, const aligned_vector<double>& a, const double b, aligned_vector<double>& c);
+            void addInplace(std::vector<double>& a, const double b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<double, S>& a, const double b);
+            void addInplace(double* a, const double b, const size_t l);
+            void addInplace(Parallel, std::vector<double>& a, const double b);
+            void addInplace(Parallel, double* a, const double b, const size_t l);
+            void addInplace(aligned_vector<double>& a, const double b);
+            void addInplace(Parallel, aligned_vector<double>& a, const double b);
         #pragma endregion // double
 
         #pragma region // long double
+            template <>
+            struct Kernel<op::Add, long double> {
+                using type = void (*)(const long double* a, const long double* b, long double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void add(const std::vector<long double>& a, const std::vector<long double>& b, std::vector<long double>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void add(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c);
             void add(const long double* a, const long double* b, long double* c, const size_t l);
+            void add(Parallel, const std::vector<long double>& a, const std::vector<long double>& b, std::vector<long double>& c);
+            void add(Parallel, const long double* a, const long double* b, long double* c, const size_t l);
+            void add(const aligned_vector<long double>& a, const aligned_vector<long double>& b, aligned_vector<long double>& c);
+            void add(Parallel, const aligned_vector<long double>& a, const aligned_vector<long double>& b, aligned_vector<long double>& c);
+            void addInplace(std::vector<long double>& a, const std::vector<long double>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<long double, S>& a, const std::array<long double, S>& b);
+            void addInplace(long double* a, const long double* b, const size_t l);
+            void addInplace(Parallel, std::vector<long double>& a, const std::vector<long double>& b);
+            void addInplace(Parallel, long double* a, const long double* b, const size_t l);
+            void addInplace(aligned_vector<long double>& a, const aligned_vector<long double>& b);
+            void addInplace(Parallel, aligned_vector<long double>& a, const aligned_vector<long double>& b);
+            template <>
+            struct Kernel<op::AddScalar, long double> {
+                using type = void (*)(const long double* a, const long double b, long double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void add(const std::vector<long double>& a, const long double b, std::vector<long double>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void add(const std::array<long double, S>& a, const long double b, std::array<long double, S>& c);
+            void add(const long double* a, const long double b, long double* c, const size_t l);
+            void add(Parallel, const std::vector<long double>& a, const long double b, std::vector<long double>& c);
+            void add(Parallel, const long double* a, const long double b, long double* c, const size_t l);
+            void add(const aligned_vector<long double>& a, const long double b, aligned_vector<long double>& c);
+            void add(Parallel, const aligned_vector<long double>& a, const long double b, aligned_vector<long double>& c);
+            void addInplace(std::vector<long double>& a, const long double b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addInplace(std::array<long double, S>& a, const long double b);
+            void addInplace(long double* a, const long double b, const size_t l);
+            void addInplace(Parallel, std::vector<long double>& a, const long double b);
+            void addInplace(Parallel, long double* a, const long double b, const size_t l);
+            void addInplace(aligned_vector<long double>& a, const long double b);
+            void addInplace(Parallel, aligned_vector<long double>& a, const long double b);
         #pragma endregion // long double
         
         #define ADD(a, b, c) add(a, b, c, ezsimd::arrayLength(a))
+        #define ADD_INPLACE(a, b) addInplace(a, b, ezsimd::arrayLength(a))
     #pragma endregion // add
     
     #pragma region // sub
         #pragma region // int8_t
+            template <>
+            struct Kernel<op::Sub, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c);
             void sub(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void sub(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
+            void sub(Parallel, const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void sub(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void sub(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void subInplace(std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b);
+            void subInplace(int8_t* a, const int8_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            void subInplace(Parallel, int8_t* a, const int8_t* b, const size_t l);
+            void subInplace(aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            void subInplace(Parallel, aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c);
+            void sub(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void sub(Parallel, const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            void sub(Parallel, const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void sub(const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void sub(Parallel, const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void subInplace(std::vector<int8_t>& a, const int8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<int8_t, S>& a, const int8_t b);
+            void subInplace(int8_t* a, const int8_t b, const size_t l);
+            void subInplace(Parallel, std::vector<int8_t>& a, const int8_t b);
+            void subInplace(Parallel, int8_t* a, const int8_t b, const size_t l);
+            void subInplace(aligned_vector<int8_t>& a, const int8_t b);
+            void subInplace(Parallel, aligned_vector<int8_t>& a, const int8_t b);
         #pragma endregion // int8_t
 
         #pragma region // int16_t
+            template <>
+            struct Kernel<op::Sub, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c);
             void sub(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void sub(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
+            void sub(Parallel, const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void sub(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void sub(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void subInplace(std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b);
+            void subInplace(int16_t* a, const int16_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            void subInplace(Parallel, int16_t* a, const int16_t* b, const size_t l);
+            void subInplace(aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            void subInplace(Parallel, aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c);
+            void sub(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void sub(Parallel, const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            void sub(Parallel, const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void sub(const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void sub(Parallel, const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void subInplace(std::vector<int16_t>& a, const int16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<int16_t, S>& a, const int16_t b);
+            void subInplace(int16_t* a, const int16_t b, const size_t l);
+            void subInplace(Parallel, std::vector<int16_t>& a, const int16_t b);
+            void subInplace(Parallel, int16_t* a, const int16_t b, const size_t l);
+            void subInplace(aligned_vector<int16_t>& a, const int16_t b);
+            void subInplace(Parallel, aligned_vector<int16_t>& a, const int16_t b);
         #pragma endregion // int16_t
 
         #pragma region // int32_t
+            template <>
+            struct Kernel<op::Sub, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c);
             void sub(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void sub(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
+            void sub(Parallel, const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void sub(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void sub(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void subInplace(std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b);
+            void subInplace(int32_t* a, const int32_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            void subInplace(Parallel, int32_t* a, const int32_t* b, const size_t l);
+            void subInplace(aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            void subInplace(Parallel, aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c);
+            void sub(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void sub(Parallel, const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            void sub(Parallel, const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void sub(const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void sub(Parallel, const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void subInplace(std::vector<int32_t>& a, const int32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<int32_t, S>& a, const int32_t b);
+            void subInplace(int32_t* a, const int32_t b, const size_t l);
+            void subInplace(Parallel, std::vector<int32_t>& a, const int32_t b);
+            void subInplace(Parallel, int32_t* a, const int32_t b, const size_t l);
+            void subInplace(aligned_vector<int32_t>& a, const int32_t b);
+            void subInplace(Parallel, aligned_vector<int32_t>& a, const int32_t b);
         #pragma endregion // int32_t
 
         #pragma region // int64_t
+            template <>
+            struct Kernel<op::Sub, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c);
             void sub(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void sub(Parallel, const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
+            void sub(Parallel, const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void sub(const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void sub(Parallel, const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void subInplace(std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b);
+            void subInplace(int64_t* a, const int64_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            void subInplace(Parallel, int64_t* a, const int64_t* b, const size_t l);
+            void subInplace(aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            void subInplace(Parallel, aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c);
+            void sub(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void sub(Parallel, const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            void sub(Parallel, const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void sub(const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void sub(Parallel, const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void subInplace(std::vector<int64_t>& a, const int64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<int64_t, S>& a, const int64_t b);
+            void subInplace(int64_t* a, const int64_t b, const size_t l);
+            void subInplace(Parallel, std::vector<int64_t>& a, const int64_t b);
+            void subInplace(Parallel, int64_t* a, const int64_t b, const size_t l);
+            void subInplace(aligned_vector<int64_t>& a, const int64_t b);
+            void subInplace(Parallel, aligned_vector<int64_t>& a, const int64_t b);
         #pragma endregion // int64_t
 
         #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Sub, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c);
             void sub(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void sub(Parallel, const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
+            void sub(Parallel, const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void sub(const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void sub(Parallel, const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void subInplace(std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b);
+            void subInplace(__int128_t* a, const __int128_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            void subInplace(Parallel, __int128_t* a, const __int128_t* b, const size_t l);
+            void subInplace(aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            void subInplace(Parallel, aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c);
+            void sub(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void sub(Parallel, const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            void sub(Parallel, const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void sub(const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void sub(Parallel, const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void subInplace(std::vector<__int128_t>& a, const __int128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<__int128_t, S>& a, const __int128_t b);
+            void subInplace(__int128_t* a, const __int128_t b, const size_t l);
+            void subInplace(Parallel, std::vector<__int128_t>& a, const __int128_t b);
+            void subInplace(Parallel, __int128_t* a, const __int128_t b, const size_t l);
+            void subInplace(aligned_vector<__int128_t>& a, const __int128_t b);
+            void subInplace(Parallel, aligned_vector<__int128_t>& a, const __int128_t b);
         #pragma endregion // __int128_t
 
         #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Sub, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c);
             void sub(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void sub(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
+            void sub(Parallel, const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void sub(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void sub(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void subInplace(std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b);
+            void subInplace(uint8_t* a, const uint8_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            void subInplace(Parallel, uint8_t* a, const uint8_t* b, const size_t l);
+            void subInplace(aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            void subInplace(Parallel, aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c);
+            void sub(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void sub(Parallel, const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            void sub(Parallel, const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void sub(const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void sub(Parallel, const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void subInplace(std::vector<uint8_t>& a, const uint8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<uint8_t, S>& a, const uint8_t b);
+            void subInplace(uint8_t* a, const uint8_t b, const size_t l);
+            void subInplace(Parallel, std::vector<uint8_t>& a, const uint8_t b);
+            void subInplace(Parallel, uint8_t* a, const uint8_t b, const size_t l);
+            void subInplace(aligned_vector<uint8_t>& a, const uint8_t b);
+            void subInplace(Parallel, aligned_vector<uint8_t>& a, const uint8_t b);
         #pragma endregion // uint8_t
 
         #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Sub, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c);
             void sub(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void sub(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
+            void sub(Parallel, const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void sub(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void sub(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void subInplace(std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b);
+            void subInplace(uint16_t* a, const uint16_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            void subInplace(Parallel, uint16_t* a, const uint16_t* b, const size_t l);
+            void subInplace(aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            void subInplace(Parallel, aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c);
+            void sub(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void sub(Parallel, const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            void sub(Parallel, const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void sub(const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void sub(Parallel, const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void subInplace(std::vector<uint16_t>& a, const uint16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<uint16_t, S>& a, const uint16_t b);
+            void subInplace(uint16_t* a, const uint16_t b, const size_t l);
+            void subInplace(Parallel, std::vector<uint16_t>& a, const uint16_t b);
+            void subInplace(Parallel, uint16_t* a, const uint16_t b, const size_t l);
+            void subInplace(aligned_vector<uint16_t>& a, const uint16_t b);
+            void subInplace(Parallel, aligned_vector<uint16_t>& a, const uint16_t b);
         #pragma endregion // uint16_t
 
         #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Sub, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c);
             void sub(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void sub(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
+            void sub(Parallel, const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void sub(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void sub(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void subInplace(std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b);
+            void subInplace(uint32_t* a, const uint32_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            void subInplace(Parallel, uint32_t* a, const uint32_t* b, const size_t l);
+            void subInplace(aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            void subInplace(Parallel, aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c);
+            void sub(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void sub(Parallel, const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            void sub(Parallel, const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void sub(const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void sub(Parallel, const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void subInplace(std::vector<uint32_t>& a, const uint32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<uint32_t, S>& a, const uint32_t b);
+            void subInplace(uint32_t* a, const uint32_t b, const size_t l);
+            void subInplace(Parallel, std::vector<uint32_t>& a, const uint32_t b);
+            void subInplace(Parallel, uint32_t* a, const uint32_t b, const size_t l);
+            void subInplace(aligned_vector<uint32_t>& a, const uint32_t b);
+            void subInplace(Parallel, aligned_vector<uint32_t>& a, const uint32_t b);
         #pragma endregion // uint32_t
 
         #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Sub, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c);
             void sub(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void sub(Parallel, const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
+            void sub(Parallel, const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void sub(const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void sub(Parallel, const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void subInplace(std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b);
+            void subInplace(uint64_t* a, const uint64_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            void subInplace(Parallel, uint64_t* a, const uint64_t* b, const size_t l);
+            void subInplace(aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            void subInplace(Parallel, aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c);
+            void sub(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void sub(Parallel, const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            void sub(Parallel, const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void sub(const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void sub(Parallel, const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void subInplace(std::vector<uint64_t>& a, const uint64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<uint64_t, S>& a, const uint64_t b);
+            void subInplace(uint64_t* a, const uint64_t b, const size_t l);
+            void subInplace(Parallel, std::vector<uint64_t>& a, const uint64_t b);
+            void subInplace(Parallel, uint64_t* a, const uint64_t b, const size_t l);
+            void subInplace(aligned_vector<uint64_t>& a, const uint64_t b);
+            void subInplace(Parallel, aligned_vector<uint64_t>& a, const uint64_t b);
         #pragma endregion // uint64_t
 
         #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Sub, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c);
             void sub(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void sub(Parallel, const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
+            void sub(Parallel, const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void sub(const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void sub(Parallel, const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void subInplace(std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b);
+            void subInplace(__uint128_t* a, const __uint128_t* b, const size_t l);
+            void subInplace(Parallel, std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            void subInplace(Parallel, __uint128_t* a, const __uint128_t* b, const size_t l);
+            void subInplace(aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            void subInplace(Parallel, aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            template <>
+            struct Kernel<op::SubScalar, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c);
+            void sub(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void sub(Parallel, const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            void sub(Parallel, const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void sub(const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void sub(Parallel, const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void subInplace(std::vector<__uint128_t>& a, const __uint128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<__uint128_t, S>& a, const __uint128_t b);
+            void subInplace(__uint128_t* a, const __uint128_t b, const size_t l);
+            void subInplace(Parallel, std::vector<__uint128_t>& a, const __uint128_t b);
+            void subInplace(Parallel, __uint128_t* a, const __uint128_t b, const size_t l);
+            void subInplace(aligned_vector<__uint128_t>& a, const __uint128_t b);
+            void subInplace(Parallel, aligned_vector<__uint128_t>& a, const __uint128_t b);
         #pragma endregion // __uint128_t
 
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Sub, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<_Float16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<_Float16, S>& c);
+            void sub(const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+            void sub(Parallel, const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<_Float16>& c);
+            void sub(Parallel, const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+            void sub(const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<_Float16>& c);
+            void sub(Parallel, const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<_Float16>& c);
+            void subInplace(std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<_Float16, S>& a, const std::array<_Float16, S>& b);
+            void subInplace(_Float16* a, const _Float16* b, const size_t l);
+            void subInplace(Parallel, std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            void subInplace(Parallel, _Float16* a, const _Float16* b, const size_t l);
+            void subInplace(aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+            void subInplace(Parallel, aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+            template <>
+            struct Kernel<op::SubScalar, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<_Float16>& a, const _Float16 b, std::vector<_Float16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<_Float16, S>& a, const _Float16 b, std::array<_Float16, S>& c);
+            void sub(const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+            void sub(Parallel, const std::vector<_Float16>& a, const _Float16 b, std::vector<_Float16>& c);
+            void sub(Parallel, const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+            void sub(const aligned_vector<_Float16>& a, const _Float16 b, aligned_vector<_Float16>& c);
+            void sub(Parallel, const aligned_vector<_Float16>& a, const _Float16 b, aligned_vector<_Float16>& c);
+            void subInplace(std::vector<_Float16>& a, const _Float16 b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<_Float16, S>& a, const _Float16 b);
+            void subInplace(_Float16* a, const _Float16 b, const size_t l);
+            void subInplace(Parallel, std::vector<_Float16>& a, const _Float16 b);
+            void subInplace(Parallel, _Float16* a, const _Float16 b, const size_t l);
+            void subInplace(aligned_vector<_Float16>& a, const _Float16 b);
+            void subInplace(Parallel, aligned_vector<_Float16>& a, const _Float16 b);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Sub, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<bfloat16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<bfloat16, S>& c);
+            void sub(const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+            void sub(Parallel, const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<bfloat16>& c);
+            void sub(Parallel, const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+            void sub(const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<bfloat16>& c);
+            void sub(Parallel, const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<bfloat16>& c);
+            void subInplace(std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b);
+            void subInplace(bfloat16* a, const bfloat16* b, const size_t l);
+            void subInplace(Parallel, std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            void subInplace(Parallel, bfloat16* a, const bfloat16* b, const size_t l);
+            void subInplace(aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+            void subInplace(Parallel, aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+            template <>
+            struct Kernel<op::SubScalar, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<bfloat16>& a, const bfloat16 b, std::vector<bfloat16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<bfloat16, S>& a, const bfloat16 b, std::array<bfloat16, S>& c);
+            void sub(const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+            void sub(Parallel, const std::vector<bfloat16>& a, const bfloat16 b, std::vector<bfloat16>& c);
+            void sub(Parallel, const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+            void sub(const aligned_vector<bfloat16>& a, const bfloat16 b, aligned_vector<bfloat16>& c);
+            void sub(Parallel, const aligned_vector<bfloat16>& a, const bfloat16 b, aligned_vector<bfloat16>& c);
+            void subInplace(std::vector<bfloat16>& a, const bfloat16 b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<bfloat16, S>& a, const bfloat16 b);
+            void subInplace(bfloat16* a, const bfloat16 b, const size_t l);
+            void subInplace(Parallel, std::vector<bfloat16>& a, const bfloat16 b);
+            void subInplace(Parallel, bfloat16* a, const bfloat16 b, const size_t l);
+            void subInplace(aligned_vector<bfloat16>& a, const bfloat16 b);
+            void subInplace(Parallel, aligned_vector<bfloat16>& a, const bfloat16 b);
+        #pragma endregion // bfloat16
+
         #pragma region // float
+            template <>
+            struct Kernel<op::Sub, float> {
+                using type = void (*)(const float* a, const float* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c);
             void sub(const float* a, const float* b, float* c, const size_t l);
+            void sub(Parallel, const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& c);
+            void sub(Parallel, const float* a, const float* b, float* c, const size_t l);
+            void sub(const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<float>& c);
+            void sub(Parallel, const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<float>& c);
+            void subInplace(std::vector<float>& a, const std::vector<float>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<float, S>& a, const std::array<float, S>& b);
+            void subInplace(float* a, const float* b, const size_t l);
+            void subInplace(Parallel, std::vector<float>& a, const std::vector<float>& b);
+            void subInplace(Parallel, float* a, const float* b, const size_t l);
+            void subInplace(aligned_vector<float>& a, const aligned_vector<float>& b);
+            void subInplace(Parallel, aligned_vector<float>& a, const aligned_vector<float>& b);
+            template <>
+            struct Kernel<op::SubScalar, float> {
+                using type = void (*)(const float* a, const float b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<float>& a, const float b, std::vector<float>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<float, S>& a, const float b, std::array<float, S>& c);
+            void sub(const float* a, const float b, float* c, const size_t l);
+            void sub(Parallel, const std::vector<float>& a, const float b, std::vector<float>& c);
+            void sub(Parallel, const float* a, const float b, float* c, const size_t l);
+            void sub(const aligned_vector<float>& a, const float b, aligned_vector<float>& c);
+            void sub(Parallel, const aligned_vector<float>& a, const float b, aligned_vector<float>& c);
+            void subInplace(std::vector<float>& a, const float b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<float, S>& a, const float b);
+            void subInplace(float* a, const float b, const size_t l);
+            void subInplace(Parallel, std::vector<float>& a, const float b);
+            void subInplace(Parallel, float* a, const float b, const size_t l);
+            void subInplace(aligned_vector<float>& a, const float b);
+            void subInplace(Parallel, aligned_vector<float>& a, const float b);
         #pragma endregion // float
 
         #pragma region // double
+            template <>
+            struct Kernel<op::Sub, double> {
+                using type = void (*)(const double* a, const double* b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c);
             void sub(const double* a, const double* b, double* c, const size_t l);
+            void sub(Parallel, const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c);
+            void sub(Parallel, const double* a, const double* b, double* c, const size_t l);
+            void sub(const aligned_vector<double>& a, const aligned_vector<double>& b, aligned_vector<double>& c);
+            void sub(Parallel, const aligned_vector<double>& a, const aligned_vector<double>& b, aligned_vector<double>& c);
+            void subInplace(std::vector<double>& a, const std::vector<double>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<double, S>& a, const std::array<double, S>& b);
+            void subInplace(double* a, const double* b, const size_t l);
+            void subInplace(Parallel, std::vector<double>& a, const std::vector<double>& b);
+            void subInplace(Parallel, double* a, const double* b, const size_t l);
+            void subInplace(aligned_vector<double>& a, const aligned_vector<double>& b);
+            void subInplace(Parallel, aligned_vector<double>& a, const aligned_vector<double>& b);
+            template <>
+            struct Kernel<op::SubScalar, double> {
+                using type = void (*)(const double* a, const double b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<double>& a, const double b, std::vector<double>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<double, S>& a, const double b, std::array<double, S>& c);
+            void sub(const double* a, const double b, double* c, const size_t l);
+            void sub(Parallel, const std::vector<double>& a, const double b, std::vector<double>& c);
+            void sub(Parallel, const double* a, const double b, double* c, const size_t l);
+            void sub(const aligned_vector<double>& a, const double b, aligned_vector<double>& c);
+            void sub(Parallel, const aligned_vector<double>& a, const double b, aligned_vector<double>& c);
+            void subInplace(std::vector<double>& a, const double b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<double, S>& a, const double b);
+            void subInplace(double* a, const double b, const size_t l);
+            void subInplace(Parallel, std::vector<double>& a, const double b);
+            void subInplace(Parallel, double* a, const double b, const size_t l);
+            void subInplace(aligned_vector<double>& a, const double b);
+            void subInplace(Parallel, aligned_vector<double>& a, const double b);
         #pragma endregion // double
 
         #pragma region // long double
+            template <>
+            struct Kernel<op::Sub, long double> {
+                using type = void (*)(const long double* a, const long double* b, long double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void sub(const std::vector<long double>& a, const std::vector<long double>& b, std::vector<long double>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void sub(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c);
             void sub(const long double* a, const long double* b, long double* c, const size_t l);
+            void sub(Parallel, const std::vector<long double>& a, const std::vector<long double>& b, std::vector<long double>& c);
+            void sub(Parallel, const long double* a, const long double* b, long double* c, const size_t l);
+            void sub(const aligned_vector<long double>& a, const aligned_vector<long double>& b, aligned_vector<long double>& c);
+            void sub(Parallel, const aligned_vector<long double>& a, const aligned_vector<long double>& b, aligned_vector<long double>& c);
+            void subInplace(std::vector<long double>& a, const std::vector<long double>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<long double, S>& a, const std::array<long double, S>& b);
+            void subInplace(long double* a, const long double* b, const size_t l);
+            void subInplace(Parallel, std::vector<long double>& a, const std::vector<long double>& b);
+            void subInplace(Parallel, long double* a, const long double* b, const size_t l);
+            void subInplace(aligned_vector<long double>& a, const aligned_vector<long double>& b);
+            void subInplace(Parallel, aligned_vector<long double>& a, const aligned_vector<long double>& b);
+            template <>
+            struct Kernel<op::SubScalar, long double> {
+                using type = void (*)(const long double* a, const long double b, long double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void sub(const std::vector<long double>& a, const long double b, std::vector<long double>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void sub(const std::array<long double, S>& a, const long double b, std::array<long double, S>& c);
+            void sub(const long double* a, const long double b, long double* c, const size_t l);
+            void sub(Parallel, const std::vector<long double>& a, const long double b, std::vector<long double>& c);
+            void sub(Parallel, const long double* a, const long double b, long double* c, const size_t l);
+            void sub(const aligned_vector<long double>& a, const long double b, aligned_vector<long double>& c);
+            void sub(Parallel, const aligned_vector<long double>& a, const long double b, aligned_vector<long double>& c);
+            void subInplace(std::vector<long double>& a, const long double b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subInplace(std::array<long double, S>& a, const long double b);
+            void subInplace(long double* a, const long double b, const size_t l);
+            void subInplace(Parallel, std::vector<long double>& a, const long double b);
+            void subInplace(Parallel, long double* a, const long double b, const size_t l);
+            void subInplace(aligned_vector<long double>& a, const long double b);
+            void subInplace(Parallel, aligned_vector<long double>& a, const long double b);
         #pragma endregion // long double
         
         #define SUB(a, b, c) sub(a, b, c, ezsimd::arrayLength(a))
+        #define SUB_INPLACE(a, b) subInplace(a, b, ezsimd::arrayLength(a))
     #pragma endregion // sub
     
+    #pragma region // adds
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::Adds, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c);
+            void adds(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void adds(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
+            void adds(Parallel, const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void adds(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void adds(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void addsInplace(std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b);
+            void addsInplace(int8_t* a, const int8_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            void addsInplace(Parallel, int8_t* a, const int8_t* b, const size_t l);
+            void addsInplace(aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            void addsInplace(Parallel, aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c);
+            void adds(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void adds(Parallel, const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            void adds(Parallel, const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void adds(const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void adds(Parallel, const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void addsInplace(std::vector<int8_t>& a, const int8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<int8_t, S>& a, const int8_t b);
+            void addsInplace(int8_t* a, const int8_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<int8_t>& a, const int8_t b);
+            void addsInplace(Parallel, int8_t* a, const int8_t b, const size_t l);
+            void addsInplace(aligned_vector<int8_t>& a, const int8_t b);
+            void addsInplace(Parallel, aligned_vector<int8_t>& a, const int8_t b);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::Adds, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c);
+            void adds(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void adds(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
+            void adds(Parallel, const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void adds(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void adds(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void addsInplace(std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b);
+            void addsInplace(int16_t* a, const int16_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            void addsInplace(Parallel, int16_t* a, const int16_t* b, const size_t l);
+            void addsInplace(aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            void addsInplace(Parallel, aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c);
+            void adds(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void adds(Parallel, const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            void adds(Parallel, const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void adds(const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void adds(Parallel, const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void addsInplace(std::vector<int16_t>& a, const int16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<int16_t, S>& a, const int16_t b);
+            void addsInplace(int16_t* a, const int16_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<int16_t>& a, const int16_t b);
+            void addsInplace(Parallel, int16_t* a, const int16_t b, const size_t l);
+            void addsInplace(aligned_vector<int16_t>& a, const int16_t b);
+            void addsInplace(Parallel, aligned_vector<int16_t>& a, const int16_t b);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::Adds, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c);
+            void adds(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void adds(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
+            void adds(Parallel, const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void adds(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void adds(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void addsInplace(std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b);
+            void addsInplace(int32_t* a, const int32_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            void addsInplace(Parallel, int32_t* a, const int32_t* b, const size_t l);
+            void addsInplace(aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            void addsInplace(Parallel, aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c);
+            void adds(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void adds(Parallel, const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            void adds(Parallel, const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void adds(const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void adds(Parallel, const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void addsInplace(std::vector<int32_t>& a, const int32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<int32_t, S>& a, const int32_t b);
+            void addsInplace(int32_t* a, const int32_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<int32_t>& a, const int32_t b);
+            void addsInplace(Parallel, int32_t* a, const int32_t b, const size_t l);
+            void addsInplace(aligned_vector<int32_t>& a, const int32_t b);
+            void addsInplace(Parallel, aligned_vector<int32_t>& a, const int32_t b);
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Kernel<op::Adds, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c);
+            void adds(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void adds(Parallel, const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
+            void adds(Parallel, const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void adds(const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void adds(Parallel, const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void addsInplace(std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b);
+            void addsInplace(int64_t* a, const int64_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            void addsInplace(Parallel, int64_t* a, const int64_t* b, const size_t l);
+            void addsInplace(aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            void addsInplace(Parallel, aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c);
+            void adds(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void adds(Parallel, const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            void adds(Parallel, const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void adds(const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void adds(Parallel, const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void addsInplace(std::vector<int64_t>& a, const int64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<int64_t, S>& a, const int64_t b);
+            void addsInplace(int64_t* a, const int64_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<int64_t>& a, const int64_t b);
+            void addsInplace(Parallel, int64_t* a, const int64_t b, const size_t l);
+            void addsInplace(aligned_vector<int64_t>& a, const int64_t b);
+            void addsInplace(Parallel, aligned_vector<int64_t>& a, const int64_t b);
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Adds, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c);
+            void adds(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void adds(Parallel, const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
+            void adds(Parallel, const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void adds(const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void adds(Parallel, const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void addsInplace(std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b);
+            void addsInplace(__int128_t* a, const __int128_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            void addsInplace(Parallel, __int128_t* a, const __int128_t* b, const size_t l);
+            void addsInplace(aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            void addsInplace(Parallel, aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c);
+            void adds(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void adds(Parallel, const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            void adds(Parallel, const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void adds(const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void adds(Parallel, const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void addsInplace(std::vector<__int128_t>& a, const __int128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<__int128_t, S>& a, const __int128_t b);
+            void addsInplace(__int128_t* a, const __int128_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<__int128_t>& a, const __int128_t b);
+            void addsInplace(Parallel, __int128_t* a, const __int128_t b, const size_t l);
+            void addsInplace(aligned_vector<__int128_t>& a, const __int128_t b);
+            void addsInplace(Parallel, aligned_vector<__int128_t>& a, const __int128_t b);
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Adds, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c);
+            void adds(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void adds(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
+            void adds(Parallel, const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void adds(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void adds(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void addsInplace(std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b);
+            void addsInplace(uint8_t* a, const uint8_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            void addsInplace(Parallel, uint8_t* a, const uint8_t* b, const size_t l);
+            void addsInplace(aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            void addsInplace(Parallel, aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c);
+            void adds(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void adds(Parallel, const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            void adds(Parallel, const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void adds(const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void adds(Parallel, const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void addsInplace(std::vector<uint8_t>& a, const uint8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<uint8_t, S>& a, const uint8_t b);
+            void addsInplace(uint8_t* a, const uint8_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<uint8_t>& a, const uint8_t b);
+            void addsInplace(Parallel, uint8_t* a, const uint8_t b, const size_t l);
+            void addsInplace(aligned_vector<uint8_t>& a, const uint8_t b);
+            void addsInplace(Parallel, aligned_vector<uint8_t>& a, const uint8_t b);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Adds, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c);
+            void adds(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void adds(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
+            void adds(Parallel, const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void adds(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void adds(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void addsInplace(std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b);
+            void addsInplace(uint16_t* a, const uint16_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            void addsInplace(Parallel, uint16_t* a, const uint16_t* b, const size_t l);
+            void addsInplace(aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            void addsInplace(Parallel, aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c);
+            void adds(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void adds(Parallel, const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            void adds(Parallel, const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void adds(const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void adds(Parallel, const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void addsInplace(std::vector<uint16_t>& a, const uint16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<uint16_t, S>& a, const uint16_t b);
+            void addsInplace(uint16_t* a, const uint16_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<uint16_t>& a, const uint16_t b);
+            void addsInplace(Parallel, uint16_t* a, const uint16_t b, const size_t l);
+            void addsInplace(aligned_vector<uint16_t>& a, const uint16_t b);
+            void addsInplace(Parallel, aligned_vector<uint16_t>& a, const uint16_t b);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Adds, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c);
+            void adds(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void adds(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
+            void adds(Parallel, const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void adds(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void adds(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void addsInplace(std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b);
+            void addsInplace(uint32_t* a, const uint32_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            void addsInplace(Parallel, uint32_t* a, const uint32_t* b, const size_t l);
+            void addsInplace(aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            void addsInplace(Parallel, aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c);
+            void adds(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void adds(Parallel, const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            void adds(Parallel, const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void adds(const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void adds(Parallel, const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void addsInplace(std::vector<uint32_t>& a, const uint32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<uint32_t, S>& a, const uint32_t b);
+            void addsInplace(uint32_t* a, const uint32_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<uint32_t>& a, const uint32_t b);
+            void addsInplace(Parallel, uint32_t* a, const uint32_t b, const size_t l);
+            void addsInplace(aligned_vector<uint32_t>& a, const uint32_t b);
+            void addsInplace(Parallel, aligned_vector<uint32_t>& a, const uint32_t b);
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Adds, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c);
+            void adds(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void adds(Parallel, const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
+            void adds(Parallel, const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void adds(const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void adds(Parallel, const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void addsInplace(std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b);
+            void addsInplace(uint64_t* a, const uint64_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            void addsInplace(Parallel, uint64_t* a, const uint64_t* b, const size_t l);
+            void addsInplace(aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            void addsInplace(Parallel, aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c);
+            void adds(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void adds(Parallel, const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            void adds(Parallel, const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void adds(const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void adds(Parallel, const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void addsInplace(std::vector<uint64_t>& a, const uint64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<uint64_t, S>& a, const uint64_t b);
+            void addsInplace(uint64_t* a, const uint64_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<uint64_t>& a, const uint64_t b);
+            void addsInplace(Parallel, uint64_t* a, const uint64_t b, const size_t l);
+            void addsInplace(aligned_vector<uint64_t>& a, const uint64_t b);
+            void addsInplace(Parallel, aligned_vector<uint64_t>& a, const uint64_t b);
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Adds, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c);
+            void adds(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void adds(Parallel, const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
+            void adds(Parallel, const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void adds(const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void adds(Parallel, const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void addsInplace(std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b);
+            void addsInplace(__uint128_t* a, const __uint128_t* b, const size_t l);
+            void addsInplace(Parallel, std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            void addsInplace(Parallel, __uint128_t* a, const __uint128_t* b, const size_t l);
+            void addsInplace(aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            void addsInplace(Parallel, aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            template <>
+            struct Kernel<op::AddsScalar, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void adds(const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void adds(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c);
+            void adds(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void adds(Parallel, const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            void adds(Parallel, const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void adds(const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void adds(Parallel, const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void addsInplace(std::vector<__uint128_t>& a, const __uint128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void addsInplace(std::array<__uint128_t, S>& a, const __uint128_t b);
+            void addsInplace(__uint128_t* a, const __uint128_t b, const size_t l);
+            void addsInplace(Parallel, std::vector<__uint128_t>& a, const __uint128_t b);
+            void addsInplace(Parallel, __uint128_t* a, const __uint128_t b, const size_t l);
+            void addsInplace(aligned_vector<__uint128_t>& a, const __uint128_t b);
+            void addsInplace(Parallel, aligned_vector<__uint128_t>& a, const __uint128_t b);
+        #pragma endregion // __uint128_t
+        
+        #define ADDS(a, b, c) adds(a, b, c, ezsimd::arrayLength(a))
+        #define ADDS_INPLACE(a, b) addsInplace(a, b, ezsimd::arrayLength(a))
+    #pragma endregion // adds
+    
+    #pragma region // subs
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::Subs, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c);
+            void subs(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void subs(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
+            void subs(Parallel, const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void subs(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void subs(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void subsInplace(std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b);
+            void subsInplace(int8_t* a, const int8_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            void subsInplace(Parallel, int8_t* a, const int8_t* b, const size_t l);
+            void subsInplace(aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            void subsInplace(Parallel, aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c);
+            void subs(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void subs(Parallel, const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            void subs(Parallel, const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void subs(const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void subs(Parallel, const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void subsInplace(std::vector<int8_t>& a, const int8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<int8_t, S>& a, const int8_t b);
+            void subsInplace(int8_t* a, const int8_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<int8_t>& a, const int8_t b);
+            void subsInplace(Parallel, int8_t* a, const int8_t b, const size_t l);
+            void subsInplace(aligned_vector<int8_t>& a, const int8_t b);
+            void subsInplace(Parallel, aligned_vector<int8_t>& a, const int8_t b);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::Subs, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c);
+            void subs(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void subs(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
+            void subs(Parallel, const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void subs(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void subs(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void subsInplace(std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b);
+            void subsInplace(int16_t* a, const int16_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            void subsInplace(Parallel, int16_t* a, const int16_t* b, const size_t l);
+            void subsInplace(aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            void subsInplace(Parallel, aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c);
+            void subs(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void subs(Parallel, const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            void subs(Parallel, const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void subs(const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void subs(Parallel, const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void subsInplace(std::vector<int16_t>& a, const int16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<int16_t, S>& a, const int16_t b);
+            void subsInplace(int16_t* a, const int16_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<int16_t>& a, const int16_t b);
+            void subsInplace(Parallel, int16_t* a, const int16_t b, const size_t l);
+            void subsInplace(aligned_vector<int16_t>& a, const int16_t b);
+            void subsInplace(Parallel, aligned_vector<int16_t>& a, const int16_t b);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::Subs, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c);
+            void subs(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void subs(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
+            void subs(Parallel, const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void subs(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void subs(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void subsInplace(std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b);
+            void subsInplace(int32_t* a, const int32_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            void subsInplace(Parallel, int32_t* a, const int32_t* b, const size_t l);
+            void subsInplace(aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            void subsInplace(Parallel, aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c);
+            void subs(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void subs(Parallel, const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            void subs(Parallel, const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void subs(const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void subs(Parallel, const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void subsInplace(std::vector<int32_t>& a, const int32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<int32_t, S>& a, const int32_t b);
+            void subsInplace(int32_t* a, const int32_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<int32_t>& a, const int32_t b);
+            void subsInplace(Parallel, int32_t* a, const int32_t b, const size_t l);
+            void subsInplace(aligned_vector<int32_t>& a, const int32_t b);
+            void subsInplace(Parallel, aligned_vector<int32_t>& a, const int32_t b);
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Kernel<op::Subs, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c);
+            void subs(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void subs(Parallel, const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
+            void subs(Parallel, const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void subs(const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void subs(Parallel, const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void subsInplace(std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b);
+            void subsInplace(int64_t* a, const int64_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            void subsInplace(Parallel, int64_t* a, const int64_t* b, const size_t l);
+            void subsInplace(aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            void subsInplace(Parallel, aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c);
+            void subs(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void subs(Parallel, const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            void subs(Parallel, const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void subs(const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void subs(Parallel, const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void subsInplace(std::vector<int64_t>& a, const int64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<int64_t, S>& a, const int64_t b);
+            void subsInplace(int64_t* a, const int64_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<int64_t>& a, const int64_t b);
+            void subsInplace(Parallel, int64_t* a, const int64_t b, const size_t l);
+            void subsInplace(aligned_vector<int64_t>& a, const int64_t b);
+            void subsInplace(Parallel, aligned_vector<int64_t>& a, const int64_t b);
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Subs, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c);
+            void subs(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void subs(Parallel, const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
+            void subs(Parallel, const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void subs(const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void subs(Parallel, const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void subsInplace(std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b);
+            void subsInplace(__int128_t* a, const __int128_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            void subsInplace(Parallel, __int128_t* a, const __int128_t* b, const size_t l);
+            void subsInplace(aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            void subsInplace(Parallel, aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c);
+            void subs(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void subs(Parallel, const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            void subs(Parallel, const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void subs(const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void subs(Parallel, const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void subsInplace(std::vector<__int128_t>& a, const __int128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<__int128_t, S>& a, const __int128_t b);
+            void subsInplace(__int128_t* a, const __int128_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<__int128_t>& a, const __int128_t b);
+            void subsInplace(Parallel, __int128_t* a, const __int128_t b, const size_t l);
+            void subsInplace(aligned_vector<__int128_t>& a, const __int128_t b);
+            void subsInplace(Parallel, aligned_vector<__int128_t>& a, const __int128_t b);
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Subs, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c);
+            void subs(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void subs(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
+            void subs(Parallel, const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void subs(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void subs(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void subsInplace(std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b);
+            void subsInplace(uint8_t* a, const uint8_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            void subsInplace(Parallel, uint8_t* a, const uint8_t* b, const size_t l);
+            void subsInplace(aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            void subsInplace(Parallel, aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c);
+            void subs(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void subs(Parallel, const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            void subs(Parallel, const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void subs(const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void subs(Parallel, const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void subsInplace(std::vector<uint8_t>& a, const uint8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<uint8_t, S>& a, const uint8_t b);
+            void subsInplace(uint8_t* a, const uint8_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<uint8_t>& a, const uint8_t b);
+            void subsInplace(Parallel, uint8_t* a, const uint8_t b, const size_t l);
+            void subsInplace(aligned_vector<uint8_t>& a, const uint8_t b);
+            void subsInplace(Parallel, aligned_vector<uint8_t>& a, const uint8_t b);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Subs, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c);
+            void subs(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void subs(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
+            void subs(Parallel, const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void subs(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void subs(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void subsInplace(std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b);
+            void subsInplace(uint16_t* a, const uint16_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            void subsInplace(Parallel, uint16_t* a, const uint16_t* b, const size_t l);
+            void subsInplace(aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            void subsInplace(Parallel, aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c);
+            void subs(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void subs(Parallel, const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            void subs(Parallel, const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void subs(const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void subs(Parallel, const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void subsInplace(std::vector<uint16_t>& a, const uint16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<uint16_t, S>& a, const uint16_t b);
+            void subsInplace(uint16_t* a, const uint16_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<uint16_t>& a, const uint16_t b);
+            void subsInplace(Parallel, uint16_t* a, const uint16_t b, const size_t l);
+            void subsInplace(aligned_vector<uint16_t>& a, const uint16_t b);
+            void subsInplace(Parallel, aligned_vector<uint16_t>& a, const uint16_t b);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Subs, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c);
+            void subs(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void subs(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
+            void subs(Parallel, const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void subs(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void subs(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void subsInplace(std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b);
+            void subsInplace(uint32_t* a, const uint32_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            void subsInplace(Parallel, uint32_t* a, const uint32_t* b, const size_t l);
+            void subsInplace(aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            void subsInplace(Parallel, aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c);
+            void subs(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void subs(Parallel, const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            void subs(Parallel, const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void subs(const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void subs(Parallel, const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void subsInplace(std::vector<uint32_t>& a, const uint32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<uint32_t, S>& a, const uint32_t b);
+            void subsInplace(uint32_t* a, const uint32_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<uint32_t>& a, const uint32_t b);
+            void subsInplace(Parallel, uint32_t* a, const uint32_t b, const size_t l);
+            void subsInplace(aligned_vector<uint32_t>& a, const uint32_t b);
+            void subsInplace(Parallel, aligned_vector<uint32_t>& a, const uint32_t b);
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Subs, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c);
+            void subs(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void subs(Parallel, const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
+            void subs(Parallel, const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void subs(const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void subs(Parallel, const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void subsInplace(std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b);
+            void subsInplace(uint64_t* a, const uint64_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            void subsInplace(Parallel, uint64_t* a, const uint64_t* b, const size_t l);
+            void subsInplace(aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            void subsInplace(Parallel, aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c);
+            void subs(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void subs(Parallel, const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            void subs(Parallel, const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void subs(const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void subs(Parallel, const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void subsInplace(std::vector<uint64_t>& a, const uint64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<uint64_t, S>& a, const uint64_t b);
+            void subsInplace(uint64_t* a, const uint64_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<uint64_t>& a, const uint64_t b);
+            void subsInplace(Parallel, uint64_t* a, const uint64_t b, const size_t l);
+            void subsInplace(aligned_vector<uint64_t>& a, const uint64_t b);
+            void subsInplace(Parallel, aligned_vector<uint64_t>& a, const uint64_t b);
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Subs, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c);
+            void subs(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void subs(Parallel, const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
+            void subs(Parallel, const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void subs(const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void subs(Parallel, const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void subsInplace(std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b);
+            void subsInplace(__uint128_t* a, const __uint128_t* b, const size_t l);
+            void subsInplace(Parallel, std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            void subsInplace(Parallel, __uint128_t* a, const __uint128_t* b, const size_t l);
+            void subsInplace(aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            void subsInplace(Parallel, aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            template <>
+            struct Kernel<op::SubsScalar, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void subs(const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subs(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c);
+            void subs(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void subs(Parallel, const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            void subs(Parallel, const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void subs(const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void subs(Parallel, const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void subsInplace(std::vector<__uint128_t>& a, const __uint128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void subsInplace(std::array<__uint128_t, S>& a, const __uint128_t b);
+            void subsInplace(__uint128_t* a, const __uint128_t b, const size_t l);
+            void subsInplace(Parallel, std::vector<__uint128_t>& a, const __uint128_t b);
+            void subsInplace(Parallel, __uint128_t* a, const __uint128_t b, const size_t l);
+            void subsInplace(aligned_vector<__uint128_t>& a, const __uint128_t b);
+            void subsInplace(Parallel, aligned_vector<__uint128_t>& a, const __uint128_t b);
+        #pragma endregion // __uint128_t
+        
+        #define SUBS(a, b, c) subs(a, b, c, ezsimd::arrayLength(a))
+        #define SUBS_INPLACE(a, b) subsInplace(a, b, ezsimd::arrayLength(a))
+    #pragma endregion // subs
+    
     #pragma region // mul
         #pragma region // int8_t
+            template <>
+            struct Kernel<op::Mul, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c);
             void mul(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void mul(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
+            void mul(Parallel, const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void mul(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void mul(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void mulInplace(std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b);
+            void mulInplace(int8_t* a, const int8_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            void mulInplace(Parallel, int8_t* a, const int8_t* b, const size_t l);
+            void mulInplace(aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            void mulInplace(Parallel, aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c);
+            void mul(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void mul(Parallel, const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            void mul(Parallel, const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void mul(const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void mul(Parallel, const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void mulInplace(std::vector<int8_t>& a, const int8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<int8_t, S>& a, const int8_t b);
+            void mulInplace(int8_t* a, const int8_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<int8_t>& a, const int8_t b);
+            void mulInplace(Parallel, int8_t* a, const int8_t b, const size_t l);
+            void mulInplace(aligned_vector<int8_t>& a, const int8_t b);
+            void mulInplace(Parallel, aligned_vector<int8_t>& a, const int8_t b);
         #pragma endregion // int8_t
 
         #pragma region // int16_t
+            template <>
+            struct Kernel<op::Mul, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c);
             void mul(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void mul(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
+            void mul(Parallel, const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void mul(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void mul(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void mulInplace(std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b);
+            void mulInplace(int16_t* a, const int16_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            void mulInplace(Parallel, int16_t* a, const int16_t* b, const size_t l);
+            void mulInplace(aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            void mulInplace(Parallel, aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c);
+            void mul(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void mul(Parallel, const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            void mul(Parallel, const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void mul(const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void mul(Parallel, const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void mulInplace(std::vector<int16_t>& a, const int16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<int16_t, S>& a, const int16_t b);
+            void mulInplace(int16_t* a, const int16_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<int16_t>& a, const int16_t b);
+            void mulInplace(Parallel, int16_t* a, const int16_t b, const size_t l);
+            void mulInplace(aligned_vector<int16_t>& a, const int16_t b);
+            void mulInplace(Parallel, aligned_vector<int16_t>& a, const int16_t b);
         #pragma endregion // int16_t
 
         #pragma region // int32_t
+            template <>
+            struct Kernel<op::Mul, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c);
             void mul(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void mul(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
+            void mul(Parallel, const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void mul(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void mul(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void mulInplace(std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b);
+            void mulInplace(int32_t* a, const int32_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            void mulInplace(Parallel, int32_t* a, const int32_t* b, const size_t l);
+            void mulInplace(aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            void mulInplace(Parallel, aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c);
+            void mul(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void mul(Parallel, const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            void mul(Parallel, const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void mul(const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void mul(Parallel, const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void mulInplace(std::vector<int32_t>& a, const int32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<int32_t, S>& a, const int32_t b);
+            void mulInplace(int32_t* a, const int32_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<int32_t>& a, const int32_t b);
+            void mulInplace(Parallel, int32_t* a, const int32_t b, const size_t l);
+            void mulInplace(aligned_vector<int32_t>& a, const int32_t b);
+            void mulInplace(Parallel, aligned_vector<int32_t>& a, const int32_t b);
         #pragma endregion // int32_t
 
         #pragma region // int64_t
+            template <>
+            struct Kernel<op::Mul, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c);
             void mul(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void mul(Parallel, const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
+            void mul(Parallel, const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void mul(const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void mul(Parallel, const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void mulInplace(std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b);
+            void mulInplace(int64_t* a, const int64_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            void mulInplace(Parallel, int64_t* a, const int64_t* b, const size_t l);
+            void mulInplace(aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            void mulInplace(Parallel, aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c);
+            void mul(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void mul(Parallel, const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            void mul(Parallel, const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void mul(const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void mul(Parallel, const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void mulInplace(std::vector<int64_t>& a, const int64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<int64_t, S>& a, const int64_t b);
+            void mulInplace(int64_t* a, const int64_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<int64_t>& a, const int64_t b);
+            void mulInplace(Parallel, int64_t* a, const int64_t b, const size_t l);
+            void mulInplace(aligned_vector<int64_t>& a, const int64_t b);
+            void mulInplace(Parallel, aligned_vector<int64_t>& a, const int64_t b);
         #pragma endregion // int64_t
 
         #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Mul, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c);
             void mul(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void mul(Parallel, const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
+            void mul(Parallel, const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void mul(const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void mul(Parallel, const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void mulInplace(std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b);
+            void mulInplace(__int128_t* a, const __int128_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            void mulInplace(Parallel, __int128_t* a, const __int128_t* b, const size_t l);
+            void mulInplace(aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            void mulInplace(Parallel, aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c);
+            void mul(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void mul(Parallel, const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            void mul(Parallel, const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void mul(const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void mul(Parallel, const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void mulInplace(std::vector<__int128_t>& a, const __int128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<__int128_t, S>& a, const __int128_t b);
+            void mulInplace(__int128_t* a, const __int128_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<__int128_t>& a, const __int128_t b);
+            void mulInplace(Parallel, __int128_t* a, const __int128_t b, const size_t l);
+            void mulInplace(aligned_vector<__int128_t>& a, const __int128_t b);
+            void mulInplace(Parallel, aligned_vector<__int128_t>& a, const __int128_t b);
         #pragma endregion // __int128_t
 
         #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Mul, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c);
             void mul(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void mul(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
+            void mul(Parallel, const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void mul(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void mul(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void mulInplace(std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b);
+            void mulInplace(uint8_t* a, const uint8_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            void mulInplace(Parallel, uint8_t* a, const uint8_t* b, const size_t l);
+            void mulInplace(aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            void mulInplace(Parallel, aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c);
+            void mul(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void mul(Parallel, const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            void mul(Parallel, const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void mul(const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void mul(Parallel, const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void mulInplace(std::vector<uint8_t>& a, const uint8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<uint8_t, S>& a, const uint8_t b);
+            void mulInplace(uint8_t* a, const uint8_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<uint8_t>& a, const uint8_t b);
+            void mulInplace(Parallel, uint8_t* a, const uint8_t b, const size_t l);
+            void mulInplace(aligned_vector<uint8_t>& a, const uint8_t b);
+            void mulInplace(Parallel, aligned_vector<uint8_t>& a, const uint8_t b);
         #pragma endregion // uint8_t
 
         #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Mul, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c);
             void mul(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void mul(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
+            void mul(Parallel, const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void mul(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void mul(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void mulInplace(std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b);
+            void mulInplace(uint16_t* a, const uint16_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            void mulInplace(Parallel, uint16_t* a, const uint16_t* b, const size_t l);
+            void mulInplace(aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            void mulInplace(Parallel, aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c);
+            void mul(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void mul(Parallel, const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            void mul(Parallel, const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void mul(const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void mul(Parallel, const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void mulInplace(std::vector<uint16_t>& a, const uint16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<uint16_t, S>& a, const uint16_t b);
+            void mulInplace(uint16_t* a, const uint16_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<uint16_t>& a, const uint16_t b);
+            void mulInplace(Parallel, uint16_t* a, const uint16_t b, const size_t l);
+            void mulInplace(aligned_vector<uint16_t>& a, const uint16_t b);
+            void mulInplace(Parallel, aligned_vector<uint16_t>& a, const uint16_t b);
         #pragma endregion // uint16_t
 
         #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Mul, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c);
             void mul(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void mul(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
+            void mul(Parallel, const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void mul(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void mul(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void mulInplace(std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b);
+            void mulInplace(uint32_t* a, const uint32_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            void mulInplace(Parallel, uint32_t* a, const uint32_t* b, const size_t l);
+            void mulInplace(aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            void mulInplace(Parallel, aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c);
+            void mul(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void mul(Parallel, const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            void mul(Parallel, const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void mul(const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void mul(Parallel, const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void mulInplace(std::vector<uint32_t>& a, const uint32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<uint32_t, S>& a, const uint32_t b);
+            void mulInplace(uint32_t* a, const uint32_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<uint32_t>& a, const uint32_t b);
+            void mulInplace(Parallel, uint32_t* a, const uint32_t b, const size_t l);
+            void mulInplace(aligned_vector<uint32_t>& a, const uint32_t b);
+            void mulInplace(Parallel, aligned_vector<uint32_t>& a, const uint32_t b);
         #pragma endregion // uint32_t
 
         #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Mul, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c);
             void mul(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void mul(Parallel, const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
+            void mul(Parallel, const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void mul(const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void mul(Parallel, const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void mulInplace(std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b);
+            void mulInplace(uint64_t* a, const uint64_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            void mulInplace(Parallel, uint64_t* a, const uint64_t* b, const size_t l);
+            void mulInplace(aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            void mulInplace(Parallel, aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c);
+            void mul(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void mul(Parallel, const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            void mul(Parallel, const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void mul(const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void mul(Parallel, const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void mulInplace(std::vector<uint64_t>& a, const uint64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<uint64_t, S>& a, const uint64_t b);
+            void mulInplace(uint64_t* a, const uint64_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<uint64_t>& a, const uint64_t b);
+            void mulInplace(Parallel, uint64_t* a, const uint64_t b, const size_t l);
+            void mulInplace(aligned_vector<uint64_t>& a, const uint64_t b);
+            void mulInplace(Parallel, aligned_vector<uint64_t>& a, const uint64_t b);
         #pragma endregion // uint64_t
 
         #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Mul, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c);
             void mul(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void mul(Parallel, const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
+            void mul(Parallel, const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void mul(const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void mul(Parallel, const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void mulInplace(std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b);
+            void mulInplace(__uint128_t* a, const __uint128_t* b, const size_t l);
+            void mulInplace(Parallel, std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            void mulInplace(Parallel, __uint128_t* a, const __uint128_t* b, const size_t l);
+            void mulInplace(aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            void mulInplace(Parallel, aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            template <>
+            struct Kernel<op::MulScalar, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c);
+            void mul(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void mul(Parallel, const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            void mul(Parallel, const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void mul(const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void mul(Parallel, const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void mulInplace(std::vector<__uint128_t>& a, const __uint128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<__uint128_t, S>& a, const __uint128_t b);
+            void mulInplace(__uint128_t* a, const __uint128_t b, const size_t l);
+            void mulInplace(Parallel, std::vector<__uint128_t>& a, const __uint128_t b);
+            void mulInplace(Parallel, __uint128_t* a, const __uint128_t b, const size_t l);
+            void mulInplace(aligned_vector<__uint128_t>& a, const __uint128_t b);
+            void mulInplace(Parallel, aligned_vector<__uint128_t>& a, const __uint128_t b);
         #pragma endregion // __uint128_t
 
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Mul, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<_Float16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<_Float16, S>& c);
+            void mul(const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+            void mul(Parallel, const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<_Float16>& c);
+            void mul(Parallel, const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+            void mul(const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<_Float16>& c);
+            void mul(Parallel, const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<_Float16>& c);
+            void mulInplace(std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<_Float16, S>& a, const std::array<_Float16, S>& b);
+            void mulInplace(_Float16* a, const _Float16* b, const size_t l);
+            void mulInplace(Parallel, std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            void mulInplace(Parallel, _Float16* a, const _Float16* b, const size_t l);
+            void mulInplace(aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+            void mulInplace(Parallel, aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+            template <>
+            struct Kernel<op::MulScalar, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<_Float16>& a, const _Float16 b, std::vector<_Float16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<_Float16, S>& a, const _Float16 b, std::array<_Float16, S>& c);
+            void mul(const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+            void mul(Parallel, const std::vector<_Float16>& a, const _Float16 b, std::vector<_Float16>& c);
+            void mul(Parallel, const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+            void mul(const aligned_vector<_Float16>& a, const _Float16 b, aligned_vector<_Float16>& c);
+            void mul(Parallel, const aligned_vector<_Float16>& a, const _Float16 b, aligned_vector<_Float16>& c);
+            void mulInplace(std::vector<_Float16>& a, const _Float16 b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<_Float16, S>& a, const _Float16 b);
+            void mulInplace(_Float16* a, const _Float16 b, const size_t l);
+            void mulInplace(Parallel, std::vector<_Float16>& a, const _Float16 b);
+            void mulInplace(Parallel, _Float16* a, const _Float16 b, const size_t l);
+            void mulInplace(aligned_vector<_Float16>& a, const _Float16 b);
+            void mulInplace(Parallel, aligned_vector<_Float16>& a, const _Float16 b);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Mul, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<bfloat16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<bfloat16, S>& c);
+            void mul(const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+            void mul(Parallel, const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<bfloat16>& c);
+            void mul(Parallel, const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+            void mul(const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<bfloat16>& c);
+            void mul(Parallel, const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<bfloat16>& c);
+            void mulInplace(std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b);
+            void mulInplace(bfloat16* a, const bfloat16* b, const size_t l);
+            void mulInplace(Parallel, std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            void mulInplace(Parallel, bfloat16* a, const bfloat16* b, const size_t l);
+            void mulInplace(aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+            void mulInplace(Parallel, aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+            template <>
+            struct Kernel<op::MulScalar, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<bfloat16>& a, const bfloat16 b, std::vector<bfloat16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<bfloat16, S>& a, const bfloat16 b, std::array<bfloat16, S>& c);
+            void mul(const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+            void mul(Parallel, const std::vector<bfloat16>& a, const bfloat16 b, std::vector<bfloat16>& c);
+            void mul(Parallel, const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+            void mul(const aligned_vector<bfloat16>& a, const bfloat16 b, aligned_vector<bfloat16>& c);
+            void mul(Parallel, const aligned_vector<bfloat16>& a, const bfloat16 b, aligned_vector<bfloat16>& c);
+            void mulInplace(std::vector<bfloat16>& a, const bfloat16 b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<bfloat16, S>& a, const bfloat16 b);
+            void mulInplace(bfloat16* a, const bfloat16 b, const size_t l);
+            void mulInplace(Parallel, std::vector<bfloat16>& a, const bfloat16 b);
+            void mulInplace(Parallel, bfloat16* a, const bfloat16 b, const size_t l);
+            void mulInplace(aligned_vector<bfloat16>& a, const bfloat16 b);
+            void mulInplace(Parallel, aligned_vector<bfloat16>& a, const bfloat16 b);
+        #pragma endregion // bfloat16
+
         #pragma region // float
+            template <>
+            struct Kernel<op::Mul, float> {
+                using type = void (*)(const float* a, const float* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c);
             void mul(const float* a, const float* b, float* c, const size_t l);
+            void mul(Parallel, const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& c);
+            void mul(Parallel, const float* a, const float* b, float* c, const size_t l);
+            void mul(const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<float>& c);
+            void mul(Parallel, const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<float>& c);
+            void mulInplace(std::vector<float>& a, const std::vector<float>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<float, S>& a, const std::array<float, S>& b);
+            void mulInplace(float* a, const float* b, const size_t l);
+            void mulInplace(Parallel, std::vector<float>& a, const std::vector<float>& b);
+            void mulInplace(Parallel, float* a, const float* b, const size_t l);
+            void mulInplace(aligned_vector<float>& a, const aligned_vector<float>& b);
+            void mulInplace(Parallel, aligned_vector<float>& a, const aligned_vector<float>& b);
+            template <>
+            struct Kernel<op::MulScalar, float> {
+                using type = void (*)(const float* a, const float b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<float>& a, const float b, std::vector<float>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<float, S>& a, const float b, std::array<float, S>& c);
+            void mul(const float* a, const float b, float* c, const size_t l);
+            void mul(Parallel, const std::vector<float>& a, const float b, std::vector<float>& c);
+            void mul(Parallel, const float* a, const float b, float* c, const size_t l);
+            void mul(const aligned_vector<float>& a, const float b, aligned_vector<float>& c);
+            void mul(Parallel, const aligned_vector<float>& a, const float b, aligned_vector<float>& c);
+            void mulInplace(std::vector<float>& a, const float b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<float, S>& a, const float b);
+            void mulInplace(float* a, const float b, const size_t l);
+            void mulInplace(Parallel, std::vector<float>& a, const float b);
+            void mulInplace(Parallel, float* a, const float b, const size_t l);
+            void mulInplace(aligned_vector<float>& a, const float b);
+            void mulInplace(Parallel, aligned_vector<float>& a, const float b);
         #pragma endregion // float
 
         #pragma region // double
+            template <>
+            struct Kernel<op::Mul, double> {
+                using type = void (*)(const double* a, const double* b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c);
             void mul(const double* a, const double* b, double* c, const size_t l);
+            void mul(Parallel, const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c);
+            void mul(Parallel, const double* a, const double* b, double* c, const size_t l);
+            void mul(const aligned_vector<double>& a, const aligned_vector<double>& b, aligned_vector<double>& c);
+            void mul(Parallel, const aligned_vector<double>& a, const aligned_vector<double>& b, aligned_vector<double>& c);
+            void mulInplace(std::vector<double>& a, const std::vector<double>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<double, S>& a, const std::array<double, S>& b);
+            void mulInplace(double* a, const double* b, const size_t l);
+            void mulInplace(Parallel, std::vector<double>& a, const std::vector<double>& b);
+            void mulInplace(Parallel, double* a, const double* b, const size_t l);
+            void mulInplace(aligned_vector<double>& a, const aligned_vector<double>& b);
+            void mulInplace(Parallel, aligned_vector<double>& a, const aligned_vector<double>& b);
+            template <>
+            struct Kernel<op::MulScalar, double> {
+                using type = void (*)(const double* a, const double b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<double>& a, const double b, std::vector<double>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<double, S>& a, const double b, std::array<double, S>& c);
+            void mul(const double* a, const double b, double* c, const size_t l);
+            void mul(Parallel, const std::vector<double>& a, const double b, std::vector<double>& c);
+            void mul(Parallel, const double* a, const double b, double* c, const size_t l);
+            void mul(const aligned_vector<double>& a, const double b, aligned_vector<double>& c);
+            void mul(Parallel, const aligned_vector<double>& a, const double b, aligned_vector<double>& c);
+            void mulInplace(std::vector<double>& a, const double b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<double, S>& a, const double b);
+            void mulInplace(double* a, const double b, const size_t l);
+            void mulInplace(Parallel, std::vector<double>& a, const double b);
+            void mulInplace(Parallel, double* a, const double b, const size_t l);
+            void mulInplace(aligned_vector<double>& a, const double b);
+            void mulInplace(Parallel, aligned_vector<double>& a, const double b);
         #pragma endregion // double
 
         #pragma region // long double
+            template <>
+            struct Kernel<op::Mul, long double> {
+                using type = void (*)(const long double* a, const long double* b, long double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void mul(const std::vector<long double>& a, const std::vector<long double>& b, std::vector<long double>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void mul(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c);
             void mul(const long double* a, const long double* b, long double* c, const size_t l);
+            void mul(Parallel, const std::vector<long double>& a, const std::vector<long double>& b, std::vector<long double>& c);
+            void mul(Parallel, const long double* a, const long double* b, long double* c, const size_t l);
+            void mul(const aligned_vector<long double>& a, const aligned_vector<long double>& b, aligned_vector<long double>& c);
+            void mul(Parallel, const aligned_vector<long double>& a, const aligned_vector<long double>& b, aligned_vector<long double>& c);
+            void mulInplace(std::vector<long double>& a, const std::vector<long double>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<long double, S>& a, const std::array<long double, S>& b);
+            void mulInplace(long double* a, const long double* b, const size_t l);
+            void mulInplace(Parallel, std::vector<long double>& a, const std::vector<long double>& b);
+            void mulInplace(Parallel, long double* a, const long double* b, const size_t l);
+            void mulInplace(aligned_vector<long double>& a, const aligned_vector<long double>& b);
+            void mulInplace(Parallel, aligned_vector<long double>& a, const aligned_vector<long double>& b);
+            template <>
+            struct Kernel<op::MulScalar, long double> {
+                using type = void (*)(const long double* a, const long double b, long double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void mul(const std::vector<long double>& a, const long double b, std::vector<long double>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mul(const std::array<long double, S>& a, const long double b, std::array<long double, S>& c);
+            void mul(const long double* a, const long double b, long double* c, const size_t l);
+            void mul(Parallel, const std::vector<long double>& a, const long double b, std::vector<long double>& c);
+            void mul(Parallel, const long double* a, const long double b, long double* c, const size_t l);
+            void mul(const aligned_vector<long double>& a, const long double b, aligned_vector<long double>& c);
+            void mul(Parallel, const aligned_vector<long double>& a, const long double b, aligned_vector<long double>& c);
+            void mulInplace(std::vector<long double>& a, const long double b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void mulInplace(std::array<long double, S>& a, const long double b);
+            void mulInplace(long double* a, const long double b, const size_t l);
+            void mulInplace(Parallel, std::vector<long double>& a, const long double b);
+            void mulInplace(Parallel, long double* a, const long double b, const size_t l);
+            void mulInplace(aligned_vector<long double>& a, const long double b);
+            void mulInplace(Parallel, aligned_vector<long double>& a, const long double b);
         #pragma endregion // long double
         
         #define MUL(a, b, c) mul(a, b, c, ezsimd::arrayLength(a))
+        #define MUL_INPLACE(a, b) mulInplace(a, b, ezsimd::arrayLength(a))
     #pragma endregion // mul
     
     #pragma region // div
         #pragma region // int8_t
+            template <>
+            struct Kernel<op::Div, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c);
             void div(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void div(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int8_t>& c);
+            void div(Parallel, const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+            void div(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void div(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int8_t>& c);
+            void divInplace(std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b);
+            void divInplace(int8_t* a, const int8_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            void divInplace(Parallel, int8_t* a, const int8_t* b, const size_t l);
+            void divInplace(aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            void divInplace(Parallel, aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c);
+            void div(const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void div(Parallel, const std::vector<int8_t>& a, const int8_t b, std::vector<int8_t>& c);
+            void div(Parallel, const int8_t* a, const int8_t b, int8_t* c, const size_t l);
+            void div(const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void div(Parallel, const aligned_vector<int8_t>& a, const int8_t b, aligned_vector<int8_t>& c);
+            void divInplace(std::vector<int8_t>& a, const int8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<int8_t, S>& a, const int8_t b);
+            void divInplace(int8_t* a, const int8_t b, const size_t l);
+            void divInplace(Parallel, std::vector<int8_t>& a, const int8_t b);
+            void divInplace(Parallel, int8_t* a, const int8_t b, const size_t l);
+            void divInplace(aligned_vector<int8_t>& a, const int8_t b);
+            void divInplace(Parallel, aligned_vector<int8_t>& a, const int8_t b);
         #pragma endregion // int8_t
 
         #pragma region // int16_t
+            template <>
+            struct Kernel<op::Div, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c);
             void div(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void div(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int16_t>& c);
+            void div(Parallel, const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+            void div(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void div(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int16_t>& c);
+            void divInplace(std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b);
+            void divInplace(int16_t* a, const int16_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            void divInplace(Parallel, int16_t* a, const int16_t* b, const size_t l);
+            void divInplace(aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            void divInplace(Parallel, aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c);
+            void div(const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void div(Parallel, const std::vector<int16_t>& a, const int16_t b, std::vector<int16_t>& c);
+            void div(Parallel, const int16_t* a, const int16_t b, int16_t* c, const size_t l);
+            void div(const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void div(Parallel, const aligned_vector<int16_t>& a, const int16_t b, aligned_vector<int16_t>& c);
+            void divInplace(std::vector<int16_t>& a, const int16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<int16_t, S>& a, const int16_t b);
+            void divInplace(int16_t* a, const int16_t b, const size_t l);
+            void divInplace(Parallel, std::vector<int16_t>& a, const int16_t b);
+            void divInplace(Parallel, int16_t* a, const int16_t b, const size_t l);
+            void divInplace(aligned_vector<int16_t>& a, const int16_t b);
+            void divInplace(Parallel, aligned_vector<int16_t>& a, const int16_t b);
         #pragma endregion // int16_t
 
         #pragma region // int32_t
+            template <>
+            struct Kernel<op::Div, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c);
             void div(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void div(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int32_t>& c);
+            void div(Parallel, const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+            void div(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void div(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int32_t>& c);
+            void divInplace(std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b);
+            void divInplace(int32_t* a, const int32_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            void divInplace(Parallel, int32_t* a, const int32_t* b, const size_t l);
+            void divInplace(aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            void divInplace(Parallel, aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c);
+            void div(const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void div(Parallel, const std::vector<int32_t>& a, const int32_t b, std::vector<int32_t>& c);
+            void div(Parallel, const int32_t* a, const int32_t b, int32_t* c, const size_t l);
+            void div(const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void div(Parallel, const aligned_vector<int32_t>& a, const int32_t b, aligned_vector<int32_t>& c);
+            void divInplace(std::vector<int32_t>& a, const int32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<int32_t, S>& a, const int32_t b);
+            void divInplace(int32_t* a, const int32_t b, const size_t l);
+            void divInplace(Parallel, std::vector<int32_t>& a, const int32_t b);
+            void divInplace(Parallel, int32_t* a, const int32_t b, const size_t l);
+            void divInplace(aligned_vector<int32_t>& a, const int32_t b);
+            void divInplace(Parallel, aligned_vector<int32_t>& a, const int32_t b);
         #pragma endregion // int32_t
 
         #pragma region // int64_t
+            template <>
+            struct Kernel<op::Div, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c);
             void div(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void div(Parallel, const std::vector<int64_t>& a, const std::vector<int64_t>& b, std::vector<int64_t>& c);
+            void div(Parallel, const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+            void div(const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void div(Parallel, const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, aligned_vector<int64_t>& c);
+            void divInplace(std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b);
+            void divInplace(int64_t* a, const int64_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            void divInplace(Parallel, int64_t* a, const int64_t* b, const size_t l);
+            void divInplace(aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            void divInplace(Parallel, aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c);
+            void div(const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void div(Parallel, const std::vector<int64_t>& a, const int64_t b, std::vector<int64_t>& c);
+            void div(Parallel, const int64_t* a, const int64_t b, int64_t* c, const size_t l);
+            void div(const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void div(Parallel, const aligned_vector<int64_t>& a, const int64_t b, aligned_vector<int64_t>& c);
+            void divInplace(std::vector<int64_t>& a, const int64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<int64_t, S>& a, const int64_t b);
+            void divInplace(int64_t* a, const int64_t b, const size_t l);
+            void divInplace(Parallel, std::vector<int64_t>& a, const int64_t b);
+            void divInplace(Parallel, int64_t* a, const int64_t b, const size_t l);
+            void divInplace(aligned_vector<int64_t>& a, const int64_t b);
+            void divInplace(Parallel, aligned_vector<int64_t>& a, const int64_t b);
         #pragma endregion // int64_t
 
         #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Div, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c);
             void div(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void div(Parallel, const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, std::vector<__int128_t>& c);
+            void div(Parallel, const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            void div(const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void div(Parallel, const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, aligned_vector<__int128_t>& c);
+            void divInplace(std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b);
+            void divInplace(__int128_t* a, const __int128_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            void divInplace(Parallel, __int128_t* a, const __int128_t* b, const size_t l);
+            void divInplace(aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            void divInplace(Parallel, aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c);
+            void div(const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void div(Parallel, const std::vector<__int128_t>& a, const __int128_t b, std::vector<__int128_t>& c);
+            void div(Parallel, const __int128_t* a, const __int128_t b, __int128_t* c, const size_t l);
+            void div(const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void div(Parallel, const aligned_vector<__int128_t>& a, const __int128_t b, aligned_vector<__int128_t>& c);
+            void divInplace(std::vector<__int128_t>& a, const __int128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<__int128_t, S>& a, const __int128_t b);
+            void divInplace(__int128_t* a, const __int128_t b, const size_t l);
+            void divInplace(Parallel, std::vector<__int128_t>& a, const __int128_t b);
+            void divInplace(Parallel, __int128_t* a, const __int128_t b, const size_t l);
+            void divInplace(aligned_vector<__int128_t>& a, const __int128_t b);
+            void divInplace(Parallel, aligned_vector<__int128_t>& a, const __int128_t b);
         #pragma endregion // __int128_t
 
         #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Div, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c);
             void div(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void div(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint8_t>& c);
+            void div(Parallel, const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+            void div(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void div(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint8_t>& c);
+            void divInplace(std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b);
+            void divInplace(uint8_t* a, const uint8_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            void divInplace(Parallel, uint8_t* a, const uint8_t* b, const size_t l);
+            void divInplace(aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            void divInplace(Parallel, aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c);
+            void div(const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void div(Parallel, const std::vector<uint8_t>& a, const uint8_t b, std::vector<uint8_t>& c);
+            void div(Parallel, const uint8_t* a, const uint8_t b, uint8_t* c, const size_t l);
+            void div(const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void div(Parallel, const aligned_vector<uint8_t>& a, const uint8_t b, aligned_vector<uint8_t>& c);
+            void divInplace(std::vector<uint8_t>& a, const uint8_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<uint8_t, S>& a, const uint8_t b);
+            void divInplace(uint8_t* a, const uint8_t b, const size_t l);
+            void divInplace(Parallel, std::vector<uint8_t>& a, const uint8_t b);
+            void divInplace(Parallel, uint8_t* a, const uint8_t b, const size_t l);
+            void divInplace(aligned_vector<uint8_t>& a, const uint8_t b);
+            void divInplace(Parallel, aligned_vector<uint8_t>& a, const uint8_t b);
         #pragma endregion // uint8_t
 
         #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Div, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c);
             void div(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void div(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint16_t>& c);
+            void div(Parallel, const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+            void div(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void div(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint16_t>& c);
+            void divInplace(std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b);
+            void divInplace(uint16_t* a, const uint16_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            void divInplace(Parallel, uint16_t* a, const uint16_t* b, const size_t l);
+            void divInplace(aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            void divInplace(Parallel, aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c);
+            void div(const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void div(Parallel, const std::vector<uint16_t>& a, const uint16_t b, std::vector<uint16_t>& c);
+            void div(Parallel, const uint16_t* a, const uint16_t b, uint16_t* c, const size_t l);
+            void div(const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void div(Parallel, const aligned_vector<uint16_t>& a, const uint16_t b, aligned_vector<uint16_t>& c);
+            void divInplace(std::vector<uint16_t>& a, const uint16_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<uint16_t, S>& a, const uint16_t b);
+            void divInplace(uint16_t* a, const uint16_t b, const size_t l);
+            void divInplace(Parallel, std::vector<uint16_t>& a, const uint16_t b);
+            void divInplace(Parallel, uint16_t* a, const uint16_t b, const size_t l);
+            void divInplace(aligned_vector<uint16_t>& a, const uint16_t b);
+            void divInplace(Parallel, aligned_vector<uint16_t>& a, const uint16_t b);
         #pragma endregion // uint16_t
 
         #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Div, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c);
             void div(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void div(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint32_t>& c);
+            void div(Parallel, const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+            void div(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void div(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint32_t>& c);
+            void divInplace(std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b);
+            void divInplace(uint32_t* a, const uint32_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            void divInplace(Parallel, uint32_t* a, const uint32_t* b, const size_t l);
+            void divInplace(aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            void divInplace(Parallel, aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c);
+            void div(const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void div(Parallel, const std::vector<uint32_t>& a, const uint32_t b, std::vector<uint32_t>& c);
+            void div(Parallel, const uint32_t* a, const uint32_t b, uint32_t* c, const size_t l);
+            void div(const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void div(Parallel, const aligned_vector<uint32_t>& a, const uint32_t b, aligned_vector<uint32_t>& c);
+            void divInplace(std::vector<uint32_t>& a, const uint32_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<uint32_t, S>& a, const uint32_t b);
+            void divInplace(uint32_t* a, const uint32_t b, const size_t l);
+            void divInplace(Parallel, std::vector<uint32_t>& a, const uint32_t b);
+            void divInplace(Parallel, uint32_t* a, const uint32_t b, const size_t l);
+            void divInplace(aligned_vector<uint32_t>& a, const uint32_t b);
+            void divInplace(Parallel, aligned_vector<uint32_t>& a, const uint32_t b);
         #pragma endregion // uint32_t
 
         #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Div, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c);
             void div(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void div(Parallel, const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, std::vector<uint64_t>& c);
+            void div(Parallel, const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+            void div(const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void div(Parallel, const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, aligned_vector<uint64_t>& c);
+            void divInplace(std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b);
+            void divInplace(uint64_t* a, const uint64_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            void divInplace(Parallel, uint64_t* a, const uint64_t* b, const size_t l);
+            void divInplace(aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            void divInplace(Parallel, aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c);
+            void div(const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void div(Parallel, const std::vector<uint64_t>& a, const uint64_t b, std::vector<uint64_t>& c);
+            void div(Parallel, const uint64_t* a, const uint64_t b, uint64_t* c, const size_t l);
+            void div(const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void div(Parallel, const aligned_vector<uint64_t>& a, const uint64_t b, aligned_vector<uint64_t>& c);
+            void divInplace(std::vector<uint64_t>& a, const uint64_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<uint64_t, S>& a, const uint64_t b);
+            void divInplace(uint64_t* a, const uint64_t b, const size_t l);
+            void divInplace(Parallel, std::vector<uint64_t>& a, const uint64_t b);
+            void divInplace(Parallel, uint64_t* a, const uint64_t b, const size_t l);
+            void divInplace(aligned_vector<uint64_t>& a, const uint64_t b);
+            void divInplace(Parallel, aligned_vector<uint64_t>& a, const uint64_t b);
         #pragma endregion // uint64_t
 
         #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Div, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c);
             void div(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void div(Parallel, const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, std::vector<__uint128_t>& c);
+            void div(Parallel, const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            void div(const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void div(Parallel, const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, aligned_vector<__uint128_t>& c);
+            void divInplace(std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b);
+            void divInplace(__uint128_t* a, const __uint128_t* b, const size_t l);
+            void divInplace(Parallel, std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            void divInplace(Parallel, __uint128_t* a, const __uint128_t* b, const size_t l);
+            void divInplace(aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            void divInplace(Parallel, aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            template <>
+            struct Kernel<op::DivScalar, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c);
+            void div(const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void div(Parallel, const std::vector<__uint128_t>& a, const __uint128_t b, std::vector<__uint128_t>& c);
+            void div(Parallel, const __uint128_t* a, const __uint128_t b, __uint128_t* c, const size_t l);
+            void div(const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void div(Parallel, const aligned_vector<__uint128_t>& a, const __uint128_t b, aligned_vector<__uint128_t>& c);
+            void divInplace(std::vector<__uint128_t>& a, const __uint128_t b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<__uint128_t, S>& a, const __uint128_t b);
+            void divInplace(__uint128_t* a, const __uint128_t b, const size_t l);
+            void divInplace(Parallel, std::vector<__uint128_t>& a, const __uint128_t b);
+            void divInplace(Parallel, __uint128_t* a, const __uint128_t b, const size_t l);
+            void divInplace(aligned_vector<__uint128_t>& a, const __uint128_t b);
+            void divInplace(Parallel, aligned_vector<__uint128_t>& a, const __uint128_t b);
         #pragma endregion // __uint128_t
 
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Div, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<_Float16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<_Float16, S>& c);
+            void div(const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+            void div(Parallel, const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<_Float16>& c);
+            void div(Parallel, const _Float16* a, const _Float16* b, _Float16* c, const size_t l);
+            void div(const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<_Float16>& c);
+            void div(Parallel, const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<_Float16>& c);
+            void divInplace(std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<_Float16, S>& a, const std::array<_Float16, S>& b);
+            void divInplace(_Float16* a, const _Float16* b, const size_t l);
+            void divInplace(Parallel, std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            void divInplace(Parallel, _Float16* a, const _Float16* b, const size_t l);
+            void divInplace(aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+            void divInplace(Parallel, aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+            template <>
+            struct Kernel<op::DivScalar, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<_Float16>& a, const _Float16 b, std::vector<_Float16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<_Float16, S>& a, const _Float16 b, std::array<_Float16, S>& c);
+            void div(const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+            void div(Parallel, const std::vector<_Float16>& a, const _Float16 b, std::vector<_Float16>& c);
+            void div(Parallel, const _Float16* a, const _Float16 b, _Float16* c, const size_t l);
+            void div(const aligned_vector<_Float16>& a, const _Float16 b, aligned_vector<_Float16>& c);
+            void div(Parallel, const aligned_vector<_Float16>& a, const _Float16 b, aligned_vector<_Float16>& c);
+            void divInplace(std::vector<_Float16>& a, const _Float16 b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<_Float16, S>& a, const _Float16 b);
+            void divInplace(_Float16* a, const _Float16 b, const size_t l);
+            void divInplace(Parallel, std::vector<_Float16>& a, const _Float16 b);
+            void divInplace(Parallel, _Float16* a, const _Float16 b, const size_t l);
+            void divInplace(aligned_vector<_Float16>& a, const _Float16 b);
+            void divInplace(Parallel, aligned_vector<_Float16>& a, const _Float16 b);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Div, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<bfloat16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<bfloat16, S>& c);
+            void div(const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+            void div(Parallel, const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<bfloat16>& c);
+            void div(Parallel, const bfloat16* a, const bfloat16* b, bfloat16* c, const size_t l);
+            void div(const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<bfloat16>& c);
+            void div(Parallel, const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<bfloat16>& c);
+            void divInplace(std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b);
+            void divInplace(bfloat16* a, const bfloat16* b, const size_t l);
+            void divInplace(Parallel, std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            void divInplace(Parallel, bfloat16* a, const bfloat16* b, const size_t l);
+            void divInplace(aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+            void divInplace(Parallel, aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+            template <>
+            struct Kernel<op::DivScalar, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<bfloat16>& a, const bfloat16 b, std::vector<bfloat16>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<bfloat16, S>& a, const bfloat16 b, std::array<bfloat16, S>& c);
+            void div(const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+            void div(Parallel, const std::vector<bfloat16>& a, const bfloat16 b, std::vector<bfloat16>& c);
+            void div(Parallel, const bfloat16* a, const bfloat16 b, bfloat16* c, const size_t l);
+            void div(const aligned_vector<bfloat16>& a, const bfloat16 b, aligned_vector<bfloat16>& c);
+            void div(Parallel, const aligned_vector<bfloat16>& a, const bfloat16 b, aligned_vector<bfloat16>& c);
+            void divInplace(std::vector<bfloat16>& a, const bfloat16 b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<bfloat16, S>& a, const bfloat16 b);
+            void divInplace(bfloat16* a, const bfloat16 b, const size_t l);
+            void divInplace(Parallel, std::vector<bfloat16>& a, const bfloat16 b);
+            void divInplace(Parallel, bfloat16* a, const bfloat16 b, const size_t l);
+            void divInplace(aligned_vector<bfloat16>& a, const bfloat16 b);
+            void divInplace(Parallel, aligned_vector<bfloat16>& a, const bfloat16 b);
+        #pragma endregion // bfloat16
+
         #pragma region // float
+            template <>
+            struct Kernel<op::Div, float> {
+                using type = void (*)(const float* a, const float* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c);
             void div(const float* a, const float* b, float* c, const size_t l);
+            void div(Parallel, const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& c);
+            void div(Parallel, const float* a, const float* b, float* c, const size_t l);
+            void div(const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<float>& c);
+            void div(Parallel, const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<float>& c);
+            void divInplace(std::vector<float>& a, const std::vector<float>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<float, S>& a, const std::array<float, S>& b);
+            void divInplace(float* a, const float* b, const size_t l);
+            void divInplace(Parallel, std::vector<float>& a, const std::vector<float>& b);
+            void divInplace(Parallel, float* a, const float* b, const size_t l);
+            void divInplace(aligned_vector<float>& a, const aligned_vector<float>& b);
+            void divInplace(Parallel, aligned_vector<float>& a, const aligned_vector<float>& b);
+            template <>
+            struct Kernel<op::DivScalar, float> {
+                using type = void (*)(const float* a, const float b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<float>& a, const float b, std::vector<float>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<float, S>& a, const float b, std::array<float, S>& c);
+            void div(const float* a, const float b, float* c, const size_t l);
+            void div(Parallel, const std::vector<float>& a, const float b, std::vector<float>& c);
+            void div(Parallel, const float* a, const float b, float* c, const size_t l);
+            void div(const aligned_vector<float>& a, const float b, aligned_vector<float>& c);
+            void div(Parallel, const aligned_vector<float>& a, const float b, aligned_vector<float>& c);
+            void divInplace(std::vector<float>& a, const float b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<float, S>& a, const float b);
+            void divInplace(float* a, const float b, const size_t l);
+            void divInplace(Parallel, std::vector<float>& a, const float b);
+            void divInplace(Parallel, float* a, const float b, const size_t l);
+            void divInplace(aligned_vector<float>& a, const float b);
+            void divInplace(Parallel, aligned_vector<float>& a, const float b);
         #pragma endregion // float
 
         #pragma region // double
+            template <>
+            struct Kernel<op::Div, double> {
+                using type = void (*)(const double* a, const double* b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c);
             void div(const double* a, const double* b, double* c, const size_t l);
+            void div(Parallel, const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c);
+            void div(Parallel, const double* a, const double* b, double* c, const size_t l);
+            void div(const aligned_vector<double>& a, const aligned_vector<double>& b, aligned_vector<double>& c);
+            void div(Parallel, const aligned_vector<double>& a, const aligned_vector<double>& b, aligned_vector<double>& c);
+            void divInplace(std::vector<double>& a, const std::vector<double>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<double, S>& a, const std::array<double, S>& b);
+            void divInplace(double* a, const double* b, const size_t l);
+            void divInplace(Parallel, std::vector<double>& a, const std::vector<double>& b);
+            void divInplace(Parallel, double* a, const double* b, const size_t l);
+            void divInplace(aligned_vector<double>& a, const aligned_vector<double>& b);
+            void divInplace(Parallel, aligned_vector<double>& a, const aligned_vector<double>& b);
+            template <>
+            struct Kernel<op::DivScalar, double> {
+                using type = void (*)(const double* a, const double b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<double>& a, const double b, std::vector<double>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<double, S>& a, const double b, std::array<double, S>& c);
+            void div(const double* a, const double b, double* c, const size_t l);
+            void div(Parallel, const std::vector<double>& a, const double b, std::vector<double>& c);
+            void div(Parallel, const double* a, const double b, double* c, const size_t l);
+            void div(const aligned_vector<double>& a, const double b, aligned_vector<double>& c);
+            void div(Parallel, const aligned_vector<double>& a, const double b, aligned_vector<double>& c);
+            void divInplace(std::vector<double>& a, const double b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<double, S>& a, const double b);
+            void divInplace(double* a, const double b, const size_t l);
+            void divInplace(Parallel, std::vector<double>& a, const double b);
+            void divInplace(Parallel, double* a, const double b, const size_t l);
+            void divInplace(aligned_vector<double>& a, const double b);
+            void divInplace(Parallel, aligned_vector<double>& a, const double b);
         #pragma endregion // double
 
         #pragma region // long double
+            template <>
+            struct Kernel<op::Div, long double> {
+                using type = void (*)(const long double* a, const long double* b, long double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
             void div(const std::vector<long double>& a, const std::vector<long double>& b, std::vector<long double>& c);
-            template <size_t S>
+            template <size_t S, typename Isa = isa::Dispatch>
             void div(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c);
             void div(const long double* a, const long double* b, long double* c, const size_t l);
+            void div(Parallel, const std::vector<long double>& a, const std::vector<long double>& b, std::vector<long double>& c);
+            void div(Parallel, const long double* a, const long double* b, long double* c, const size_t l);
+            void div(const aligned_vector<long double>& a, const aligned_vector<long double>& b, aligned_vector<long double>& c);
+            void div(Parallel, const aligned_vector<long double>& a, const aligned_vector<long double>& b, aligned_vector<long double>& c);
+            void divInplace(std::vector<long double>& a, const std::vector<long double>& b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<long double, S>& a, const std::array<long double, S>& b);
+            void divInplace(long double* a, const long double* b, const size_t l);
+            void divInplace(Parallel, std::vector<long double>& a, const std::vector<long double>& b);
+            void divInplace(Parallel, long double* a, const long double* b, const size_t l);
+            void divInplace(aligned_vector<long double>& a, const aligned_vector<long double>& b);
+            void divInplace(Parallel, aligned_vector<long double>& a, const aligned_vector<long double>& b);
+            template <>
+            struct Kernel<op::DivScalar, long double> {
+                using type = void (*)(const long double* a, const long double b, long double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void div(const std::vector<long double>& a, const long double b, std::vector<long double>& c);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void div(const std::array<long double, S>& a, const long double b, std::array<long double, S>& c);
+            void div(const long double* a, const long double b, long double* c, const size_t l);
+            void div(Parallel, const std::vector<long double>& a, const long double b, std::vector<long double>& c);
+            void div(Parallel, const long double* a, const long double b, long double* c, const size_t l);
+            void div(const aligned_vector<long double>& a, const long double b, aligned_vector<long double>& c);
+            void div(Parallel, const aligned_vector<long double>& a, const long double b, aligned_vector<long double>& c);
+            void divInplace(std::vector<long double>& a, const long double b);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void divInplace(std::array<long double, S>& a, const long double b);
+            void divInplace(long double* a, const long double b, const size_t l);
+            void divInplace(Parallel, std::vector<long double>& a, const long double b);
+            void divInplace(Parallel, long double* a, const long double b, const size_t l);
+            void divInplace(aligned_vector<long double>& a, const long double b);
+            void divInplace(Parallel, aligned_vector<long double>& a, const long double b);
         #pragma endregion // long double
         
         #define DIV(a, b, c) div(a, b, c, ezsimd::arrayLength(a))
+        #define DIV_INPLACE(a, b) divInplace(a, b, ezsimd::arrayLength(a))
     #pragma endregion // div
+    
+    #pragma region // fma
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::Fma, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, const int8_t* c, int8_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<int8_t>& a, const std::vector<int8_t>& b, const std::vector<int8_t>& c, std::vector<int8_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, const std::array<int8_t, S>& c, std::array<int8_t, S>& d);
+            void fma(const int8_t* a, const int8_t* b, const int8_t* c, int8_t* d, const size_t l);
+            void fma(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, const std::vector<int8_t>& c, std::vector<int8_t>& d);
+            void fma(Parallel, const int8_t* a, const int8_t* b, const int8_t* c, int8_t* d, const size_t l);
+            void fma(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, const aligned_vector<int8_t>& c, aligned_vector<int8_t>& d);
+            void fma(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, const aligned_vector<int8_t>& c, aligned_vector<int8_t>& d);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::Fma, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, const int16_t* c, int16_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<int16_t>& a, const std::vector<int16_t>& b, const std::vector<int16_t>& c, std::vector<int16_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, const std::array<int16_t, S>& c, std::array<int16_t, S>& d);
+            void fma(const int16_t* a, const int16_t* b, const int16_t* c, int16_t* d, const size_t l);
+            void fma(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, const std::vector<int16_t>& c, std::vector<int16_t>& d);
+            void fma(Parallel, const int16_t* a, const int16_t* b, const int16_t* c, int16_t* d, const size_t l);
+            void fma(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, const aligned_vector<int16_t>& c, aligned_vector<int16_t>& d);
+            void fma(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, const aligned_vector<int16_t>& c, aligned_vector<int16_t>& d);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::Fma, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, const int32_t* c, int32_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<int32_t>& a, const std::vector<int32_t>& b, const std::vector<int32_t>& c, std::vector<int32_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, const std::array<int32_t, S>& c, std::array<int32_t, S>& d);
+            void fma(const int32_t* a, const int32_t* b, const int32_t* c, int32_t* d, const size_t l);
+            void fma(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, const std::vector<int32_t>& c, std::vector<int32_t>& d);
+            void fma(Parallel, const int32_t* a, const int32_t* b, const int32_t* c, int32_t* d, const size_t l);
+            void fma(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, const aligned_vector<int32_t>& c, aligned_vector<int32_t>& d);
+            void fma(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, const aligned_vector<int32_t>& c, aligned_vector<int32_t>& d);
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Kernel<op::Fma, int64_t> {
+                using type = void (*)(const int64_t* a, const int64_t* b, const int64_t* c, int64_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<int64_t>& a, const std::vector<int64_t>& b, const std::vector<int64_t>& c, std::vector<int64_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, const std::array<int64_t, S>& c, std::array<int64_t, S>& d);
+            void fma(const int64_t* a, const int64_t* b, const int64_t* c, int64_t* d, const size_t l);
+            void fma(Parallel, const std::vector<int64_t>& a, const std::vector<int64_t>& b, const std::vector<int64_t>& c, std::vector<int64_t>& d);
+            void fma(Parallel, const int64_t* a, const int64_t* b, const int64_t* c, int64_t* d, const size_t l);
+            void fma(const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, const aligned_vector<int64_t>& c, aligned_vector<int64_t>& d);
+            void fma(Parallel, const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b, const aligned_vector<int64_t>& c, aligned_vector<int64_t>& d);
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Fma, __int128_t> {
+                using type = void (*)(const __int128_t* a, const __int128_t* b, const __int128_t* c, __int128_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, const std::vector<__int128_t>& c, std::vector<__int128_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, const std::array<__int128_t, S>& c, std::array<__int128_t, S>& d);
+            void fma(const __int128_t* a, const __int128_t* b, const __int128_t* c, __int128_t* d, const size_t l);
+            void fma(Parallel, const std::vector<__int128_t>& a, const std::vector<__int128_t>& b, const std::vector<__int128_t>& c, std::vector<__int128_t>& d);
+            void fma(Parallel, const __int128_t* a, const __int128_t* b, const __int128_t* c, __int128_t* d, const size_t l);
+            void fma(const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, const aligned_vector<__int128_t>& c, aligned_vector<__int128_t>& d);
+            void fma(Parallel, const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b, const aligned_vector<__int128_t>& c, aligned_vector<__int128_t>& d);
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Fma, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, const uint8_t* c, uint8_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, const std::vector<uint8_t>& c, std::vector<uint8_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, const std::array<uint8_t, S>& c, std::array<uint8_t, S>& d);
+            void fma(const uint8_t* a, const uint8_t* b, const uint8_t* c, uint8_t* d, const size_t l);
+            void fma(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, const std::vector<uint8_t>& c, std::vector<uint8_t>& d);
+            void fma(Parallel, const uint8_t* a, const uint8_t* b, const uint8_t* c, uint8_t* d, const size_t l);
+            void fma(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, const aligned_vector<uint8_t>& c, aligned_vector<uint8_t>& d);
+            void fma(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, const aligned_vector<uint8_t>& c, aligned_vector<uint8_t>& d);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Fma, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, const uint16_t* c, uint16_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, const std::vector<uint16_t>& c, std::vector<uint16_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, const std::array<uint16_t, S>& c, std::array<uint16_t, S>& d);
+            void fma(const uint16_t* a, const uint16_t* b, const uint16_t* c, uint16_t* d, const size_t l);
+            void fma(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, const std::vector<uint16_t>& c, std::vector<uint16_t>& d);
+            void fma(Parallel, const uint16_t* a, const uint16_t* b, const uint16_t* c, uint16_t* d, const size_t l);
+            void fma(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, const aligned_vector<uint16_t>& c, aligned_vector<uint16_t>& d);
+            void fma(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, const aligned_vector<uint16_t>& c, aligned_vector<uint16_t>& d);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Fma, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, const uint32_t* c, uint32_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, const std::vector<uint32_t>& c, std::vector<uint32_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, const std::array<uint32_t, S>& c, std::array<uint32_t, S>& d);
+            void fma(const uint32_t* a, const uint32_t* b, const uint32_t* c, uint32_t* d, const size_t l);
+            void fma(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, const std::vector<uint32_t>& c, std::vector<uint32_t>& d);
+            void fma(Parallel, const uint32_t* a, const uint32_t* b, const uint32_t* c, uint32_t* d, const size_t l);
+            void fma(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, const aligned_vector<uint32_t>& c, aligned_vector<uint32_t>& d);
+            void fma(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, const aligned_vector<uint32_t>& c, aligned_vector<uint32_t>& d);
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Fma, uint64_t> {
+                using type = void (*)(const uint64_t* a, const uint64_t* b, const uint64_t* c, uint64_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, const std::vector<uint64_t>& c, std::vector<uint64_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, const std::array<uint64_t, S>& c, std::array<uint64_t, S>& d);
+            void fma(const uint64_t* a, const uint64_t* b, const uint64_t* c, uint64_t* d, const size_t l);
+            void fma(Parallel, const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, const std::vector<uint64_t>& c, std::vector<uint64_t>& d);
+            void fma(Parallel, const uint64_t* a, const uint64_t* b, const uint64_t* c, uint64_t* d, const size_t l);
+            void fma(const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, const aligned_vector<uint64_t>& c, aligned_vector<uint64_t>& d);
+            void fma(Parallel, const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b, const aligned_vector<uint64_t>& c, aligned_vector<uint64_t>& d);
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Fma, __uint128_t> {
+                using type = void (*)(const __uint128_t* a, const __uint128_t* b, const __uint128_t* c, __uint128_t* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, const std::vector<__uint128_t>& c, std::vector<__uint128_t>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, const std::array<__uint128_t, S>& c, std::array<__uint128_t, S>& d);
+            void fma(const __uint128_t* a, const __uint128_t* b, const __uint128_t* c, __uint128_t* d, const size_t l);
+            void fma(Parallel, const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b, const std::vector<__uint128_t>& c, std::vector<__uint128_t>& d);
+            void fma(Parallel, const __uint128_t* a, const __uint128_t* b, const __uint128_t* c, __uint128_t* d, const size_t l);
+            void fma(const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, const aligned_vector<__uint128_t>& c, aligned_vector<__uint128_t>& d);
+            void fma(Parallel, const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b, const aligned_vector<__uint128_t>& c, aligned_vector<__uint128_t>& d);
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Fma, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16* b, const _Float16* c, _Float16* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<_Float16>& a, const std::vector<_Float16>& b, const std::vector<_Float16>& c, std::vector<_Float16>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, const std::array<_Float16, S>& c, std::array<_Float16, S>& d);
+            void fma(const _Float16* a, const _Float16* b, const _Float16* c, _Float16* d, const size_t l);
+            void fma(Parallel, const std::vector<_Float16>& a, const std::vector<_Float16>& b, const std::vector<_Float16>& c, std::vector<_Float16>& d);
+            void fma(Parallel, const _Float16* a, const _Float16* b, const _Float16* c, _Float16* d, const size_t l);
+            void fma(const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, const aligned_vector<_Float16>& c, aligned_vector<_Float16>& d);
+            void fma(Parallel, const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, const aligned_vector<_Float16>& c, aligned_vector<_Float16>& d);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Fma, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16* b, const bfloat16* c, bfloat16* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, const std::vector<bfloat16>& c, std::vector<bfloat16>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, const std::array<bfloat16, S>& c, std::array<bfloat16, S>& d);
+            void fma(const bfloat16* a, const bfloat16* b, const bfloat16* c, bfloat16* d, const size_t l);
+            void fma(Parallel, const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, const std::vector<bfloat16>& c, std::vector<bfloat16>& d);
+            void fma(Parallel, const bfloat16* a, const bfloat16* b, const bfloat16* c, bfloat16* d, const size_t l);
+            void fma(const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, const aligned_vector<bfloat16>& c, aligned_vector<bfloat16>& d);
+            void fma(Parallel, const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, const aligned_vector<bfloat16>& c, aligned_vector<bfloat16>& d);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::Fma, float> {
+                using type = void (*)(const float* a, const float* b, const float* c, float* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<float>& a, const std::vector<float>& b, const std::vector<float>& c, std::vector<float>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<float, S>& a, const std::array<float, S>& b, const std::array<float, S>& c, std::array<float, S>& d);
+            void fma(const float* a, const float* b, const float* c, float* d, const size_t l);
+            void fma(Parallel, const std::vector<float>& a, const std::vector<float>& b, const std::vector<float>& c, std::vector<float>& d);
+            void fma(Parallel, const float* a, const float* b, const float* c, float* d, const size_t l);
+            void fma(const aligned_vector<float>& a, const aligned_vector<float>& b, const aligned_vector<float>& c, aligned_vector<float>& d);
+            void fma(Parallel, const aligned_vector<float>& a, const aligned_vector<float>& b, const aligned_vector<float>& c, aligned_vector<float>& d);
+        #pragma endregion // float
+
+        #pragma region // double
+            template <>
+            struct Kernel<op::Fma, double> {
+                using type = void (*)(const double* a, const double* b, const double* c, double* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<double>& a, const std::vector<double>& b, const std::vector<double>& c, std::vector<double>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<double, S>& a, const std::array<double, S>& b, const std::array<double, S>& c, std::array<double, S>& d);
+            void fma(const double* a, const double* b, const double* c, double* d, const size_t l);
+            void fma(Parallel, const std::vector<double>& a, const std::vector<double>& b, const std::vector<double>& c, std::vector<double>& d);
+            void fma(Parallel, const double* a, const double* b, const double* c, double* d, const size_t l);
+            void fma(const aligned_vector<double>& a, const aligned_vector<double>& b, const aligned_vector<double>& c, aligned_vector<double>& d);
+            void fma(Parallel, const aligned_vector<double>& a, const aligned_vector<double>& b, const aligned_vector<double>& c, aligned_vector<double>& d);
+        #pragma endregion // double
+
+        #pragma region // long double
+            template <>
+            struct Kernel<op::Fma, long double> {
+                using type = void (*)(const long double* a, const long double* b, const long double* c, long double* d, const size_t l);
+                static type get();
+                static type get(Tier tier);
+                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding
+                static type getAligned();
+            };
+            void fma(const std::vector<long double>& a, const std::vector<long double>& b, const std::vector<long double>& c, std::vector<long double>& d);
+            template <size_t S, typename Isa = isa::Dispatch>
+            void fma(const std::array<long double, S>& a, const std::array<long double, S>& b, const std::array<long double, S>& c, std::array<long double, S>& d);
+            void fma(const long double* a, const long double* b, const long double* c, long double* d, const size_t l);
+            void fma(Parallel, const std::vector<long double>& a, const std::vector<long double>& b, const std::vector<long double>& c, std::vector<long double>& d);
+            void fma(Parallel, const long double* a, const long double* b, const long double* c, long double* d, const size_t l);
+            void fma(const aligned_vector<long double>& a, const aligned_vector<long double>& b, const aligned_vector<long double>& c, aligned_vector<long double>& d);
+            void fma(Parallel, const aligned_vector<long double>& a, const aligned_vector<long double>& b, const aligned_vector<long double>& c, aligned_vector<long double>& d);
+        #pragma endregion // long double
+        
+        #define FMA(a, b, c, d) fma(a, b, c, d, ezsimd::arrayLength(a))
+    #pragma endregion // fma
+    
+    #pragma region // sum
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::Sum, int8_t> {
+                using type = int8_t (*)(const int8_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int8_t sum(const std::vector<int8_t>& a);
+            template <size_t S>
+            int8_t sum(const std::array<int8_t, S>& a);
+            int8_t sum(const int8_t* a, const size_t l);
+            int8_t sum(Parallel, const std::vector<int8_t>& a);
+            int8_t sum(Parallel, const int8_t* a, const size_t l);
+            int8_t sum(const aligned_vector<int8_t>& a);
+            int8_t sum(Parallel, const aligned_vector<int8_t>& a);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::Sum, int16_t> {
+                using type = int16_t (*)(const int16_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int16_t sum(const std::vector<int16_t>& a);
+            template <size_t S>
+            int16_t sum(const std::array<int16_t, S>& a);
+            int16_t sum(const int16_t* a, const size_t l);
+            int16_t sum(Parallel, const std::vector<int16_t>& a);
+            int16_t sum(Parallel, const int16_t* a, const size_t l);
+            int16_t sum(const aligned_vector<int16_t>& a);
+            int16_t sum(Parallel, const aligned_vector<int16_t>& a);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::Sum, int32_t> {
+                using type = int32_t (*)(const int32_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int32_t sum(const std::vector<int32_t>& a);
+            template <size_t S>
+            int32_t sum(const std::array<int32_t, S>& a);
+            int32_t sum(const int32_t* a, const size_t l);
+            int32_t sum(Parallel, const std::vector<int32_t>& a);
+            int32_t sum(Parallel, const int32_t* a, const size_t l);
+            int32_t sum(const aligned_vector<int32_t>& a);
+            int32_t sum(Parallel, const aligned_vector<int32_t>& a);
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Kernel<op::Sum, int64_t> {
+                using type = int64_t (*)(const int64_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int64_t sum(const std::vector<int64_t>& a);
+            template <size_t S>
+            int64_t sum(const std::array<int64_t, S>& a);
+            int64_t sum(const int64_t* a, const size_t l);
+            int64_t sum(Parallel, const std::vector<int64_t>& a);
+            int64_t sum(Parallel, const int64_t* a, const size_t l);
+            int64_t sum(const aligned_vector<int64_t>& a);
+            int64_t sum(Parallel, const aligned_vector<int64_t>& a);
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Sum, __int128_t> {
+                using type = __int128_t (*)(const __int128_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            __int128_t sum(const std::vector<__int128_t>& a);
+            template <size_t S>
+            __int128_t sum(const std::array<__int128_t, S>& a);
+            __int128_t sum(const __int128_t* a, const size_t l);
+            __int128_t sum(Parallel, const std::vector<__int128_t>& a);
+            __int128_t sum(Parallel, const __int128_t* a, const size_t l);
+            __int128_t sum(const aligned_vector<__int128_t>& a);
+            __int128_t sum(Parallel, const aligned_vector<__int128_t>& a);
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Sum, uint8_t> {
+                using type = uint8_t (*)(const uint8_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint8_t sum(const std::vector<uint8_t>& a);
+            template <size_t S>
+            uint8_t sum(const std::array<uint8_t, S>& a);
+            uint8_t sum(const uint8_t* a, const size_t l);
+            uint8_t sum(Parallel, const std::vector<uint8_t>& a);
+            uint8_t sum(Parallel, const uint8_t* a, const size_t l);
+            uint8_t sum(const aligned_vector<uint8_t>& a);
+            uint8_t sum(Parallel, const aligned_vector<uint8_t>& a);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Sum, uint16_t> {
+                using type = uint16_t (*)(const uint16_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint16_t sum(const std::vector<uint16_t>& a);
+            template <size_t S>
+            uint16_t sum(const std::array<uint16_t, S>& a);
+            uint16_t sum(const uint16_t* a, const size_t l);
+            uint16_t sum(Parallel, const std::vector<uint16_t>& a);
+            uint16_t sum(Parallel, const uint16_t* a, const size_t l);
+            uint16_t sum(const aligned_vector<uint16_t>& a);
+            uint16_t sum(Parallel, const aligned_vector<uint16_t>& a);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Sum, uint32_t> {
+                using type = uint32_t (*)(const uint32_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint32_t sum(const std::vector<uint32_t>& a);
+            template <size_t S>
+            uint32_t sum(const std::array<uint32_t, S>& a);
+            uint32_t sum(const uint32_t* a, const size_t l);
+            uint32_t sum(Parallel, const std::vector<uint32_t>& a);
+            uint32_t sum(Parallel, const uint32_t* a, const size_t l);
+            uint32_t sum(const aligned_vector<uint32_t>& a);
+            uint32_t sum(Parallel, const aligned_vector<uint32_t>& a);
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Sum, uint64_t> {
+                using type = uint64_t (*)(const uint64_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint64_t sum(const std::vector<uint64_t>& a);
+            template <size_t S>
+            uint64_t sum(const std::array<uint64_t, S>& a);
+            uint64_t sum(const uint64_t* a, const size_t l);
+            uint64_t sum(Parallel, const std::vector<uint64_t>& a);
+            uint64_t sum(Parallel, const uint64_t* a, const size_t l);
+            uint64_t sum(const aligned_vector<uint64_t>& a);
+            uint64_t sum(Parallel, const aligned_vector<uint64_t>& a);
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Sum, __uint128_t> {
+                using type = __uint128_t (*)(const __uint128_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            __uint128_t sum(const std::vector<__uint128_t>& a);
+            template <size_t S>
+            __uint128_t sum(const std::array<__uint128_t, S>& a);
+            __uint128_t sum(const __uint128_t* a, const size_t l);
+            __uint128_t sum(Parallel, const std::vector<__uint128_t>& a);
+            __uint128_t sum(Parallel, const __uint128_t* a, const size_t l);
+            __uint128_t sum(const aligned_vector<__uint128_t>& a);
+            __uint128_t sum(Parallel, const aligned_vector<__uint128_t>& a);
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Sum, _Float16> {
+                using type = _Float16 (*)(const _Float16* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            _Float16 sum(const std::vector<_Float16>& a);
+            template <size_t S>
+            _Float16 sum(const std::array<_Float16, S>& a);
+            _Float16 sum(const _Float16* a, const size_t l);
+            _Float16 sum(Parallel, const std::vector<_Float16>& a);
+            _Float16 sum(Parallel, const _Float16* a, const size_t l);
+            _Float16 sum(const aligned_vector<_Float16>& a);
+            _Float16 sum(Parallel, const aligned_vector<_Float16>& a);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Sum, bfloat16> {
+                using type = bfloat16 (*)(const bfloat16* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            bfloat16 sum(const std::vector<bfloat16>& a);
+            template <size_t S>
+            bfloat16 sum(const std::array<bfloat16, S>& a);
+            bfloat16 sum(const bfloat16* a, const size_t l);
+            bfloat16 sum(Parallel, const std::vector<bfloat16>& a);
+            bfloat16 sum(Parallel, const bfloat16* a, const size_t l);
+            bfloat16 sum(const aligned_vector<bfloat16>& a);
+            bfloat16 sum(Parallel, const aligned_vector<bfloat16>& a);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::Sum, float> {
+                using type = float (*)(const float* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            float sum(const std::vector<float>& a);
+            template <size_t S>
+            float sum(const std::array<float, S>& a);
+            float sum(const float* a, const size_t l);
+            float sum(Parallel, const std::vector<float>& a);
+            float sum(Parallel, const float* a, const size_t l);
+            float sum(const aligned_vector<float>& a);
+            float sum(Parallel, const aligned_vector<float>& a);
+        #pragma endregion // float
+
+        #pragma region // double
+            template <>
+            struct Kernel<op::Sum, double> {
+                using type = double (*)(const double* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            double sum(const std::vector<double>& a);
+            template <size_t S>
+            double sum(const std::array<double, S>& a);
+            double sum(const double* a, const size_t l);
+            double sum(Parallel, const std::vector<double>& a);
+            double sum(Parallel, const double* a, const size_t l);
+            double sum(const aligned_vector<double>& a);
+            double sum(Parallel, const aligned_vector<double>& a);
+        #pragma endregion // double
+
+        #pragma region // long double
+            template <>
+            struct Kernel<op::Sum, long double> {
+                using type = long double (*)(const long double* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            long double sum(const std::vector<long double>& a);
+            template <size_t S>
+            long double sum(const std::array<long double, S>& a);
+            long double sum(const long double* a, const size_t l);
+            long double sum(Parallel, const std::vector<long double>& a);
+            long double sum(Parallel, const long double* a, const size_t l);
+            long double sum(const aligned_vector<long double>& a);
+            long double sum(Parallel, const aligned_vector<long double>& a);
+        #pragma endregion // long double
+        
+        #define SUM(a) sum(a, ezsimd::arrayLength(a))
+    #pragma endregion // sum
+    
+    #pragma region // min
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::Min, int8_t> {
+                using type = int8_t (*)(const int8_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int8_t min(const std::vector<int8_t>& a);
+            template <size_t S>
+            int8_t min(const std::array<int8_t, S>& a);
+            int8_t min(const int8_t* a, const size_t l);
+            int8_t min(Parallel, const std::vector<int8_t>& a);
+            int8_t min(Parallel, const int8_t* a, const size_t l);
+            int8_t min(const aligned_vector<int8_t>& a);
+            int8_t min(Parallel, const aligned_vector<int8_t>& a);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::Min, int16_t> {
+                using type = int16_t (*)(const int16_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int16_t min(const std::vector<int16_t>& a);
+            template <size_t S>
+            int16_t min(const std::array<int16_t, S>& a);
+            int16_t min(const int16_t* a, const size_t l);
+            int16_t min(Parallel, const std::vector<int16_t>& a);
+            int16_t min(Parallel, const int16_t* a, const size_t l);
+            int16_t min(const aligned_vector<int16_t>& a);
+            int16_t min(Parallel, const aligned_vector<int16_t>& a);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::Min, int32_t> {
+                using type = int32_t (*)(const int32_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int32_t min(const std::vector<int32_t>& a);
+            template <size_t S>
+            int32_t min(const std::array<int32_t, S>& a);
+            int32_t min(const int32_t* a, const size_t l);
+            int32_t min(Parallel, const std::vector<int32_t>& a);
+            int32_t min(Parallel, const int32_t* a, const size_t l);
+            int32_t min(const aligned_vector<int32_t>& a);
+            int32_t min(Parallel, const aligned_vector<int32_t>& a);
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Kernel<op::Min, int64_t> {
+                using type = int64_t (*)(const int64_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int64_t min(const std::vector<int64_t>& a);
+            template <size_t S>
+            int64_t min(const std::array<int64_t, S>& a);
+            int64_t min(const int64_t* a, const size_t l);
+            int64_t min(Parallel, const std::vector<int64_t>& a);
+            int64_t min(Parallel, const int64_t* a, const size_t l);
+            int64_t min(const aligned_vector<int64_t>& a);
+            int64_t min(Parallel, const aligned_vector<int64_t>& a);
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Min, __int128_t> {
+                using type = __int128_t (*)(const __int128_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            __int128_t min(const std::vector<__int128_t>& a);
+            template <size_t S>
+            __int128_t min(const std::array<__int128_t, S>& a);
+            __int128_t min(const __int128_t* a, const size_t l);
+            __int128_t min(Parallel, const std::vector<__int128_t>& a);
+            __int128_t min(Parallel, const __int128_t* a, const size_t l);
+            __int128_t min(const aligned_vector<__int128_t>& a);
+            __int128_t min(Parallel, const aligned_vector<__int128_t>& a);
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Min, uint8_t> {
+                using type = uint8_t (*)(const uint8_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint8_t min(const std::vector<uint8_t>& a);
+            template <size_t S>
+            uint8_t min(const std::array<uint8_t, S>& a);
+            uint8_t min(const uint8_t* a, const size_t l);
+            uint8_t min(Parallel, const std::vector<uint8_t>& a);
+            uint8_t min(Parallel, const uint8_t* a, const size_t l);
+            uint8_t min(const aligned_vector<uint8_t>& a);
+            uint8_t min(Parallel, const aligned_vector<uint8_t>& a);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Min, uint16_t> {
+                using type = uint16_t (*)(const uint16_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint16_t min(const std::vector<uint16_t>& a);
+            template <size_t S>
+            uint16_t min(const std::array<uint16_t, S>& a);
+            uint16_t min(const uint16_t* a, const size_t l);
+            uint16_t min(Parallel, const std::vector<uint16_t>& a);
+            uint16_t min(Parallel, const uint16_t* a, const size_t l);
+            uint16_t min(const aligned_vector<uint16_t>& a);
+            uint16_t min(Parallel, const aligned_vector<uint16_t>& a);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Min, uint32_t> {
+                using type = uint32_t (*)(const uint32_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint32_t min(const std::vector<uint32_t>& a);
+            template <size_t S>
+            uint32_t min(const std::array<uint32_t, S>& a);
+            uint32_t min(const uint32_t* a, const size_t l);
+            uint32_t min(Parallel, const std::vector<uint32_t>& a);
+            uint32_t min(Parallel, const uint32_t* a, const size_t l);
+            uint32_t min(const aligned_vector<uint32_t>& a);
+            uint32_t min(Parallel, const aligned_vector<uint32_t>& a);
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Min, uint64_t> {
+                using type = uint64_t (*)(const uint64_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint64_t min(const std::vector<uint64_t>& a);
+            template <size_t S>
+            uint64_t min(const std::array<uint64_t, S>& a);
+            uint64_t min(const uint64_t* a, const size_t l);
+            uint64_t min(Parallel, const std::vector<uint64_t>& a);
+            uint64_t min(Parallel, const uint64_t* a, const size_t l);
+            uint64_t min(const aligned_vector<uint64_t>& a);
+            uint64_t min(Parallel, const aligned_vector<uint64_t>& a);
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Min, __uint128_t> {
+                using type = __uint128_t (*)(const __uint128_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            __uint128_t min(const std::vector<__uint128_t>& a);
+            template <size_t S>
+            __uint128_t min(const std::array<__uint128_t, S>& a);
+            __uint128_t min(const __uint128_t* a, const size_t l);
+            __uint128_t min(Parallel, const std::vector<__uint128_t>& a);
+            __uint128_t min(Parallel, const __uint128_t* a, const size_t l);
+            __uint128_t min(const aligned_vector<__uint128_t>& a);
+            __uint128_t min(Parallel, const aligned_vector<__uint128_t>& a);
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Min, _Float16> {
+                using type = _Float16 (*)(const _Float16* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            _Float16 min(const std::vector<_Float16>& a);
+            template <size_t S>
+            _Float16 min(const std::array<_Float16, S>& a);
+            _Float16 min(const _Float16* a, const size_t l);
+            _Float16 min(Parallel, const std::vector<_Float16>& a);
+            _Float16 min(Parallel, const _Float16* a, const size_t l);
+            _Float16 min(const aligned_vector<_Float16>& a);
+            _Float16 min(Parallel, const aligned_vector<_Float16>& a);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Min, bfloat16> {
+                using type = bfloat16 (*)(const bfloat16* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            bfloat16 min(const std::vector<bfloat16>& a);
+            template <size_t S>
+            bfloat16 min(const std::array<bfloat16, S>& a);
+            bfloat16 min(const bfloat16* a, const size_t l);
+            bfloat16 min(Parallel, const std::vector<bfloat16>& a);
+            bfloat16 min(Parallel, const bfloat16* a, const size_t l);
+            bfloat16 min(const aligned_vector<bfloat16>& a);
+            bfloat16 min(Parallel, const aligned_vector<bfloat16>& a);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::Min, float> {
+                using type = float (*)(const float* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            float min(const std::vector<float>& a);
+            template <size_t S>
+            float min(const std::array<float, S>& a);
+            float min(const float* a, const size_t l);
+            float min(Parallel, const std::vector<float>& a);
+            float min(Parallel, const float* a, const size_t l);
+            float min(const aligned_vector<float>& a);
+            float min(Parallel, const aligned_vector<float>& a);
+        #pragma endregion // float
+
+        #pragma region // double
+            template <>
+            struct Kernel<op::Min, double> {
+                using type = double (*)(const double* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            double min(const std::vector<double>& a);
+            template <size_t S>
+            double min(const std::array<double, S>& a);
+            double min(const double* a, const size_t l);
+            double min(Parallel, const std::vector<double>& a);
+            double min(Parallel, const double* a, const size_t l);
+            double min(const aligned_vector<double>& a);
+            double min(Parallel, const aligned_vector<double>& a);
+        #pragma endregion // double
+
+        #pragma region // long double
+            template <>
+            struct Kernel<op::Min, long double> {
+                using type = long double (*)(const long double* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            long double min(const std::vector<long double>& a);
+            template <size_t S>
+            long double min(const std::array<long double, S>& a);
+            long double min(const long double* a, const size_t l);
+            long double min(Parallel, const std::vector<long double>& a);
+            long double min(Parallel, const long double* a, const size_t l);
+            long double min(const aligned_vector<long double>& a);
+            long double min(Parallel, const aligned_vector<long double>& a);
+        #pragma endregion // long double
+    #pragma endregion // min
+    
+    #pragma region // max
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::Max, int8_t> {
+                using type = int8_t (*)(const int8_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int8_t max(const std::vector<int8_t>& a);
+            template <size_t S>
+            int8_t max(const std::array<int8_t, S>& a);
+            int8_t max(const int8_t* a, const size_t l);
+            int8_t max(Parallel, const std::vector<int8_t>& a);
+            int8_t max(Parallel, const int8_t* a, const size_t l);
+            int8_t max(const aligned_vector<int8_t>& a);
+            int8_t max(Parallel, const aligned_vector<int8_t>& a);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::Max, int16_t> {
+                using type = int16_t (*)(const int16_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int16_t max(const std::vector<int16_t>& a);
+            template <size_t S>
+            int16_t max(const std::array<int16_t, S>& a);
+            int16_t max(const int16_t* a, const size_t l);
+            int16_t max(Parallel, const std::vector<int16_t>& a);
+            int16_t max(Parallel, const int16_t* a, const size_t l);
+            int16_t max(const aligned_vector<int16_t>& a);
+            int16_t max(Parallel, const aligned_vector<int16_t>& a);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::Max, int32_t> {
+                using type = int32_t (*)(const int32_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int32_t max(const std::vector<int32_t>& a);
+            template <size_t S>
+            int32_t max(const std::array<int32_t, S>& a);
+            int32_t max(const int32_t* a, const size_t l);
+            int32_t max(Parallel, const std::vector<int32_t>& a);
+            int32_t max(Parallel, const int32_t* a, const size_t l);
+            int32_t max(const aligned_vector<int32_t>& a);
+            int32_t max(Parallel, const aligned_vector<int32_t>& a);
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Kernel<op::Max, int64_t> {
+                using type = int64_t (*)(const int64_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int64_t max(const std::vector<int64_t>& a);
+            template <size_t S>
+            int64_t max(const std::array<int64_t, S>& a);
+            int64_t max(const int64_t* a, const size_t l);
+            int64_t max(Parallel, const std::vector<int64_t>& a);
+            int64_t max(Parallel, const int64_t* a, const size_t l);
+            int64_t max(const aligned_vector<int64_t>& a);
+            int64_t max(Parallel, const aligned_vector<int64_t>& a);
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Max, __int128_t> {
+                using type = __int128_t (*)(const __int128_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            __int128_t max(const std::vector<__int128_t>& a);
+            template <size_t S>
+            __int128_t max(const std::array<__int128_t, S>& a);
+            __int128_t max(const __int128_t* a, const size_t l);
+            __int128_t max(Parallel, const std::vector<__int128_t>& a);
+            __int128_t max(Parallel, const __int128_t* a, const size_t l);
+            __int128_t max(const aligned_vector<__int128_t>& a);
+            __int128_t max(Parallel, const aligned_vector<__int128_t>& a);
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Max, uint8_t> {
+                using type = uint8_t (*)(const uint8_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint8_t max(const std::vector<uint8_t>& a);
+            template <size_t S>
+            uint8_t max(const std::array<uint8_t, S>& a);
+            uint8_t max(const uint8_t* a, const size_t l);
+            uint8_t max(Parallel, const std::vector<uint8_t>& a);
+            uint8_t max(Parallel, const uint8_t* a, const size_t l);
+            uint8_t max(const aligned_vector<uint8_t>& a);
+            uint8_t max(Parallel, const aligned_vector<uint8_t>& a);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Max, uint16_t> {
+                using type = uint16_t (*)(const uint16_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint16_t max(const std::vector<uint16_t>& a);
+            template <size_t S>
+            uint16_t max(const std::array<uint16_t, S>& a);
+            uint16_t max(const uint16_t* a, const size_t l);
+            uint16_t max(Parallel, const std::vector<uint16_t>& a);
+            uint16_t max(Parallel, const uint16_t* a, const size_t l);
+            uint16_t max(const aligned_vector<uint16_t>& a);
+            uint16_t max(Parallel, const aligned_vector<uint16_t>& a);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Max, uint32_t> {
+                using type = uint32_t (*)(const uint32_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint32_t max(const std::vector<uint32_t>& a);
+            template <size_t S>
+            uint32_t max(const std::array<uint32_t, S>& a);
+            uint32_t max(const uint32_t* a, const size_t l);
+            uint32_t max(Parallel, const std::vector<uint32_t>& a);
+            uint32_t max(Parallel, const uint32_t* a, const size_t l);
+            uint32_t max(const aligned_vector<uint32_t>& a);
+            uint32_t max(Parallel, const aligned_vector<uint32_t>& a);
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Max, uint64_t> {
+                using type = uint64_t (*)(const uint64_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint64_t max(const std::vector<uint64_t>& a);
+            template <size_t S>
+            uint64_t max(const std::array<uint64_t, S>& a);
+            uint64_t max(const uint64_t* a, const size_t l);
+            uint64_t max(Parallel, const std::vector<uint64_t>& a);
+            uint64_t max(Parallel, const uint64_t* a, const size_t l);
+            uint64_t max(const aligned_vector<uint64_t>& a);
+            uint64_t max(Parallel, const aligned_vector<uint64_t>& a);
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Max, __uint128_t> {
+                using type = __uint128_t (*)(const __uint128_t* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            __uint128_t max(const std::vector<__uint128_t>& a);
+            template <size_t S>
+            __uint128_t max(const std::array<__uint128_t, S>& a);
+            __uint128_t max(const __uint128_t* a, const size_t l);
+            __uint128_t max(Parallel, const std::vector<__uint128_t>& a);
+            __uint128_t max(Parallel, const __uint128_t* a, const size_t l);
+            __uint128_t max(const aligned_vector<__uint128_t>& a);
+            __uint128_t max(Parallel, const aligned_vector<__uint128_t>& a);
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Max, _Float16> {
+                using type = _Float16 (*)(const _Float16* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            _Float16 max(const std::vector<_Float16>& a);
+            template <size_t S>
+            _Float16 max(const std::array<_Float16, S>& a);
+            _Float16 max(const _Float16* a, const size_t l);
+            _Float16 max(Parallel, const std::vector<_Float16>& a);
+            _Float16 max(Parallel, const _Float16* a, const size_t l);
+            _Float16 max(const aligned_vector<_Float16>& a);
+            _Float16 max(Parallel, const aligned_vector<_Float16>& a);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Max, bfloat16> {
+                using type = bfloat16 (*)(const bfloat16* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            bfloat16 max(const std::vector<bfloat16>& a);
+            template <size_t S>
+            bfloat16 max(const std::array<bfloat16, S>& a);
+            bfloat16 max(const bfloat16* a, const size_t l);
+            bfloat16 max(Parallel, const std::vector<bfloat16>& a);
+            bfloat16 max(Parallel, const bfloat16* a, const size_t l);
+            bfloat16 max(const aligned_vector<bfloat16>& a);
+            bfloat16 max(Parallel, const aligned_vector<bfloat16>& a);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::Max, float> {
+                using type = float (*)(const float* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            float max(const std::vector<float>& a);
+            template <size_t S>
+            float max(const std::array<float, S>& a);
+            float max(const float* a, const size_t l);
+            float max(Parallel, const std::vector<float>& a);
+            float max(Parallel, const float* a, const size_t l);
+            float max(const aligned_vector<float>& a);
+            float max(Parallel, const aligned_vector<float>& a);
+        #pragma endregion // float
+
+        #pragma region // double
+            template <>
+            struct Kernel<op::Max, double> {
+                using type = double (*)(const double* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            double max(const std::vector<double>& a);
+            template <size_t S>
+            double max(const std::array<double, S>& a);
+            double max(const double* a, const size_t l);
+            double max(Parallel, const std::vector<double>& a);
+            double max(Parallel, const double* a, const size_t l);
+            double max(const aligned_vector<double>& a);
+            double max(Parallel, const aligned_vector<double>& a);
+        #pragma endregion // double
+
+        #pragma region // long double
+            template <>
+            struct Kernel<op::Max, long double> {
+                using type = long double (*)(const long double* a, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            long double max(const std::vector<long double>& a);
+            template <size_t S>
+            long double max(const std::array<long double, S>& a);
+            long double max(const long double* a, const size_t l);
+            long double max(Parallel, const std::vector<long double>& a);
+            long double max(Parallel, const long double* a, const size_t l);
+            long double max(const aligned_vector<long double>& a);
+            long double max(Parallel, const aligned_vector<long double>& a);
+        #pragma endregion // long double
+    #pragma endregion // max
+    
+    #pragma region // dot
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::Dot, int8_t> {
+                using type = int8_t (*)(const int8_t* a, const int8_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int8_t dot(const std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            template <size_t S>
+            int8_t dot(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b);
+            int8_t dot(const int8_t* a, const int8_t* b, const size_t l);
+            int8_t dot(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b);
+            int8_t dot(Parallel, const int8_t* a, const int8_t* b, const size_t l);
+            int8_t dot(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+            int8_t dot(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::Dot, int16_t> {
+                using type = int16_t (*)(const int16_t* a, const int16_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int16_t dot(const std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            template <size_t S>
+            int16_t dot(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b);
+            int16_t dot(const int16_t* a, const int16_t* b, const size_t l);
+            int16_t dot(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b);
+            int16_t dot(Parallel, const int16_t* a, const int16_t* b, const size_t l);
+            int16_t dot(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+            int16_t dot(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::Dot, int32_t> {
+                using type = int32_t (*)(const int32_t* a, const int32_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int32_t dot(const std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            template <size_t S>
+            int32_t dot(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b);
+            int32_t dot(const int32_t* a, const int32_t* b, const size_t l);
+            int32_t dot(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b);
+            int32_t dot(Parallel, const int32_t* a, const int32_t* b, const size_t l);
+            int32_t dot(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+            int32_t dot(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b);
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Kernel<op::Dot, int64_t> {
+                using type = int64_t (*)(const int64_t* a, const int64_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            int64_t dot(const std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            template <size_t S>
+            int64_t dot(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b);
+            int64_t dot(const int64_t* a, const int64_t* b, const size_t l);
+            int64_t dot(Parallel, const std::vector<int64_t>& a, const std::vector<int64_t>& b);
+            int64_t dot(Parallel, const int64_t* a, const int64_t* b, const size_t l);
+            int64_t dot(const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+            int64_t dot(Parallel, const aligned_vector<int64_t>& a, const aligned_vector<int64_t>& b);
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Kernel<op::Dot, __int128_t> {
+                using type = __int128_t (*)(const __int128_t* a, const __int128_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            __int128_t dot(const std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            template <size_t S>
+            __int128_t dot(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b);
+            __int128_t dot(const __int128_t* a, const __int128_t* b, const size_t l);
+            __int128_t dot(Parallel, const std::vector<__int128_t>& a, const std::vector<__int128_t>& b);
+            __int128_t dot(Parallel, const __int128_t* a, const __int128_t* b, const size_t l);
+            __int128_t dot(const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+            __int128_t dot(Parallel, const aligned_vector<__int128_t>& a, const aligned_vector<__int128_t>& b);
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Dot, uint8_t> {
+                using type = uint8_t (*)(const uint8_t* a, const uint8_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint8_t dot(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            template <size_t S>
+            uint8_t dot(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b);
+            uint8_t dot(const uint8_t* a, const uint8_t* b, const size_t l);
+            uint8_t dot(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+            uint8_t dot(Parallel, const uint8_t* a, const uint8_t* b, const size_t l);
+            uint8_t dot(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+            uint8_t dot(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Dot, uint16_t> {
+                using type = uint16_t (*)(const uint16_t* a, const uint16_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint16_t dot(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            template <size_t S>
+            uint16_t dot(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b);
+            uint16_t dot(const uint16_t* a, const uint16_t* b, const size_t l);
+            uint16_t dot(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b);
+            uint16_t dot(Parallel, const uint16_t* a, const uint16_t* b, const size_t l);
+            uint16_t dot(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+            uint16_t dot(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Dot, uint32_t> {
+                using type = uint32_t (*)(const uint32_t* a, const uint32_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint32_t dot(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            template <size_t S>
+            uint32_t dot(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b);
+            uint32_t dot(const uint32_t* a, const uint32_t* b, const size_t l);
+            uint32_t dot(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+            uint32_t dot(Parallel, const uint32_t* a, const uint32_t* b, const size_t l);
+            uint32_t dot(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+            uint32_t dot(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b);
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Kernel<op::Dot, uint64_t> {
+                using type = uint64_t (*)(const uint64_t* a, const uint64_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            uint64_t dot(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            template <size_t S>
+            uint64_t dot(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b);
+            uint64_t dot(const uint64_t* a, const uint64_t* b, const size_t l);
+            uint64_t dot(Parallel, const std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+            uint64_t dot(Parallel, const uint64_t* a, const uint64_t* b, const size_t l);
+            uint64_t dot(const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+            uint64_t dot(Parallel, const aligned_vector<uint64_t>& a, const aligned_vector<uint64_t>& b);
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Kernel<op::Dot, __uint128_t> {
+                using type = __uint128_t (*)(const __uint128_t* a, const __uint128_t* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            __uint128_t dot(const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            template <size_t S>
+            __uint128_t dot(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b);
+            __uint128_t dot(const __uint128_t* a, const __uint128_t* b, const size_t l);
+            __uint128_t dot(Parallel, const std::vector<__uint128_t>& a, const std::vector<__uint128_t>& b);
+            __uint128_t dot(Parallel, const __uint128_t* a, const __uint128_t* b, const size_t l);
+            __uint128_t dot(const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+            __uint128_t dot(Parallel, const aligned_vector<__uint128_t>& a, const aligned_vector<__uint128_t>& b);
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Dot, _Float16> {
+                using type = _Float16 (*)(const _Float16* a, const _Float16* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            _Float16 dot(const std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            template <size_t S>
+            _Float16 dot(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b);
+            _Float16 dot(const _Float16* a, const _Float16* b, const size_t l);
+            _Float16 dot(Parallel, const std::vector<_Float16>& a, const std::vector<_Float16>& b);
+            _Float16 dot(Parallel, const _Float16* a, const _Float16* b, const size_t l);
+            _Float16 dot(const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+            _Float16 dot(Parallel, const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Dot, bfloat16> {
+                using type = bfloat16 (*)(const bfloat16* a, const bfloat16* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            bfloat16 dot(const std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            template <size_t S>
+            bfloat16 dot(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b);
+            bfloat16 dot(const bfloat16* a, const bfloat16* b, const size_t l);
+            bfloat16 dot(Parallel, const std::vector<bfloat16>& a, const std::vector<bfloat16>& b);
+            bfloat16 dot(Parallel, const bfloat16* a, const bfloat16* b, const size_t l);
+            bfloat16 dot(const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+            bfloat16 dot(Parallel, const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::Dot, float> {
+                using type = float (*)(const float* a, const float* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            float dot(const std::vector<float>& a, const std::vector<float>& b);
+            template <size_t S>
+            float dot(const std::array<float, S>& a, const std::array<float, S>& b);
+            float dot(const float* a, const float* b, const size_t l);
+            float dot(Parallel, const std::vector<float>& a, const std::vector<float>& b);
+            float dot(Parallel, const float* a, const float* b, const size_t l);
+            float dot(const aligned_vector<float>& a, const aligned_vector<float>& b);
+            float dot(Parallel, const aligned_vector<float>& a, const aligned_vector<float>& b);
+        #pragma endregion // float
+
+        #pragma region // double
+            template <>
+            struct Kernel<op::Dot, double> {
+                using type = double (*)(const double* a, const double* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            double dot(const std::vector<double>& a, const std::vector<double>& b);
+            template <size_t S>
+            double dot(const std::array<double, S>& a, const std::array<double, S>& b);
+            double dot(const double* a, const double* b, const size_t l);
+            double dot(Parallel, const std::vector<double>& a, const std::vector<double>& b);
+            double dot(Parallel, const double* a, const double* b, const size_t l);
+            double dot(const aligned_vector<double>& a, const aligned_vector<double>& b);
+            double dot(Parallel, const aligned_vector<double>& a, const aligned_vector<double>& b);
+        #pragma endregion // double
+
+        #pragma region // long double
+            template <>
+            struct Kernel<op::Dot, long double> {
+                using type = long double (*)(const long double* a, const long double* b, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            long double dot(const std::vector<long double>& a, const std::vector<long double>& b);
+            template <size_t S>
+            long double dot(const std::array<long double, S>& a, const std::array<long double, S>& b);
+            long double dot(const long double* a, const long double* b, const size_t l);
+            long double dot(Parallel, const std::vector<long double>& a, const std::vector<long double>& b);
+            long double dot(Parallel, const long double* a, const long double* b, const size_t l);
+            long double dot(const aligned_vector<long double>& a, const aligned_vector<long double>& b);
+            long double dot(Parallel, const aligned_vector<long double>& a, const aligned_vector<long double>& b);
+        #pragma endregion // long double
+        
+        #define DOT(a, b) dot(a, b, ezsimd::arrayLength(a))
+    #pragma endregion // dot
+    
+    #pragma region // addWiden
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::AddWiden, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void addWiden(const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int16_t>& c);
+            template <size_t S>
+            void addWiden(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int16_t, S>& c);
+            void addWiden(const int8_t* a, const int8_t* b, int16_t* c, const size_t l);
+            void addWiden(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int16_t>& c);
+            void addWiden(Parallel, const int8_t* a, const int8_t* b, int16_t* c, const size_t l);
+            void addWiden(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int16_t>& c);
+            void addWiden(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int16_t>& c);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::AddWiden, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void addWiden(const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int32_t>& c);
+            template <size_t S>
+            void addWiden(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int32_t, S>& c);
+            void addWiden(const int16_t* a, const int16_t* b, int32_t* c, const size_t l);
+            void addWiden(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int32_t>& c);
+            void addWiden(Parallel, const int16_t* a, const int16_t* b, int32_t* c, const size_t l);
+            void addWiden(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int32_t>& c);
+            void addWiden(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int32_t>& c);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::AddWiden, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void addWiden(const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int64_t>& c);
+            template <size_t S>
+            void addWiden(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int64_t, S>& c);
+            void addWiden(const int32_t* a, const int32_t* b, int64_t* c, const size_t l);
+            void addWiden(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int64_t>& c);
+            void addWiden(Parallel, const int32_t* a, const int32_t* b, int64_t* c, const size_t l);
+            void addWiden(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int64_t>& c);
+            void addWiden(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int64_t>& c);
+        #pragma endregion // int32_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::AddWiden, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void addWiden(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint16_t>& c);
+            template <size_t S>
+            void addWiden(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint16_t, S>& c);
+            void addWiden(const uint8_t* a, const uint8_t* b, uint16_t* c, const size_t l);
+            void addWiden(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint16_t>& c);
+            void addWiden(Parallel, const uint8_t* a, const uint8_t* b, uint16_t* c, const size_t l);
+            void addWiden(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint16_t>& c);
+            void addWiden(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint16_t>& c);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::AddWiden, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void addWiden(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint32_t>& c);
+            template <size_t S>
+            void addWiden(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint32_t, S>& c);
+            void addWiden(const uint16_t* a, const uint16_t* b, uint32_t* c, const size_t l);
+            void addWiden(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint32_t>& c);
+            void addWiden(Parallel, const uint16_t* a, const uint16_t* b, uint32_t* c, const size_t l);
+            void addWiden(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint32_t>& c);
+            void addWiden(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint32_t>& c);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::AddWiden, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void addWiden(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint64_t>& c);
+            template <size_t S>
+            void addWiden(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint64_t, S>& c);
+            void addWiden(const uint32_t* a, const uint32_t* b, uint64_t* c, const size_t l);
+            void addWiden(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint64_t>& c);
+            void addWiden(Parallel, const uint32_t* a, const uint32_t* b, uint64_t* c, const size_t l);
+            void addWiden(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint64_t>& c);
+            void addWiden(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint64_t>& c);
+        #pragma endregion // uint32_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::AddWiden, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void addWiden(const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<float>& c);
+            template <size_t S>
+            void addWiden(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<float, S>& c);
+            void addWiden(const _Float16* a, const _Float16* b, float* c, const size_t l);
+            void addWiden(Parallel, const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<float>& c);
+            void addWiden(Parallel, const _Float16* a, const _Float16* b, float* c, const size_t l);
+            void addWiden(const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<float>& c);
+            void addWiden(Parallel, const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<float>& c);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::AddWiden, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void addWiden(const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<float>& c);
+            template <size_t S>
+            void addWiden(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<float, S>& c);
+            void addWiden(const bfloat16* a, const bfloat16* b, float* c, const size_t l);
+            void addWiden(Parallel, const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<float>& c);
+            void addWiden(Parallel, const bfloat16* a, const bfloat16* b, float* c, const size_t l);
+            void addWiden(const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<float>& c);
+            void addWiden(Parallel, const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<float>& c);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::AddWiden, float> {
+                using type = void (*)(const float* a, const float* b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void addWiden(const std::vector<float>& a, const std::vector<float>& b, std::vector<double>& c);
+            template <size_t S>
+            void addWiden(const std::array<float, S>& a, const std::array<float, S>& b, std::array<double, S>& c);
+            void addWiden(const float* a, const float* b, double* c, const size_t l);
+            void addWiden(Parallel, const std::vector<float>& a, const std::vector<float>& b, std::vector<double>& c);
+            void addWiden(Parallel, const float* a, const float* b, double* c, const size_t l);
+            void addWiden(const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<double>& c);
+            void addWiden(Parallel, const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<double>& c);
+        #pragma endregion // float
+        
+        #define ADD_WIDEN(a, b, c) addWiden(a, b, c, ezsimd::arrayLength(a))
+    #pragma endregion // addWiden
+    
+    #pragma region // subWiden
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::SubWiden, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void subWiden(const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int16_t>& c);
+            template <size_t S>
+            void subWiden(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int16_t, S>& c);
+            void subWiden(const int8_t* a, const int8_t* b, int16_t* c, const size_t l);
+            void subWiden(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int16_t>& c);
+            void subWiden(Parallel, const int8_t* a, const int8_t* b, int16_t* c, const size_t l);
+            void subWiden(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int16_t>& c);
+            void subWiden(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int16_t>& c);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::SubWiden, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void subWiden(const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int32_t>& c);
+            template <size_t S>
+            void subWiden(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int32_t, S>& c);
+            void subWiden(const int16_t* a, const int16_t* b, int32_t* c, const size_t l);
+            void subWiden(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int32_t>& c);
+            void subWiden(Parallel, const int16_t* a, const int16_t* b, int32_t* c, const size_t l);
+            void subWiden(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int32_t>& c);
+            void subWiden(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int32_t>& c);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::SubWiden, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void subWiden(const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int64_t>& c);
+            template <size_t S>
+            void subWiden(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int64_t, S>& c);
+            void subWiden(const int32_t* a, const int32_t* b, int64_t* c, const size_t l);
+            void subWiden(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int64_t>& c);
+            void subWiden(Parallel, const int32_t* a, const int32_t* b, int64_t* c, const size_t l);
+            void subWiden(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int64_t>& c);
+            void subWiden(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int64_t>& c);
+        #pragma endregion // int32_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::SubWiden, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void subWiden(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint16_t>& c);
+            template <size_t S>
+            void subWiden(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint16_t, S>& c);
+            void subWiden(const uint8_t* a, const uint8_t* b, uint16_t* c, const size_t l);
+            void subWiden(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint16_t>& c);
+            void subWiden(Parallel, const uint8_t* a, const uint8_t* b, uint16_t* c, const size_t l);
+            void subWiden(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint16_t>& c);
+            void subWiden(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint16_t>& c);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::SubWiden, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void subWiden(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint32_t>& c);
+            template <size_t S>
+            void subWiden(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint32_t, S>& c);
+            void subWiden(const uint16_t* a, const uint16_t* b, uint32_t* c, const size_t l);
+            void subWiden(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint32_t>& c);
+            void subWiden(Parallel, const uint16_t* a, const uint16_t* b, uint32_t* c, const size_t l);
+            void subWiden(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint32_t>& c);
+            void subWiden(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint32_t>& c);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::SubWiden, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void subWiden(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint64_t>& c);
+            template <size_t S>
+            void subWiden(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint64_t, S>& c);
+            void subWiden(const uint32_t* a, const uint32_t* b, uint64_t* c, const size_t l);
+            void subWiden(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint64_t>& c);
+            void subWiden(Parallel, const uint32_t* a, const uint32_t* b, uint64_t* c, const size_t l);
+            void subWiden(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint64_t>& c);
+            void subWiden(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint64_t>& c);
+        #pragma endregion // uint32_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::SubWiden, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void subWiden(const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<float>& c);
+            template <size_t S>
+            void subWiden(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<float, S>& c);
+            void subWiden(const _Float16* a, const _Float16* b, float* c, const size_t l);
+            void subWiden(Parallel, const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<float>& c);
+            void subWiden(Parallel, const _Float16* a, const _Float16* b, float* c, const size_t l);
+            void subWiden(const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<float>& c);
+            void subWiden(Parallel, const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<float>& c);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::SubWiden, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void subWiden(const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<float>& c);
+            template <size_t S>
+            void subWiden(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<float, S>& c);
+            void subWiden(const bfloat16* a, const bfloat16* b, float* c, const size_t l);
+            void subWiden(Parallel, const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<float>& c);
+            void subWiden(Parallel, const bfloat16* a, const bfloat16* b, float* c, const size_t l);
+            void subWiden(const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<float>& c);
+            void subWiden(Parallel, const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<float>& c);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::SubWiden, float> {
+                using type = void (*)(const float* a, const float* b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void subWiden(const std::vector<float>& a, const std::vector<float>& b, std::vector<double>& c);
+            template <size_t S>
+            void subWiden(const std::array<float, S>& a, const std::array<float, S>& b, std::array<double, S>& c);
+            void subWiden(const float* a, const float* b, double* c, const size_t l);
+            void subWiden(Parallel, const std::vector<float>& a, const std::vector<float>& b, std::vector<double>& c);
+            void subWiden(Parallel, const float* a, const float* b, double* c, const size_t l);
+            void subWiden(const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<double>& c);
+            void subWiden(Parallel, const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<double>& c);
+        #pragma endregion // float
+        
+        #define SUB_WIDEN(a, b, c) subWiden(a, b, c, ezsimd::arrayLength(a))
+    #pragma endregion // subWiden
+    
+    #pragma region // mulWiden
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::MulWiden, int8_t> {
+                using type = void (*)(const int8_t* a, const int8_t* b, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void mulWiden(const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int16_t>& c);
+            template <size_t S>
+            void mulWiden(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int16_t, S>& c);
+            void mulWiden(const int8_t* a, const int8_t* b, int16_t* c, const size_t l);
+            void mulWiden(Parallel, const std::vector<int8_t>& a, const std::vector<int8_t>& b, std::vector<int16_t>& c);
+            void mulWiden(Parallel, const int8_t* a, const int8_t* b, int16_t* c, const size_t l);
+            void mulWiden(const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int16_t>& c);
+            void mulWiden(Parallel, const aligned_vector<int8_t>& a, const aligned_vector<int8_t>& b, aligned_vector<int16_t>& c);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::MulWiden, int16_t> {
+                using type = void (*)(const int16_t* a, const int16_t* b, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void mulWiden(const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int32_t>& c);
+            template <size_t S>
+            void mulWiden(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int32_t, S>& c);
+            void mulWiden(const int16_t* a, const int16_t* b, int32_t* c, const size_t l);
+            void mulWiden(Parallel, const std::vector<int16_t>& a, const std::vector<int16_t>& b, std::vector<int32_t>& c);
+            void mulWiden(Parallel, const int16_t* a, const int16_t* b, int32_t* c, const size_t l);
+            void mulWiden(const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int32_t>& c);
+            void mulWiden(Parallel, const aligned_vector<int16_t>& a, const aligned_vector<int16_t>& b, aligned_vector<int32_t>& c);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::MulWiden, int32_t> {
+                using type = void (*)(const int32_t* a, const int32_t* b, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void mulWiden(const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int64_t>& c);
+            template <size_t S>
+            void mulWiden(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int64_t, S>& c);
+            void mulWiden(const int32_t* a, const int32_t* b, int64_t* c, const size_t l);
+            void mulWiden(Parallel, const std::vector<int32_t>& a, const std::vector<int32_t>& b, std::vector<int64_t>& c);
+            void mulWiden(Parallel, const int32_t* a, const int32_t* b, int64_t* c, const size_t l);
+            void mulWiden(const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int64_t>& c);
+            void mulWiden(Parallel, const aligned_vector<int32_t>& a, const aligned_vector<int32_t>& b, aligned_vector<int64_t>& c);
+        #pragma endregion // int32_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::MulWiden, uint8_t> {
+                using type = void (*)(const uint8_t* a, const uint8_t* b, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void mulWiden(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint16_t>& c);
+            template <size_t S>
+            void mulWiden(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint16_t, S>& c);
+            void mulWiden(const uint8_t* a, const uint8_t* b, uint16_t* c, const size_t l);
+            void mulWiden(Parallel, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, std::vector<uint16_t>& c);
+            void mulWiden(Parallel, const uint8_t* a, const uint8_t* b, uint16_t* c, const size_t l);
+            void mulWiden(const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint16_t>& c);
+            void mulWiden(Parallel, const aligned_vector<uint8_t>& a, const aligned_vector<uint8_t>& b, aligned_vector<uint16_t>& c);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::MulWiden, uint16_t> {
+                using type = void (*)(const uint16_t* a, const uint16_t* b, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void mulWiden(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint32_t>& c);
+            template <size_t S>
+            void mulWiden(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint32_t, S>& c);
+            void mulWiden(const uint16_t* a, const uint16_t* b, uint32_t* c, const size_t l);
+            void mulWiden(Parallel, const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, std::vector<uint32_t>& c);
+            void mulWiden(Parallel, const uint16_t* a, const uint16_t* b, uint32_t* c, const size_t l);
+            void mulWiden(const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint32_t>& c);
+            void mulWiden(Parallel, const aligned_vector<uint16_t>& a, const aligned_vector<uint16_t>& b, aligned_vector<uint32_t>& c);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::MulWiden, uint32_t> {
+                using type = void (*)(const uint32_t* a, const uint32_t* b, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void mulWiden(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint64_t>& c);
+            template <size_t S>
+            void mulWiden(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint64_t, S>& c);
+            void mulWiden(const uint32_t* a, const uint32_t* b, uint64_t* c, const size_t l);
+            void mulWiden(Parallel, const std::vector<uint32_t>& a, const std::vector<uint32_t>& b, std::vector<uint64_t>& c);
+            void mulWiden(Parallel, const uint32_t* a, const uint32_t* b, uint64_t* c, const size_t l);
+            void mulWiden(const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint64_t>& c);
+            void mulWiden(Parallel, const aligned_vector<uint32_t>& a, const aligned_vector<uint32_t>& b, aligned_vector<uint64_t>& c);
+        #pragma endregion // uint32_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::MulWiden, _Float16> {
+                using type = void (*)(const _Float16* a, const _Float16* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void mulWiden(const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<float>& c);
+            template <size_t S>
+            void mulWiden(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<float, S>& c);
+            void mulWiden(const _Float16* a, const _Float16* b, float* c, const size_t l);
+            void mulWiden(Parallel, const std::vector<_Float16>& a, const std::vector<_Float16>& b, std::vector<float>& c);
+            void mulWiden(Parallel, const _Float16* a, const _Float16* b, float* c, const size_t l);
+            void mulWiden(const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<float>& c);
+            void mulWiden(Parallel, const aligned_vector<_Float16>& a, const aligned_vector<_Float16>& b, aligned_vector<float>& c);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::MulWiden, bfloat16> {
+                using type = void (*)(const bfloat16* a, const bfloat16* b, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void mulWiden(const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<float>& c);
+            template <size_t S>
+            void mulWiden(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<float, S>& c);
+            void mulWiden(const bfloat16* a, const bfloat16* b, float* c, const size_t l);
+            void mulWiden(Parallel, const std::vector<bfloat16>& a, const std::vector<bfloat16>& b, std::vector<float>& c);
+            void mulWiden(Parallel, const bfloat16* a, const bfloat16* b, float* c, const size_t l);
+            void mulWiden(const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<float>& c);
+            void mulWiden(Parallel, const aligned_vector<bfloat16>& a, const aligned_vector<bfloat16>& b, aligned_vector<float>& c);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::MulWiden, float> {
+                using type = void (*)(const float* a, const float* b, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void mulWiden(const std::vector<float>& a, const std::vector<float>& b, std::vector<double>& c);
+            template <size_t S>
+            void mulWiden(const std::array<float, S>& a, const std::array<float, S>& b, std::array<double, S>& c);
+            void mulWiden(const float* a, const float* b, double* c, const size_t l);
+            void mulWiden(Parallel, const std::vector<float>& a, const std::vector<float>& b, std::vector<double>& c);
+            void mulWiden(Parallel, const float* a, const float* b, double* c, const size_t l);
+            void mulWiden(const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<double>& c);
+            void mulWiden(Parallel, const aligned_vector<float>& a, const aligned_vector<float>& b, aligned_vector<double>& c);
+        #pragma endregion // float
+        
+        #define MUL_WIDEN(a, b, c) mulWiden(a, b, c, ezsimd::arrayLength(a))
+    #pragma endregion // mulWiden
+    
+    #pragma region // widen
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::Widen, int8_t> {
+                using type = void (*)(const int8_t* a, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void widen(const std::vector<int8_t>& a, std::vector<int16_t>& c);
+            template <size_t S>
+            void widen(const std::array<int8_t, S>& a, std::array<int16_t, S>& c);
+            void widen(const int8_t* a, int16_t* c, const size_t l);
+            void widen(Parallel, const std::vector<int8_t>& a, std::vector<int16_t>& c);
+            void widen(Parallel, const int8_t* a, int16_t* c, const size_t l);
+            void widen(const aligned_vector<int8_t>& a, aligned_vector<int16_t>& c);
+            void widen(Parallel, const aligned_vector<int8_t>& a, aligned_vector<int16_t>& c);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::Widen, int16_t> {
+                using type = void (*)(const int16_t* a, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void widen(const std::vector<int16_t>& a, std::vector<int32_t>& c);
+            template <size_t S>
+            void widen(const std::array<int16_t, S>& a, std::array<int32_t, S>& c);
+            void widen(const int16_t* a, int32_t* c, const size_t l);
+            void widen(Parallel, const std::vector<int16_t>& a, std::vector<int32_t>& c);
+            void widen(Parallel, const int16_t* a, int32_t* c, const size_t l);
+            void widen(const aligned_vector<int16_t>& a, aligned_vector<int32_t>& c);
+            void widen(Parallel, const aligned_vector<int16_t>& a, aligned_vector<int32_t>& c);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::Widen, int32_t> {
+                using type = void (*)(const int32_t* a, int64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void widen(const std::vector<int32_t>& a, std::vector<int64_t>& c);
+            template <size_t S>
+            void widen(const std::array<int32_t, S>& a, std::array<int64_t, S>& c);
+            void widen(const int32_t* a, int64_t* c, const size_t l);
+            void widen(Parallel, const std::vector<int32_t>& a, std::vector<int64_t>& c);
+            void widen(Parallel, const int32_t* a, int64_t* c, const size_t l);
+            void widen(const aligned_vector<int32_t>& a, aligned_vector<int64_t>& c);
+            void widen(Parallel, const aligned_vector<int32_t>& a, aligned_vector<int64_t>& c);
+        #pragma endregion // int32_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Widen, uint8_t> {
+                using type = void (*)(const uint8_t* a, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void widen(const std::vector<uint8_t>& a, std::vector<uint16_t>& c);
+            template <size_t S>
+            void widen(const std::array<uint8_t, S>& a, std::array<uint16_t, S>& c);
+            void widen(const uint8_t* a, uint16_t* c, const size_t l);
+            void widen(Parallel, const std::vector<uint8_t>& a, std::vector<uint16_t>& c);
+            void widen(Parallel, const uint8_t* a, uint16_t* c, const size_t l);
+            void widen(const aligned_vector<uint8_t>& a, aligned_vector<uint16_t>& c);
+            void widen(Parallel, const aligned_vector<uint8_t>& a, aligned_vector<uint16_t>& c);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Widen, uint16_t> {
+                using type = void (*)(const uint16_t* a, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void widen(const std::vector<uint16_t>& a, std::vector<uint32_t>& c);
+            template <size_t S>
+            void widen(const std::array<uint16_t, S>& a, std::array<uint32_t, S>& c);
+            void widen(const uint16_t* a, uint32_t* c, const size_t l);
+            void widen(Parallel, const std::vector<uint16_t>& a, std::vector<uint32_t>& c);
+            void widen(Parallel, const uint16_t* a, uint32_t* c, const size_t l);
+            void widen(const aligned_vector<uint16_t>& a, aligned_vector<uint32_t>& c);
+            void widen(Parallel, const aligned_vector<uint16_t>& a, aligned_vector<uint32_t>& c);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Widen, uint32_t> {
+                using type = void (*)(const uint32_t* a, uint64_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void widen(const std::vector<uint32_t>& a, std::vector<uint64_t>& c);
+            template <size_t S>
+            void widen(const std::array<uint32_t, S>& a, std::array<uint64_t, S>& c);
+            void widen(const uint32_t* a, uint64_t* c, const size_t l);
+            void widen(Parallel, const std::vector<uint32_t>& a, std::vector<uint64_t>& c);
+            void widen(Parallel, const uint32_t* a, uint64_t* c, const size_t l);
+            void widen(const aligned_vector<uint32_t>& a, aligned_vector<uint64_t>& c);
+            void widen(Parallel, const aligned_vector<uint32_t>& a, aligned_vector<uint64_t>& c);
+        #pragma endregion // uint32_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Widen, _Float16> {
+                using type = void (*)(const _Float16* a, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void widen(const std::vector<_Float16>& a, std::vector<float>& c);
+            template <size_t S>
+            void widen(const std::array<_Float16, S>& a, std::array<float, S>& c);
+            void widen(const _Float16* a, float* c, const size_t l);
+            void widen(Parallel, const std::vector<_Float16>& a, std::vector<float>& c);
+            void widen(Parallel, const _Float16* a, float* c, const size_t l);
+            void widen(const aligned_vector<_Float16>& a, aligned_vector<float>& c);
+            void widen(Parallel, const aligned_vector<_Float16>& a, aligned_vector<float>& c);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Widen, bfloat16> {
+                using type = void (*)(const bfloat16* a, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void widen(const std::vector<bfloat16>& a, std::vector<float>& c);
+            template <size_t S>
+            void widen(const std::array<bfloat16, S>& a, std::array<float, S>& c);
+            void widen(const bfloat16* a, float* c, const size_t l);
+            void widen(Parallel, const std::vector<bfloat16>& a, std::vector<float>& c);
+            void widen(Parallel, const bfloat16* a, float* c, const size_t l);
+            void widen(const aligned_vector<bfloat16>& a, aligned_vector<float>& c);
+            void widen(Parallel, const aligned_vector<bfloat16>& a, aligned_vector<float>& c);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::Widen, float> {
+                using type = void (*)(const float* a, double* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void widen(const std::vector<float>& a, std::vector<double>& c);
+            template <size_t S>
+            void widen(const std::array<float, S>& a, std::array<double, S>& c);
+            void widen(const float* a, double* c, const size_t l);
+            void widen(Parallel, const std::vector<float>& a, std::vector<double>& c);
+            void widen(Parallel, const float* a, double* c, const size_t l);
+            void widen(const aligned_vector<float>& a, aligned_vector<double>& c);
+            void widen(Parallel, const aligned_vector<float>& a, aligned_vector<double>& c);
+        #pragma endregion // float
+        
+        #define WIDEN(a, c) widen(a, c, ezsimd::arrayLength(a))
+    #pragma endregion // widen
+    
+    #pragma region // narrow
+        #pragma region // int8_t
+            template <>
+            struct Kernel<op::Narrow, int8_t> {
+                using type = void (*)(const int16_t* a, int8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void narrow(const std::vector<int16_t>& a, std::vector<int8_t>& c);
+            template <size_t S>
+            void narrow(const std::array<int16_t, S>& a, std::array<int8_t, S>& c);
+            void narrow(const int16_t* a, int8_t* c, const size_t l);
+            void narrow(Parallel, const std::vector<int16_t>& a, std::vector<int8_t>& c);
+            void narrow(Parallel, const int16_t* a, int8_t* c, const size_t l);
+            void narrow(const aligned_vector<int16_t>& a, aligned_vector<int8_t>& c);
+            void narrow(Parallel, const aligned_vector<int16_t>& a, aligned_vector<int8_t>& c);
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Kernel<op::Narrow, int16_t> {
+                using type = void (*)(const int32_t* a, int16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void narrow(const std::vector<int32_t>& a, std::vector<int16_t>& c);
+            template <size_t S>
+            void narrow(const std::array<int32_t, S>& a, std::array<int16_t, S>& c);
+            void narrow(const int32_t* a, int16_t* c, const size_t l);
+            void narrow(Parallel, const std::vector<int32_t>& a, std::vector<int16_t>& c);
+            void narrow(Parallel, const int32_t* a, int16_t* c, const size_t l);
+            void narrow(const aligned_vector<int32_t>& a, aligned_vector<int16_t>& c);
+            void narrow(Parallel, const aligned_vector<int32_t>& a, aligned_vector<int16_t>& c);
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Kernel<op::Narrow, int32_t> {
+                using type = void (*)(const int64_t* a, int32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void narrow(const std::vector<int64_t>& a, std::vector<int32_t>& c);
+            template <size_t S>
+            void narrow(const std::array<int64_t, S>& a, std::array<int32_t, S>& c);
+            void narrow(const int64_t* a, int32_t* c, const size_t l);
+            void narrow(Parallel, const std::vector<int64_t>& a, std::vector<int32_t>& c);
+            void narrow(Parallel, const int64_t* a, int32_t* c, const size_t l);
+            void narrow(const aligned_vector<int64_t>& a, aligned_vector<int32_t>& c);
+            void narrow(Parallel, const aligned_vector<int64_t>& a, aligned_vector<int32_t>& c);
+        #pragma endregion // int32_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Kernel<op::Narrow, uint8_t> {
+                using type = void (*)(const uint16_t* a, uint8_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void narrow(const std::vector<uint16_t>& a, std::vector<uint8_t>& c);
+            template <size_t S>
+            void narrow(const std::array<uint16_t, S>& a, std::array<uint8_t, S>& c);
+            void narrow(const uint16_t* a, uint8_t* c, const size_t l);
+            void narrow(Parallel, const std::vector<uint16_t>& a, std::vector<uint8_t>& c);
+            void narrow(Parallel, const uint16_t* a, uint8_t* c, const size_t l);
+            void narrow(const aligned_vector<uint16_t>& a, aligned_vector<uint8_t>& c);
+            void narrow(Parallel, const aligned_vector<uint16_t>& a, aligned_vector<uint8_t>& c);
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Kernel<op::Narrow, uint16_t> {
+                using type = void (*)(const uint32_t* a, uint16_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void narrow(const std::vector<uint32_t>& a, std::vector<uint16_t>& c);
+            template <size_t S>
+            void narrow(const std::array<uint32_t, S>& a, std::array<uint16_t, S>& c);
+            void narrow(const uint32_t* a, uint16_t* c, const size_t l);
+            void narrow(Parallel, const std::vector<uint32_t>& a, std::vector<uint16_t>& c);
+            void narrow(Parallel, const uint32_t* a, uint16_t* c, const size_t l);
+            void narrow(const aligned_vector<uint32_t>& a, aligned_vector<uint16_t>& c);
+            void narrow(Parallel, const aligned_vector<uint32_t>& a, aligned_vector<uint16_t>& c);
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Kernel<op::Narrow, uint32_t> {
+                using type = void (*)(const uint64_t* a, uint32_t* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void narrow(const std::vector<uint64_t>& a, std::vector<uint32_t>& c);
+            template <size_t S>
+            void narrow(const std::array<uint64_t, S>& a, std::array<uint32_t, S>& c);
+            void narrow(const uint64_t* a, uint32_t* c, const size_t l);
+            void narrow(Parallel, const std::vector<uint64_t>& a, std::vector<uint32_t>& c);
+            void narrow(Parallel, const uint64_t* a, uint32_t* c, const size_t l);
+            void narrow(const aligned_vector<uint64_t>& a, aligned_vector<uint32_t>& c);
+            void narrow(Parallel, const aligned_vector<uint64_t>& a, aligned_vector<uint32_t>& c);
+        #pragma endregion // uint32_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Kernel<op::Narrow, _Float16> {
+                using type = void (*)(const float* a, _Float16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void narrow(const std::vector<float>& a, std::vector<_Float16>& c);
+            template <size_t S>
+            void narrow(const std::array<float, S>& a, std::array<_Float16, S>& c);
+            void narrow(const float* a, _Float16* c, const size_t l);
+            void narrow(Parallel, const std::vector<float>& a, std::vector<_Float16>& c);
+            void narrow(Parallel, const float* a, _Float16* c, const size_t l);
+            void narrow(const aligned_vector<float>& a, aligned_vector<_Float16>& c);
+            void narrow(Parallel, const aligned_vector<float>& a, aligned_vector<_Float16>& c);
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Kernel<op::Narrow, bfloat16> {
+                using type = void (*)(const float* a, bfloat16* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void narrow(const std::vector<float>& a, std::vector<bfloat16>& c);
+            template <size_t S>
+            void narrow(const std::array<float, S>& a, std::array<bfloat16, S>& c);
+            void narrow(const float* a, bfloat16* c, const size_t l);
+            void narrow(Parallel, const std::vector<float>& a, std::vector<bfloat16>& c);
+            void narrow(Parallel, const float* a, bfloat16* c, const size_t l);
+            void narrow(const aligned_vector<float>& a, aligned_vector<bfloat16>& c);
+            void narrow(Parallel, const aligned_vector<float>& a, aligned_vector<bfloat16>& c);
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Kernel<op::Narrow, float> {
+                using type = void (*)(const double* a, float* c, const size_t l);
+                static type get();
+                static type get(Tier tier);
+            };
+            void narrow(const std::vector<double>& a, std::vector<float>& c);
+            template <size_t S>
+            void narrow(const std::array<double, S>& a, std::array<float, S>& c);
+            void narrow(const double* a, float* c, const size_t l);
+            void narrow(Parallel, const std::vector<double>& a, std::vector<float>& c);
+            void narrow(Parallel, const double* a, float* c, const size_t l);
+            void narrow(const aligned_vector<double>& a, aligned_vector<float>& c);
+            void narrow(Parallel, const aligned_vector<double>& a, aligned_vector<float>& c);
+        #pragma endregion // float
+        
+        #define NARROW(a, c) narrow(a, c, ezsimd::arrayLength(a))
+    #pragma endregion // narrow
 } // namespace ezsimd
 
 #include "libezsimd.tpp" // full definitions for templates declared in this file only
@@ -1,9 +1,26 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <cassert>
 #include <array>
+#include <new>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// same intrinsics headers as ezsimd.hpp, the std::array kernels are compiled into the calling file
+#if defined(__AVX__) || defined(__FMA__) || defined(EZSIMD_AVX512)
+    #include <immintrin.h>
+#endif
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+#if defined(__SSE__)
+    #include <xmmintrin.h>
+#endif
 
-// all backend functions are declared here so templated frontends can work properly
 // templated functions declared in libezsimd.hpp, defined in this file
 
 namespace ezsimd {
@@ -12,871 +29,6466 @@ namespace ezsimd {
         return N;
     }
     
+    template <typename Op, typename T>
+    typename Kernel<Op, T>::type dispatch() {
+        return Kernel<Op, T>::get();
+    }
+    
+    // a + b and a - b clamped to T's range instead of wrapping around, what adds and subs do for every element
+    template <typename T>
+    inline T addSaturate(const T a, const T b) {
+        T r;
+        if (__builtin_add_overflow(a, b, &r)) {
+            return r < a ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min(); // wrapped past the top or the bottom
+        }
+        
+        return r;
+    }
+    
+    template <typename T>
+    inline T subSaturate(const T a, const T b) {
+        T r;
+        if (__builtin_sub_overflow(a, b, &r)) {
+            return r > a ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+        }
+        
+        return r;
+    }
+    
+    #ifdef __SSE2__
+        // a / b on int32 lanes that fit in 16 bits, the float quotient is close enough that truncating it is exact
+        inline __m128i divSmallEpi32SSE2(const __m128i a, const __m128i b) {
+            return _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(a), _mm_cvtepi32_ps(b)));
+        }
+        
+        // packs two vectors of int32 lanes into int16 lanes keeping the low 16 bits, so -32768 / -1 wraps like the scalar loop
+        inline __m128i narrowEpi32SSE2(const __m128i lo, const __m128i hi) {
+            return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+        }
+        
+        // same for int16 lanes into int8 lanes
+        inline __m128i narrowEpi16SSE2(const __m128i lo, const __m128i hi) {
+            return _mm_packs_epi16(_mm_srai_epi16(_mm_slli_epi16(lo, 8), 8), _mm_srai_epi16(_mm_slli_epi16(hi, 8), 8));
+        }
+        
+        inline __m128i divInt16SSE2(const __m128i a, const __m128i b) {
+            const __m128i lo = divSmallEpi32SSE2(_mm_srai_epi32(_mm_unpacklo_epi16(a, a), 16), _mm_srai_epi32(_mm_unpacklo_epi16(b, b), 16));
+            const __m128i hi = divSmallEpi32SSE2(_mm_srai_epi32(_mm_unpackhi_epi16(a, a), 16), _mm_srai_epi32(_mm_unpackhi_epi16(b, b), 16));
+            return narrowEpi32SSE2(lo, hi);
+        }
+        
+        inline __m128i divUint16SSE2(const __m128i a, const __m128i b) {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i lo = divSmallEpi32SSE2(_mm_unpacklo_epi16(a, zero), _mm_unpacklo_epi16(b, zero));
+            const __m128i hi = divSmallEpi32SSE2(_mm_unpackhi_epi16(a, zero), _mm_unpackhi_epi16(b, zero));
+            return narrowEpi32SSE2(lo, hi);
+        }
+        
+        inline __m128i divInt8SSE2(const __m128i a, const __m128i b) {
+            const __m128i lo = divInt16SSE2(_mm_srai_epi16(_mm_unpacklo_epi8(a, a), 8), _mm_srai_epi16(_mm_unpacklo_epi8(b, b), 8));
+            const __m128i hi = divInt16SSE2(_mm_srai_epi16(_mm_unpackhi_epi8(a, a), 8), _mm_srai_epi16(_mm_unpackhi_epi8(b, b), 8));
+            return narrowEpi16SSE2(lo, hi);
+        }
+        
+        inline __m128i divUint8SSE2(const __m128i a, const __m128i b) {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i lo = divInt16SSE2(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+            const __m128i hi = divInt16SSE2(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+            return narrowEpi16SSE2(lo, hi);
+        }
+        
+        // int32 needs double, where the quotient of any two int32 values truncates exactly
+        inline __m128i divInt32SSE2(const __m128i a, const __m128i b) {
+            return _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(a), _mm_cvtepi32_pd(b))), _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(a, 0xEE)), _mm_cvtepi32_pd(_mm_shuffle_epi32(b, 0xEE)))));
+        }
+        
+        // uint32 lanes as double, flipping the top bit makes them int32 and the conversion is shifted back up
+        inline __m128d uint32LoSSE2(const __m128i x) {
+            return _mm_add_pd(_mm_cvtepi32_pd(_mm_xor_si128(x, _mm_set1_epi32(INT32_MIN))), _mm_set1_pd(2147483648.0));
+        }
+        
+        inline __m128d uint32HiSSE2(const __m128i x) {
+            return _mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(_mm_xor_si128(x, _mm_set1_epi32(INT32_MIN)), 0xEE)), _mm_set1_pd(2147483648.0));
+        }
+        
+        // a quotient of at least 2^31 means b was 1, so it is a whole number and subtracting 2^32 leaves the same low 32 bits
+        inline __m128d wrapUint32SSE2(const __m128d q) {
+            return _mm_sub_pd(q, _mm_and_pd(_mm_cmpge_pd(q, _mm_set1_pd(2147483648.0)), _mm_set1_pd(4294967296.0)));
+        }
+        
+        inline __m128i divUint32SSE2(const __m128i a, const __m128i b) {
+            return _mm_unpacklo_epi64(_mm_cvttpd_epi32(wrapUint32SSE2(_mm_div_pd(uint32LoSSE2(a), uint32LoSSE2(b)))), _mm_cvttpd_epi32(wrapUint32SSE2(_mm_div_pd(uint32HiSSE2(a), uint32HiSSE2(b)))));
+        }
+    #endif // __SSE2__
+    
+    #ifdef __AVX2__
+        // a / b on int32 lanes that fit in 16 bits, the float quotient is close enough that truncating it is exact
+        inline __m256i divSmallEpi32AVX2(const __m256i a, const __m256i b) {
+            return _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(a), _mm256_cvtepi32_ps(b)));
+        }
+        
+        // packs two vectors of int32 lanes into int16 lanes keeping the low 16 bits, so -32768 / -1 wraps like the scalar loop
+        inline __m256i narrowEpi32AVX2(const __m256i lo, const __m256i hi) {
+            return _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(lo, 16), 16), _mm256_srai_epi32(_mm256_slli_epi32(hi, 16), 16));
+        }
+        
+        // same for int16 lanes into int8 lanes
+        inline __m256i narrowEpi16AVX2(const __m256i lo, const __m256i hi) {
+            return _mm256_packs_epi16(_mm256_srai_epi16(_mm256_slli_epi16(lo, 8), 8), _mm256_srai_epi16(_mm256_slli_epi16(hi, 8), 8));
+        }
+        
+        inline __m256i divInt16AVX2(const __m256i a, const __m256i b) {
+            const __m256i lo = divSmallEpi32AVX2(_mm256_srai_epi32(_mm256_unpacklo_epi16(a, a), 16), _mm256_srai_epi32(_mm256_unpacklo_epi16(b, b), 16));
+            const __m256i hi = divSmallEpi32AVX2(_mm256_srai_epi32(_mm256_unpackhi_epi16(a, a), 16), _mm256_srai_epi32(_mm256_unpackhi_epi16(b, b), 16));
+            return narrowEpi32AVX2(lo, hi);
+        }
+        
+        inline __m256i divUint16AVX2(const __m256i a, const __m256i b) {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i lo = divSmallEpi32AVX2(_mm256_unpacklo_epi16(a, zero), _mm256_unpacklo_epi16(b, zero));
+            const __m256i hi = divSmallEpi32AVX2(_mm256_unpackhi_epi16(a, zero), _mm256_unpackhi_epi16(b, zero));
+            return narrowEpi32AVX2(lo, hi);
+        }
+        
+        inline __m256i divInt8AVX2(const __m256i a, const __m256i b) {
+            const __m256i lo = divInt16AVX2(_mm256_srai_epi16(_mm256_unpacklo_epi8(a, a), 8), _mm256_srai_epi16(_mm256_unpacklo_epi8(b, b), 8));
+            const __m256i hi = divInt16AVX2(_mm256_srai_epi16(_mm256_unpackhi_epi8(a, a), 8), _mm256_srai_epi16(_mm256_unpackhi_epi8(b, b), 8));
+            return narrowEpi16AVX2(lo, hi);
+        }
+        
+        inline __m256i divUint8AVX2(const __m256i a, const __m256i b) {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i lo = divInt16AVX2(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+            const __m256i hi = divInt16AVX2(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+            return narrowEpi16AVX2(lo, hi);
+        }
+        
+        // int32 needs double, where the quotient of any two int32 values truncates exactly
+        inline __m256i divInt32AVX2(const __m256i a, const __m256i b) {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(a)), _mm256_cvtepi32_pd(_mm256_castsi256_si128(b))))), _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(a, 1)), _mm256_cvtepi32_pd(_mm256_extracti128_si256(b, 1)))), 1);
+        }
+        
+        // uint32 lanes as double, flipping the top bit makes them int32 and the conversion is shifted back up
+        inline __m256d uint32LoAVX2(const __m256i x) {
+            return _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(_mm256_xor_si256(x, _mm256_set1_epi32(INT32_MIN)))), _mm256_set1_pd(2147483648.0));
+        }
+        
+        inline __m256d uint32HiAVX2(const __m256i x) {
+            return _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(_mm256_xor_si256(x, _mm256_set1_epi32(INT32_MIN)), 1)), _mm256_set1_pd(2147483648.0));
+        }
+        
+        // a quotient of at least 2^31 means b was 1, so it is a whole number and subtracting 2^32 leaves the same low 32 bits
+        inline __m256d wrapUint32AVX2(const __m256d q) {
+            return _mm256_sub_pd(q, _mm256_and_pd(_mm256_cmp_pd(q, _mm256_set1_pd(2147483648.0), _CMP_GE_OQ), _mm256_set1_pd(4294967296.0)));
+        }
+        
+        inline __m256i divUint32AVX2(const __m256i a, const __m256i b) {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(wrapUint32AVX2(_mm256_div_pd(uint32LoAVX2(a), uint32LoAVX2(b))))), _mm256_cvttpd_epi32(wrapUint32AVX2(_mm256_div_pd(uint32HiAVX2(a), uint32HiAVX2(b)))), 1);
+        }
+    #endif // __AVX2__
+    
+    #ifdef EZSIMD_AVX512
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+        #pragma GCC diagnostic ignored "-Wuninitialized"
+        // a / b on int32 lanes that fit in 16 bits, the float quotient is close enough that truncating it is exact
+        inline __m512i divSmallEpi32AVX512(const __m512i a, const __m512i b) {
+            return _mm512_cvttps_epi32(_mm512_div_ps(_mm512_cvtepi32_ps(a), _mm512_cvtepi32_ps(b)));
+        }
+        
+        // packs two vectors of int32 lanes into int16 lanes keeping the low 16 bits, so -32768 / -1 wraps like the scalar loop
+        inline __m512i narrowEpi32AVX512(const __m512i lo, const __m512i hi) {
+            return _mm512_packs_epi32(_mm512_srai_epi32(_mm512_slli_epi32(lo, 16), 16), _mm512_srai_epi32(_mm512_slli_epi32(hi, 16), 16));
+        }
+        
+        // same for int16 lanes into int8 lanes
+        inline __m512i narrowEpi16AVX512(const __m512i lo, const __m512i hi) {
+            return _mm512_packs_epi16(_mm512_srai_epi16(_mm512_slli_epi16(lo, 8), 8), _mm512_srai_epi16(_mm512_slli_epi16(hi, 8), 8));
+        }
+        
+        inline __m512i divInt16AVX512(const __m512i a, const __m512i b) {
+            const __m512i lo = divSmallEpi32AVX512(_mm512_srai_epi32(_mm512_unpacklo_epi16(a, a), 16), _mm512_srai_epi32(_mm512_unpacklo_epi16(b, b), 16));
+            const __m512i hi = divSmallEpi32AVX512(_mm512_srai_epi32(_mm512_unpackhi_epi16(a, a), 16), _mm512_srai_epi32(_mm512_unpackhi_epi16(b, b), 16));
+            return narrowEpi32AVX512(lo, hi);
+        }
+        
+        inline __m512i divUint16AVX512(const __m512i a, const __m512i b) {
+            const __m512i zero = _mm512_setzero_si512();
+            const __m512i lo = divSmallEpi32AVX512(_mm512_unpacklo_epi16(a, zero), _mm512_unpacklo_epi16(b, zero));
+            const __m512i hi = divSmallEpi32AVX512(_mm512_unpackhi_epi16(a, zero), _mm512_unpackhi_epi16(b, zero));
+            return narrowEpi32AVX512(lo, hi);
+        }
+        
+        inline __m512i divInt8AVX512(const __m512i a, const __m512i b) {
+            const __m512i lo = divInt16AVX512(_mm512_srai_epi16(_mm512_unpacklo_epi8(a, a), 8), _mm512_srai_epi16(_mm512_unpacklo_epi8(b, b), 8));
+            const __m512i hi = divInt16AVX512(_mm512_srai_epi16(_mm512_unpackhi_epi8(a, a), 8), _mm512_srai_epi16(_mm512_unpackhi_epi8(b, b), 8));
+            return narrowEpi16AVX512(lo, hi);
+        }
+        
+        inline __m512i divUint8AVX512(const __m512i a, const __m512i b) {
+            const __m512i zero = _mm512_setzero_si512();
+            const __m512i lo = divInt16AVX512(_mm512_unpacklo_epi8(a, zero), _mm512_unpacklo_epi8(b, zero));
+            const __m512i hi = divInt16AVX512(_mm512_unpackhi_epi8(a, zero), _mm512_unpackhi_epi8(b, zero));
+            return narrowEpi16AVX512(lo, hi);
+        }
+        
+        // int32 needs double, where the quotient of any two int32 values truncates exactly
+        inline __m512i divInt32AVX512(const __m512i a, const __m512i b) {
+            return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(_mm512_div_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(a)), _mm512_cvtepi32_pd(_mm512_castsi512_si256(b))))), _mm512_cvttpd_epi32(_mm512_div_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(a, 1)), _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(b, 1)))), 1);
+        }
+        
+        inline __m512i divUint32AVX512(const __m512i a, const __m512i b) {
+            const __m512d lo = _mm512_div_pd(_mm512_cvtepu32_pd(_mm512_castsi512_si256(a)), _mm512_cvtepu32_pd(_mm512_castsi512_si256(b)));
+            const __m512d hi = _mm512_div_pd(_mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(a, 1)), _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(b, 1)));
+            return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epu32(lo)), _mm512_cvttpd_epu32(hi), 1);
+        }
+        #pragma GCC diagnostic pop
+    #endif // EZSIMD_AVX512
+    
+    #ifdef EZSIMD_F16C
+        // 8 floats to bfloat16 bits, rounded to nearest even the same way as the bfloat16(float) conversion
+        inline __m128i narrowBf16F16C(const __m256 vec) {
+            const __m256i u = _mm256_castps_si256(vec);
+            const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(1));
+            const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(u, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), odd)), 16);
+            const __m256i nan = _mm256_or_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(0x40));
+            const __m256i bits = _mm256_blendv_epi8(rounded, nan, _mm256_castps_si256(_mm256_cmp_ps(vec, vec, _CMP_UNORD_Q)));
+            return _mm_packus_epi32(_mm256_castsi256_si128(bits), _mm256_extracti128_si256(bits, 1));
+        }
+    #endif // EZSIMD_F16C
+    
+    // Fixed<Isa, Op, T> has lanes, load, set1, apply, and store when Isa's functions support Op on T,
+    // Fixed<void, Op, T> has the scalar apply
+    template <typename Isa, typename Op, typename T>
+    struct Fixed {
+        static constexpr size_t lanes = 0;
+    };
+    
+    // next instruction set to try once Isa can't fill a whole vector, void is scalar
+    template <typename Isa>
+    struct NarrowerIsa;
+    
+    template <typename T>
+    inline T fixedElement(const T* arg, size_t i) {
+        return arg[i];
+    }
+    
+    template <typename T>
+    inline T fixedElement(const T arg, size_t) {
+        return arg;
+    }
+    
+    template <typename F, typename T>
+    inline auto fixedVector(const T* arg, size_t i) {
+        return F::load(arg + i);
+    }
+    
+    template <typename F, typename T>
+    inline auto fixedVector(const T arg, size_t) {
+        return F::set1(arg);
+    }
+    
+    // result[begin, S) = op(args) with as many whole Isa vectors as fit, then the narrower instruction sets for the rest,
+    // all counts are known at compile time so nothing is left to check at runtime
+    template <typename Isa, typename Op, size_t S, size_t begin, typename T, typename... Args>
+    inline void fixedKernel(T* result, const Args... args) {
+        if constexpr (std::is_void<Isa>::value) {
+            #pragma GCC unroll 16
+            for (size_t i = begin; i < S; i++) {
+                result[i] = Fixed<void, Op, T>::apply(fixedElement(args, i)...);
+            }
+        } else {
+            using F = Fixed<Isa, Op, T>;
+            constexpr size_t end = F::lanes == 0 ? begin : begin + (S - begin) / F::lanes * F::lanes;
+            
+            if constexpr (end != begin) {
+                #pragma GCC unroll 16
+                for (size_t i = begin; i < end; i += F::lanes) {
+                    F::store(result + i, F::apply(fixedVector<F>(args, i)...));
+                }
+            }
+            
+            if constexpr (end != S) {
+                fixedKernel<typename NarrowerIsa<Isa>::type, Op, S, end>(result, args...);
+            }
+        }
+    }
+    
+    // fixedKernel from Isa, or from the widest narrower instruction set that cap allows when Isa is newer than cap
+    template <typename Isa, typename Op, size_t S, typename T, typename... Args>
+    inline void fixedCapped(const Tier cap, T* result, const Args... args) {
+        if constexpr (std::is_void<Isa>::value) {
+            fixedKernel<void, Op, S, 0>(result, args...);
+        } else {
+            if (Isa::tier <= cap) {
+                fixedKernel<Isa, Op, S, 0>(result, args...);
+            } else {
+                fixedCapped<typename NarrowerIsa<Isa>::type, Op, S>(cap, result, args...);
+            }
+        }
+    }
+    
+    template <>
+    struct NarrowerIsa<isa::AVX512FP16> {
+        using type = isa::AVX512BF16;
+    };
+    
+    template <>
+    struct NarrowerIsa<isa::AVX512BF16> {
+        using type = isa::AVX512;
+    };
+    
+    template <>
+    struct NarrowerIsa<isa::AVX512> {
+        using type = isa::F16C;
+    };
+    
+    template <>
+    struct NarrowerIsa<isa::F16C> {
+        using type = isa::FMA;
+    };
+    
+    template <>
+    struct NarrowerIsa<isa::FMA> {
+        using type = isa::AVX2;
+    };
+    
+    template <>
+    struct NarrowerIsa<isa::AVX2> {
+        using type = isa::AVX;
+    };
+    
+    template <>
+    struct NarrowerIsa<isa::AVX> {
+        using type = isa::SSE2;
+    };
+    
+    template <>
+    struct NarrowerIsa<isa::SSE2> {
+        using type = isa::SSE;
+    };
+    
+    template <>
+    struct NarrowerIsa<isa::SSE> {
+        using type = void;
+    };
+    
     #pragma region // add
         #pragma region // int8_t
-            __attribute__((target("default")))
-            inline void addBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void addBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void addBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Add, int8_t> {
+                static int8_t apply(const int8_t a, const int8_t b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, int8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_add_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m512i vec) {[](int8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void addBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Add, int8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_add_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m256i vec) {[](int8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Add, int8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_add_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m128i vec) {[](int8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, int8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, int8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<int8_t, S>& a, const int8_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // int8_t
 
         #pragma region // int16_t
-            __attribute__((target("default")))
-            inline void addBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void addBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void addBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Add, int16_t> {
+                static int16_t apply(const int16_t a, const int16_t b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, int16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_add_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m512i vec) {[](int16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void addBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Add, int16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_add_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m256i vec) {[](int16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Add, int16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_add_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m128i vec) {[](int16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, int16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, int16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<int16_t, S>& a, const int16_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // int16_t
 
         #pragma region // int32_t
-            __attribute__((target("default")))
-            inline void addBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void addBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void addBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Add, int32_t> {
+                static int32_t apply(const int32_t a, const int32_t b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, int32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_add_epi32(a, b);}
+                    static void store(int32_t* ptr, const __m512i vec) {[](int32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void addBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Add, int32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_add_epi32(a, b);}
+                    static void store(int32_t* ptr, const __m256i vec) {[](int32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Add, int32_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m128i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int32_t value) {return _mm_set1_epi32(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_add_epi32(a, b);}
+                    static void store(int32_t* ptr, const __m128i vec) {[](int32_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, int32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, int32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<int32_t, S>& a, const int32_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // int32_t
 
         #pragma region // int64_t
-            __attribute__((target("default")))
-            inline void addBackend(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void addBackend(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Add, int64_t> {
+                static int64_t apply(const int64_t a, const int64_t b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, int64_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m512i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int64_t value) {return _mm512_set1_epi64(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_add_epi64(a, b);}
+                    static void store(int64_t* ptr, const __m512i vec) {[](int64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void addBackend(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Add, int64_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m256i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int64_t value) {return _mm256_set1_epi64x(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_add_epi64(a, b);}
+                    static void store(int64_t* ptr, const __m256i vec) {[](int64_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Add, int64_t> {
+                    static constexpr size_t lanes = 2;
+                    static __m128i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int64_t value) {return _mm_set1_epi64x(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_add_epi64(a, b);}
+                    static void store(int64_t* ptr, const __m128i vec) {[](int64_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, int64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, int64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<int64_t, S>& a, const int64_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // int64_t
 
         #pragma region // __int128_t
-            __attribute__((target("default")))
-            inline void addBackend(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            template <>
+            struct Fixed<void, op::Add, __int128_t> {
+                static __int128_t apply(const __int128_t a, const __int128_t b) {return a + b;}
+            };
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, __int128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, __int128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<__int128_t, S>& a, const __int128_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // __int128_t
 
         #pragma region // uint8_t
-            __attribute__((target("default")))
-            inline void addBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void addBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void addBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Add, uint8_t> {
+                static uint8_t apply(const uint8_t a, const uint8_t b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, uint8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_add_epi8(a, b);}
+                    static void store(uint8_t* ptr, const __m512i vec) {[](uint8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void addBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Add, uint8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_add_epi8(a, b);}
+                    static void store(uint8_t* ptr, const __m256i vec) {[](uint8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Add, uint8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_add_epi8(a, b);}
+                    static void store(uint8_t* ptr, const __m128i vec) {[](uint8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, uint8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, uint8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<uint8_t, S>& a, const uint8_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // uint8_t
 
         #pragma region // uint16_t
-            __attribute__((target("default")))
-            inline void addBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void addBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void addBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Add, uint16_t> {
+                static uint16_t apply(const uint16_t a, const uint16_t b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, uint16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_add_epi16(a, b);}
+                    static void store(uint16_t* ptr, const __m512i vec) {[](uint16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void addBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Add, uint16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_add_epi16(a, b);}
+                    static void store(uint16_t* ptr, const __m256i vec) {[](uint16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Add, uint16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_add_epi16(a, b);}
+                    static void store(uint16_t* ptr, const __m128i vec) {[](uint16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, uint16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, uint16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<uint16_t, S>& a, const uint16_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // uint16_t
 
         #pragma region // uint32_t
-            __attribute__((target("default")))
-            inline void addBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void addBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void addBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Add, uint32_t> {
+                static uint32_t apply(const uint32_t a, const uint32_t b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, uint32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_add_epi32(a, b);}
+                    static void store(uint32_t* ptr, const __m512i vec) {[](uint32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void addBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Add, uint32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_add_epi32(a, b);}
+                    static void store(uint32_t* ptr, const __m256i vec) {[](uint32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Add, uint32_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m128i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint32_t value) {return _mm_set1_epi32(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_add_epi32(a, b);}
+                    static void store(uint32_t* ptr, const __m128i vec) {[](uint32_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, uint32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, uint32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<uint32_t, S>& a, const uint32_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // uint32_t
 
         #pragma region // uint64_t
-            __attribute__((target("default")))
-            inline void addBackend(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void addBackend(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Add, uint64_t> {
+                static uint64_t apply(const uint64_t a, const uint64_t b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, uint64_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m512i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint64_t value) {return _mm512_set1_epi64(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_add_epi64(a, b);}
+                    static void store(uint64_t* ptr, const __m512i vec) {[](uint64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void addBackend(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Add, uint64_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m256i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint64_t value) {return _mm256_set1_epi64x(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_add_epi64(a, b);}
+                    static void store(uint64_t* ptr, const __m256i vec) {[](uint64_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Add, uint64_t> {
+                    static constexpr size_t lanes = 2;
+                    static __m128i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint64_t value) {return _mm_set1_epi64x(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_add_epi64(a, b);}
+                    static void store(uint64_t* ptr, const __m128i vec) {[](uint64_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, uint64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, uint64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<uint64_t, S>& a, const uint64_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // uint64_t
 
         #pragma region // __uint128_t
-            __attribute__((target("default")))
-            inline void addBackend(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            template <>
+            struct Fixed<void, op::Add, __uint128_t> {
+                static __uint128_t apply(const __uint128_t a, const __uint128_t b) {return a + b;}
+            };
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, __uint128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, __uint128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<__uint128_t, S>& a, const __uint128_t b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // __uint128_t
 
-        #pragma region // float
-            __attribute__((target("default")))
-            inline void addBackend(const float* a, const float* b, float* c, const size_t l);
-
-            #ifdef __SSE__
-                __attribute__((target("sse")))
-                inline void addBackend(const float* a, const float* b, float* c, const size_t l);
-            #endif // __SSE__
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Fixed<void, op::Add, _Float16> {
+                static _Float16 apply(const _Float16 a, const _Float16 b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512FP16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512FP16, op::Add, _Float16> {
+                    static constexpr size_t lanes = 32;
+                    static __m512h load(const _Float16* ptr) {return _mm512_loadu_ph(ptr);}
+                    static __m512h set1(const _Float16 value) {return _mm512_set1_ph(value);}
+                    static __m512h apply(const __m512h a, const __m512h b) {return _mm512_add_ph(a, b);}
+                    static void store(_Float16* ptr, const __m512h vec) {_mm512_storeu_ph(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512FP16
+            #ifdef EZSIMD_F16C
+                template <>
+                struct Fixed<isa::F16C, op::Add, _Float16> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const _Float16* ptr) {return [](const _Float16* ptr) {return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}(ptr);}
+                    static __m256 set1(const _Float16 value) {return [](const _Float16 value) {return _mm256_set1_ps(static_cast<float>(value));}(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_add_ps(a, b);}
+                    static void store(_Float16* ptr, const __m256 vec) {[](_Float16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));}(ptr, vec);}
+                };
+            #endif // EZSIMD_F16C
+
+            template <size_t S, typename Isa>
+            void add(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<_Float16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, _Float16>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<_Float16, S>& a, const std::array<_Float16, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<_Float16, S>& a, const _Float16 b, std::array<_Float16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, _Float16>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<_Float16, S>& a, const _Float16 b) {
+                add<S, Isa>(a, b, a);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Fixed<void, op::Add, bfloat16> {
+                static bfloat16 apply(const bfloat16 a, const bfloat16 b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512BF16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512BF16, op::Add, bfloat16> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const bfloat16* ptr) {return [](const bfloat16* ptr) {return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));}(ptr);}
+                    static __m512 set1(const bfloat16 value) {return [](const bfloat16 value) {return _mm512_set1_ps(static_cast<float>(value));}(value);}
+                    static __m512 apply(const __m512 a, const __m512 b) {return _mm512_add_ps(a, b);}
+                    static void store(bfloat16* ptr, const __m512 vec) {[](bfloat16* ptr, const __m512 vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reinterpret_cast<__m256i>(_mm512_cvtneps_pbh(vec)));}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512BF16
+            #ifdef EZSIMD_F16C
+                template <>
+                struct Fixed<isa::F16C, op::Add, bfloat16> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const bfloat16* ptr) {return [](const bfloat16* ptr) {return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))), 16));}(ptr);}
+                    static __m256 set1(const bfloat16 value) {return [](const bfloat16 value) {return _mm256_set1_ps(static_cast<float>(value));}(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_add_ps(a, b);}
+                    static void store(bfloat16* ptr, const __m256 vec) {[](bfloat16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), narrowBf16F16C(vec));}(ptr, vec);}
+                };
+            #endif // EZSIMD_F16C
+
+            template <size_t S, typename Isa>
+            void add(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<bfloat16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, bfloat16>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<bfloat16, S>& a, const bfloat16 b, std::array<bfloat16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, bfloat16>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<bfloat16, S>& a, const bfloat16 b) {
+                add<S, Isa>(a, b, a);
+            }
+        #pragma endregion // bfloat16
 
+        #pragma region // float
+            template <>
+            struct Fixed<void, op::Add, float> {
+                static float apply(const float a, const float b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, float> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const float* ptr) {return _mm512_loadu_ps(ptr);}
+                    static __m512 set1(const float value) {return _mm512_set1_ps(value);}
+                    static __m512 apply(const __m512 a, const __m512 b) {return _mm512_add_ps(a, b);}
+                    static void store(float* ptr, const __m512 vec) {_mm512_storeu_ps(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX__
-                __attribute__((target("avx")))
-                inline void addBackend(const float* a, const float* b, float* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX, op::Add, float> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const float* ptr) {return _mm256_loadu_ps(ptr);}
+                    static __m256 set1(const float value) {return _mm256_set1_ps(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_add_ps(a, b);}
+                    static void store(float* ptr, const __m256 vec) {_mm256_storeu_ps(ptr, vec);}
+                };
             #endif // __AVX__
+            #ifdef __SSE__
+                template <>
+                struct Fixed<isa::SSE, op::Add, float> {
+                    static constexpr size_t lanes = 4;
+                    static __m128 load(const float* ptr) {return _mm_loadu_ps(ptr);}
+                    static __m128 set1(const float value) {return _mm_set1_ps(value);}
+                    static __m128 apply(const __m128 a, const __m128 b) {return _mm_add_ps(a, b);}
+                    static void store(float* ptr, const __m128 vec) {_mm_storeu_ps(ptr, vec);}
+                };
+            #endif // __SSE__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, float>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<float, S>& a, const std::array<float, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<float, S>& a, const float b, std::array<float, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, float>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<float, S>& a, const float b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // float
 
         #pragma region // double
-            __attribute__((target("default")))
-            inline void addBackend(const double* a, const double* b, double* c, const size_t l);
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void addBackend(const double* a, const double* b, double* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Add, double> {
+                static double apply(const double a, const double b) {return a + b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Add, double> {
+                    static constexpr size_t lanes = 8;
+                    static __m512d load(const double* ptr) {return _mm512_loadu_pd(ptr);}
+                    static __m512d set1(const double value) {return _mm512_set1_pd(value);}
+                    static __m512d apply(const __m512d a, const __m512d b) {return _mm512_add_pd(a, b);}
+                    static void store(double* ptr, const __m512d vec) {_mm512_storeu_pd(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX__
-                __attribute__((target("avx")))
-                inline void addBackend(const double* a, const double* b, double* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX, op::Add, double> {
+                    static constexpr size_t lanes = 4;
+                    static __m256d load(const double* ptr) {return _mm256_loadu_pd(ptr);}
+                    static __m256d set1(const double value) {return _mm256_set1_pd(value);}
+                    static __m256d apply(const __m256d a, const __m256d b) {return _mm256_add_pd(a, b);}
+                    static void store(double* ptr, const __m256d vec) {_mm256_storeu_pd(ptr, vec);}
+                };
             #endif // __AVX__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Add, double> {
+                    static constexpr size_t lanes = 2;
+                    static __m128d load(const double* ptr) {return _mm_loadu_pd(ptr);}
+                    static __m128d set1(const double value) {return _mm_set1_pd(value);}
+                    static __m128d apply(const __m128d a, const __m128d b) {return _mm_add_pd(a, b);}
+                    static void store(double* ptr, const __m128d vec) {_mm_storeu_pd(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, double>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<double, S>& a, const std::array<double, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<double, S>& a, const double b, std::array<double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, double>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<double, S>& a, const double b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // double
 
         #pragma region // long double
-            __attribute__((target("default")))
-            inline void addBackend(const long double* a, const long double* b, long double* c, const size_t l);
+            template <>
+            struct Fixed<void, op::Add, long double> {
+                static long double apply(const long double a, const long double b) {return a + b;}
+            };
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void add(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c) {
-                addBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Add, long double>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<long double, S>& a, const std::array<long double, S>& b) {
+                add<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void add(const std::array<long double, S>& a, const long double b, std::array<long double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddScalar, long double>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Add, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addInplace(std::array<long double, S>& a, const long double b) {
+                add<S, Isa>(a, b, a);
             }
         #pragma endregion // long double
     #pragma endregion // add
     
     #pragma region // sub
         #pragma region // int8_t
-            __attribute__((target("default")))
-            inline void subBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void subBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void subBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Sub, int8_t> {
+                static int8_t apply(const int8_t a, const int8_t b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, int8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_sub_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m512i vec) {[](int8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void subBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Sub, int8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_sub_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m256i vec) {[](int8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Sub, int8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_sub_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m128i vec) {[](int8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, int8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, int8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<int8_t, S>& a, const int8_t b) {
+                sub<S, Isa>(a, b, a);
             }
         #pragma endregion // int8_t
 
         #pragma region // int16_t
-            __attribute__((target("default")))
-            inline void subBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void subBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void subBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Sub, int16_t> {
+                static int16_t apply(const int16_t a, const int16_t b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, int16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_sub_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m512i vec) {[](int16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void subBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Sub, int16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_sub_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m256i vec) {[](int16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Sub, int16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_sub_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m128i vec) {[](int16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, int16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, int16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<int16_t, S>& a, const int16_t b) {
+                sub<S, Isa>(a, b, a);
             }
         #pragma endregion // int16_t
 
         #pragma region // int32_t
-            __attribute__((target("default")))
-            inline void subBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void subBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void subBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Sub, int32_t> {
+                static int32_t apply(const int32_t a, const int32_t b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, int32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_sub_epi32(a, b);}
+                    static void store(int32_t* ptr, const __m512i vec) {[](int32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void subBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Sub, int32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_sub_epi32(a, b);}
+                    static void store(int32_t* ptr, const __m256i vec) {[](int32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Sub, int32_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m128i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int32_t value) {return _mm_set1_epi32(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_sub_epi32(a, b);}
+                    static void store(int32_t* ptr, const __m128i vec) {[](int32_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, int32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, int32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<int32_t, S>& a, const int32_t b) {
+                sub<S, Isa>(a, b, a);
             }
         #pragma endregion // int32_t
 
         #pragma region // int64_t
-            __attribute__((target("default")))
-            inline void subBackend(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void subBackend(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Sub, int64_t> {
+                static int64_t apply(const int64_t a, const int64_t b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, int64_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m512i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int64_t value) {return _mm512_set1_epi64(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_sub_epi64(a, b);}
+                    static void store(int64_t* ptr, const __m512i vec) {[](int64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void subBackend(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Sub, int64_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m256i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int64_t value) {return _mm256_set1_epi64x(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_sub_epi64(a, b);}
+                    static void store(int64_t* ptr, const __m256i vec) {[](int64_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Sub, int64_t> {
+                    static constexpr size_t lanes = 2;
+                    static __m128i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int64_t value) {return _mm_set1_epi64x(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_sub_epi64(a, b);}
+                    static void store(int64_t* ptr, const __m128i vec) {[](int64_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, int64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, int64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<int64_t, S>& a, const int64_t b) {
+                sub<S, Isa>(a, b, a);
             }
         #pragma endregion // int64_t
 
         #pragma region // __int128_t
-            __attribute__((target("default")))
-            inline void subBackend(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+            template <>
+            struct Fixed<void, op::Sub, __int128_t> {
+                static __int128_t apply(const __int128_t a, const __int128_t b) {return a - b;}
+            };
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, __int128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, __int128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<__int128_t, S>& a, const __int128_t b) {
+                sub<S, Isa>(a, b, a);
             }
         #pragma endregion // __int128_t
 
         #pragma region // uint8_t
-            __attribute__((target("default")))
-            inline void subBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void subBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void subBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Sub, uint8_t> {
+                static uint8_t apply(const uint8_t a, const uint8_t b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, uint8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_sub_epi8(a, b);}
+                    static void store(uint8_t* ptr, const __m512i vec) {[](uint8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void subBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Sub, uint8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_sub_epi8(a, b);}
+                    static void store(uint8_t* ptr, const __m256i vec) {[](uint8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Sub, uint8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_sub_epi8(a, b);}
+                    static void store(uint8_t* ptr, const __m128i vec) {[](uint8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, uint8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, uint8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<uint8_t, S>& a, const uint8_t b) {
+                sub<S, Isa>(a, b, a);
             }
         #pragma endregion // uint8_t
 
         #pragma region // uint16_t
-            __attribute__((target("default")))
-            inline void subBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void subBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void subBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Sub, uint16_t> {
+                static uint16_t apply(const uint16_t a, const uint16_t b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, uint16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_sub_epi16(a, b);}
+                    static void store(uint16_t* ptr, const __m512i vec) {[](uint16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void subBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Sub, uint16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_sub_epi16(a, b);}
+                    static void store(uint16_t* ptr, const __m256i vec) {[](uint16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Sub, uint16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_sub_epi16(a, b);}
+                    static void store(uint16_t* ptr, const __m128i vec) {[](uint16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, uint16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, uint16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<uint16_t, S>& a, const uint16_t b) {
+                sub<S, Isa>(a, b, a);
             }
         #pragma endregion // uint16_t
 
         #pragma region // uint32_t
-            __attribute__((target("default")))
-            inline void subBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void subBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void subBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Sub, uint32_t> {
+                static uint32_t apply(const uint32_t a, const uint32_t b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, uint32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_sub_epi32(a, b);}
+                    static void store(uint32_t* ptr, const __m512i vec) {[](uint32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void subBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Sub, uint32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_sub_epi32(a, b);}
+                    static void store(uint32_t* ptr, const __m256i vec) {[](uint32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Sub, uint32_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m128i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint32_t value) {return _mm_set1_epi32(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_sub_epi32(a, b);}
+                    static void store(uint32_t* ptr, const __m128i vec) {[](uint32_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, uint32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, uint32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<uint32_t, S>& a, const uint32_t b) {
+                sub<S, Isa>(a, b, a);
             }
         #pragma endregion // uint32_t
 
         #pragma region // uint64_t
-            __attribute__((target("default")))
-            inline void subBackend(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void subBackend(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
-            #endif // __SSE2__
-
+            template <>
+            struct Fixed<void, op::Sub, uint64_t> {
+                static uint64_t apply(const uint64_t a, const uint64_t b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, uint64_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m512i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint64_t value) {return _mm512_set1_epi64(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_sub_epi64(a, b);}
+                    static void store(uint64_t* ptr, const __m512i vec) {[](uint64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
             #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void subBackend(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+                template <>
+                struct Fixed<isa::AVX2, op::Sub, uint64_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m256i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint64_t value) {return _mm256_set1_epi64x(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_sub_epi64(a, b);}
+                    static void store(uint64_t* ptr, const __m256i vec) {[](uint64_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
             #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Sub, uint64_t> {
+                    static constexpr size_t lanes = 2;
+                    static __m128i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint64_t value) {return _mm_set1_epi64x(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_sub_epi64(a, b);}
+                    static void store(uint64_t* ptr, const __m128i vec) {[](uint64_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, uint64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, uint64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<uint64_t, S>& a, const uint64_t b) {
+                sub<S, Isa>(a, b, a);
             }
         #pragma endregion // uint64_t
 
         #pragma region // __uint128_t
-            __attribute__((target("default")))
-            inline void subBackend(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+            template <>
+            struct Fixed<void, op::Sub, __uint128_t> {
+                static __uint128_t apply(const __uint128_t a, const __uint128_t b) {return a - b;}
+            };
 
-            template <size_t S>
+            template <size_t S, typename Isa>
             void sub(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, __uint128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
             }
-        #pragma endregion // __uint128_t
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, __uint128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<__uint128_t, S>& a, const __uint128_t b) {
+                sub<S, Isa>(a, b, a);
+            }
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Fixed<void, op::Sub, _Float16> {
+                static _Float16 apply(const _Float16 a, const _Float16 b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512FP16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512FP16, op::Sub, _Float16> {
+                    static constexpr size_t lanes = 32;
+                    static __m512h load(const _Float16* ptr) {return _mm512_loadu_ph(ptr);}
+                    static __m512h set1(const _Float16 value) {return _mm512_set1_ph(value);}
+                    static __m512h apply(const __m512h a, const __m512h b) {return _mm512_sub_ph(a, b);}
+                    static void store(_Float16* ptr, const __m512h vec) {_mm512_storeu_ph(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512FP16
+            #ifdef EZSIMD_F16C
+                template <>
+                struct Fixed<isa::F16C, op::Sub, _Float16> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const _Float16* ptr) {return [](const _Float16* ptr) {return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}(ptr);}
+                    static __m256 set1(const _Float16 value) {return [](const _Float16 value) {return _mm256_set1_ps(static_cast<float>(value));}(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_sub_ps(a, b);}
+                    static void store(_Float16* ptr, const __m256 vec) {[](_Float16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));}(ptr, vec);}
+                };
+            #endif // EZSIMD_F16C
+
+            template <size_t S, typename Isa>
+            void sub(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<_Float16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, _Float16>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<_Float16, S>& a, const std::array<_Float16, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<_Float16, S>& a, const _Float16 b, std::array<_Float16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, _Float16>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<_Float16, S>& a, const _Float16 b) {
+                sub<S, Isa>(a, b, a);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Fixed<void, op::Sub, bfloat16> {
+                static bfloat16 apply(const bfloat16 a, const bfloat16 b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512BF16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512BF16, op::Sub, bfloat16> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const bfloat16* ptr) {return [](const bfloat16* ptr) {return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));}(ptr);}
+                    static __m512 set1(const bfloat16 value) {return [](const bfloat16 value) {return _mm512_set1_ps(static_cast<float>(value));}(value);}
+                    static __m512 apply(const __m512 a, const __m512 b) {return _mm512_sub_ps(a, b);}
+                    static void store(bfloat16* ptr, const __m512 vec) {[](bfloat16* ptr, const __m512 vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reinterpret_cast<__m256i>(_mm512_cvtneps_pbh(vec)));}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512BF16
+            #ifdef EZSIMD_F16C
+                template <>
+                struct Fixed<isa::F16C, op::Sub, bfloat16> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const bfloat16* ptr) {return [](const bfloat16* ptr) {return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))), 16));}(ptr);}
+                    static __m256 set1(const bfloat16 value) {return [](const bfloat16 value) {return _mm256_set1_ps(static_cast<float>(value));}(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_sub_ps(a, b);}
+                    static void store(bfloat16* ptr, const __m256 vec) {[](bfloat16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), narrowBf16F16C(vec));}(ptr, vec);}
+                };
+            #endif // EZSIMD_F16C
+
+            template <size_t S, typename Isa>
+            void sub(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<bfloat16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, bfloat16>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<bfloat16, S>& a, const bfloat16 b, std::array<bfloat16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, bfloat16>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<bfloat16, S>& a, const bfloat16 b) {
+                sub<S, Isa>(a, b, a);
+            }
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Fixed<void, op::Sub, float> {
+                static float apply(const float a, const float b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, float> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const float* ptr) {return _mm512_loadu_ps(ptr);}
+                    static __m512 set1(const float value) {return _mm512_set1_ps(value);}
+                    static __m512 apply(const __m512 a, const __m512 b) {return _mm512_sub_ps(a, b);}
+                    static void store(float* ptr, const __m512 vec) {_mm512_storeu_ps(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX__
+                template <>
+                struct Fixed<isa::AVX, op::Sub, float> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const float* ptr) {return _mm256_loadu_ps(ptr);}
+                    static __m256 set1(const float value) {return _mm256_set1_ps(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_sub_ps(a, b);}
+                    static void store(float* ptr, const __m256 vec) {_mm256_storeu_ps(ptr, vec);}
+                };
+            #endif // __AVX__
+            #ifdef __SSE__
+                template <>
+                struct Fixed<isa::SSE, op::Sub, float> {
+                    static constexpr size_t lanes = 4;
+                    static __m128 load(const float* ptr) {return _mm_loadu_ps(ptr);}
+                    static __m128 set1(const float value) {return _mm_set1_ps(value);}
+                    static __m128 apply(const __m128 a, const __m128 b) {return _mm_sub_ps(a, b);}
+                    static void store(float* ptr, const __m128 vec) {_mm_storeu_ps(ptr, vec);}
+                };
+            #endif // __SSE__
+
+            template <size_t S, typename Isa>
+            void sub(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, float>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<float, S>& a, const std::array<float, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<float, S>& a, const float b, std::array<float, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, float>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<float, S>& a, const float b) {
+                sub<S, Isa>(a, b, a);
+            }
+        #pragma endregion // float
+
+        #pragma region // double
+            template <>
+            struct Fixed<void, op::Sub, double> {
+                static double apply(const double a, const double b) {return a - b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Sub, double> {
+                    static constexpr size_t lanes = 8;
+                    static __m512d load(const double* ptr) {return _mm512_loadu_pd(ptr);}
+                    static __m512d set1(const double value) {return _mm512_set1_pd(value);}
+                    static __m512d apply(const __m512d a, const __m512d b) {return _mm512_sub_pd(a, b);}
+                    static void store(double* ptr, const __m512d vec) {_mm512_storeu_pd(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX__
+                template <>
+                struct Fixed<isa::AVX, op::Sub, double> {
+                    static constexpr size_t lanes = 4;
+                    static __m256d load(const double* ptr) {return _mm256_loadu_pd(ptr);}
+                    static __m256d set1(const double value) {return _mm256_set1_pd(value);}
+                    static __m256d apply(const __m256d a, const __m256d b) {return _mm256_sub_pd(a, b);}
+                    static void store(double* ptr, const __m256d vec) {_mm256_storeu_pd(ptr, vec);}
+                };
+            #endif // __AVX__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Sub, double> {
+                    static constexpr size_t lanes = 2;
+                    static __m128d load(const double* ptr) {return _mm_loadu_pd(ptr);}
+                    static __m128d set1(const double value) {return _mm_set1_pd(value);}
+                    static __m128d apply(const __m128d a, const __m128d b) {return _mm_sub_pd(a, b);}
+                    static void store(double* ptr, const __m128d vec) {_mm_storeu_pd(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void sub(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, double>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<double, S>& a, const std::array<double, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<double, S>& a, const double b, std::array<double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, double>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<double, S>& a, const double b) {
+                sub<S, Isa>(a, b, a);
+            }
+        #pragma endregion // double
+
+        #pragma region // long double
+            template <>
+            struct Fixed<void, op::Sub, long double> {
+                static long double apply(const long double a, const long double b) {return a - b;}
+            };
+
+            template <size_t S, typename Isa>
+            void sub(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Sub, long double>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<long double, S>& a, const std::array<long double, S>& b) {
+                sub<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void sub(const std::array<long double, S>& a, const long double b, std::array<long double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubScalar, long double>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Sub, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subInplace(std::array<long double, S>& a, const long double b) {
+                sub<S, Isa>(a, b, a);
+            }
+        #pragma endregion // long double
+    #pragma endregion // sub
+    
+    #pragma region // adds
+        #pragma region // int8_t
+            template <>
+            struct Fixed<void, op::Adds, int8_t> {
+                static int8_t apply(const int8_t a, const int8_t b) {return addSaturate(a, b);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Adds, int8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_adds_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m512i vec) {[](int8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Adds, int8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_adds_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m256i vec) {[](int8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Adds, int8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_adds_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m128i vec) {[](int8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, int8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, int8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<int8_t, S>& a, const int8_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Fixed<void, op::Adds, int16_t> {
+                static int16_t apply(const int16_t a, const int16_t b) {return addSaturate(a, b);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Adds, int16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_adds_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m512i vec) {[](int16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Adds, int16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_adds_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m256i vec) {[](int16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Adds, int16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_adds_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m128i vec) {[](int16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, int16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, int16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<int16_t, S>& a, const int16_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Fixed<void, op::Adds, int32_t> {
+                static int32_t apply(const int32_t a, const int32_t b) {return addSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, int32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, int32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<int32_t, S>& a, const int32_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Fixed<void, op::Adds, int64_t> {
+                static int64_t apply(const int64_t a, const int64_t b) {return addSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, int64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, int64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<int64_t, S>& a, const int64_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Fixed<void, op::Adds, __int128_t> {
+                static __int128_t apply(const __int128_t a, const __int128_t b) {return addSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, __int128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, __int128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<__int128_t, S>& a, const __int128_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Fixed<void, op::Adds, uint8_t> {
+                static uint8_t apply(const uint8_t a, const uint8_t b) {return addSaturate(a, b);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Adds, uint8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_adds_epu8(a, b);}
+                    static void store(uint8_t* ptr, const __m512i vec) {[](uint8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Adds, uint8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_adds_epu8(a, b);}
+                    static void store(uint8_t* ptr, const __m256i vec) {[](uint8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Adds, uint8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_adds_epu8(a, b);}
+                    static void store(uint8_t* ptr, const __m128i vec) {[](uint8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, uint8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, uint8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<uint8_t, S>& a, const uint8_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Fixed<void, op::Adds, uint16_t> {
+                static uint16_t apply(const uint16_t a, const uint16_t b) {return addSaturate(a, b);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Adds, uint16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_adds_epu16(a, b);}
+                    static void store(uint16_t* ptr, const __m512i vec) {[](uint16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Adds, uint16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_adds_epu16(a, b);}
+                    static void store(uint16_t* ptr, const __m256i vec) {[](uint16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Adds, uint16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_adds_epu16(a, b);}
+                    static void store(uint16_t* ptr, const __m128i vec) {[](uint16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, uint16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, uint16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<uint16_t, S>& a, const uint16_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Fixed<void, op::Adds, uint32_t> {
+                static uint32_t apply(const uint32_t a, const uint32_t b) {return addSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, uint32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, uint32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<uint32_t, S>& a, const uint32_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Fixed<void, op::Adds, uint64_t> {
+                static uint64_t apply(const uint64_t a, const uint64_t b) {return addSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, uint64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, uint64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<uint64_t, S>& a, const uint64_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Fixed<void, op::Adds, __uint128_t> {
+                static __uint128_t apply(const __uint128_t a, const __uint128_t b) {return addSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void adds(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Adds, __uint128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b) {
+                adds<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void adds(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::AddsScalar, __uint128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Adds, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void addsInplace(std::array<__uint128_t, S>& a, const __uint128_t b) {
+                adds<S, Isa>(a, b, a);
+            }
+        #pragma endregion // __uint128_t
+    #pragma endregion // adds
+    
+    #pragma region // subs
+        #pragma region // int8_t
+            template <>
+            struct Fixed<void, op::Subs, int8_t> {
+                static int8_t apply(const int8_t a, const int8_t b) {return subSaturate(a, b);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Subs, int8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_subs_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m512i vec) {[](int8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Subs, int8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_subs_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m256i vec) {[](int8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Subs, int8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_subs_epi8(a, b);}
+                    static void store(int8_t* ptr, const __m128i vec) {[](int8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, int8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, int8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<int8_t, S>& a, const int8_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Fixed<void, op::Subs, int16_t> {
+                static int16_t apply(const int16_t a, const int16_t b) {return subSaturate(a, b);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Subs, int16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_subs_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m512i vec) {[](int16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Subs, int16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_subs_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m256i vec) {[](int16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Subs, int16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_subs_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m128i vec) {[](int16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, int16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, int16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<int16_t, S>& a, const int16_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Fixed<void, op::Subs, int32_t> {
+                static int32_t apply(const int32_t a, const int32_t b) {return subSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, int32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, int32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<int32_t, S>& a, const int32_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Fixed<void, op::Subs, int64_t> {
+                static int64_t apply(const int64_t a, const int64_t b) {return subSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, int64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, int64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<int64_t, S>& a, const int64_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Fixed<void, op::Subs, __int128_t> {
+                static __int128_t apply(const __int128_t a, const __int128_t b) {return subSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, __int128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, __int128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<__int128_t, S>& a, const __int128_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Fixed<void, op::Subs, uint8_t> {
+                static uint8_t apply(const uint8_t a, const uint8_t b) {return subSaturate(a, b);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Subs, uint8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_subs_epu8(a, b);}
+                    static void store(uint8_t* ptr, const __m512i vec) {[](uint8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Subs, uint8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_subs_epu8(a, b);}
+                    static void store(uint8_t* ptr, const __m256i vec) {[](uint8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Subs, uint8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_subs_epu8(a, b);}
+                    static void store(uint8_t* ptr, const __m128i vec) {[](uint8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, uint8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, uint8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<uint8_t, S>& a, const uint8_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Fixed<void, op::Subs, uint16_t> {
+                static uint16_t apply(const uint16_t a, const uint16_t b) {return subSaturate(a, b);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Subs, uint16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_subs_epu16(a, b);}
+                    static void store(uint16_t* ptr, const __m512i vec) {[](uint16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Subs, uint16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_subs_epu16(a, b);}
+                    static void store(uint16_t* ptr, const __m256i vec) {[](uint16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Subs, uint16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_subs_epu16(a, b);}
+                    static void store(uint16_t* ptr, const __m128i vec) {[](uint16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, uint16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, uint16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<uint16_t, S>& a, const uint16_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Fixed<void, op::Subs, uint32_t> {
+                static uint32_t apply(const uint32_t a, const uint32_t b) {return subSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, uint32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, uint32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<uint32_t, S>& a, const uint32_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Fixed<void, op::Subs, uint64_t> {
+                static uint64_t apply(const uint64_t a, const uint64_t b) {return subSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, uint64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, uint64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<uint64_t, S>& a, const uint64_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Fixed<void, op::Subs, __uint128_t> {
+                static __uint128_t apply(const __uint128_t a, const __uint128_t b) {return subSaturate(a, b);}
+            };
+
+            template <size_t S, typename Isa>
+            void subs(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Subs, __uint128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b) {
+                subs<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void subs(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::SubsScalar, __uint128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Subs, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void subsInplace(std::array<__uint128_t, S>& a, const __uint128_t b) {
+                subs<S, Isa>(a, b, a);
+            }
+        #pragma endregion // __uint128_t
+    #pragma endregion // subs
+    
+    #pragma region // mul
+        #pragma region // int8_t
+            template <>
+            struct Fixed<void, op::Mul, int8_t> {
+                static int8_t apply(const int8_t a, const int8_t b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, int8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return [](const __m512i a, const __m512i b) {const __m512i even = _mm512_mullo_epi16(a, b); const __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)); return _mm512_or_si512(_mm512_slli_epi16(odd, 8), _mm512_and_si512(even, _mm512_set1_epi16(0xFF)));}(a, b);}
+                    static void store(int8_t* ptr, const __m512i vec) {[](int8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Mul, int8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return [](const __m256i a, const __m256i b) {const __m256i even = _mm256_mullo_epi16(a, b); const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)); return _mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0xFF)));}(a, b);}
+                    static void store(int8_t* ptr, const __m256i vec) {[](int8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Mul, int8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return [](const __m128i a, const __m128i b) {const __m128i even = _mm_mullo_epi16(a, b); const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)); return _mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xFF)));}(a, b);}
+                    static void store(int8_t* ptr, const __m128i vec) {[](int8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, int8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, int8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<int8_t, S>& a, const int8_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Fixed<void, op::Mul, int16_t> {
+                static int16_t apply(const int16_t a, const int16_t b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, int16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_mullo_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m512i vec) {[](int16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Mul, int16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_mullo_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m256i vec) {[](int16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Mul, int16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_mullo_epi16(a, b);}
+                    static void store(int16_t* ptr, const __m128i vec) {[](int16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, int16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, int16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<int16_t, S>& a, const int16_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Fixed<void, op::Mul, int32_t> {
+                static int32_t apply(const int32_t a, const int32_t b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, int32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_mullo_epi32(a, b);}
+                    static void store(int32_t* ptr, const __m512i vec) {[](int32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Mul, int32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_mullo_epi32(a, b);}
+                    static void store(int32_t* ptr, const __m256i vec) {[](int32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, int32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, int32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<int32_t, S>& a, const int32_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Fixed<void, op::Mul, int64_t> {
+                static int64_t apply(const int64_t a, const int64_t b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, int64_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m512i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int64_t value) {return _mm512_set1_epi64(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_mullo_epi64(a, b);}
+                    static void store(int64_t* ptr, const __m512i vec) {[](int64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Mul, int64_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m256i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int64_t value) {return _mm256_set1_epi64x(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return [](const __m256i a, const __m256i b) {const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32))); return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));}(a, b);}
+                    static void store(int64_t* ptr, const __m256i vec) {[](int64_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Mul, int64_t> {
+                    static constexpr size_t lanes = 2;
+                    static __m128i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int64_t value) {return _mm_set1_epi64x(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return [](const __m128i a, const __m128i b) {const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32))); return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));}(a, b);}
+                    static void store(int64_t* ptr, const __m128i vec) {[](int64_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, int64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, int64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<int64_t, S>& a, const int64_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Fixed<void, op::Mul, __int128_t> {
+                static __int128_t apply(const __int128_t a, const __int128_t b) {return a * b;}
+            };
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, __int128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, __int128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<__int128_t, S>& a, const __int128_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Fixed<void, op::Mul, uint8_t> {
+                static uint8_t apply(const uint8_t a, const uint8_t b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, uint8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return [](const __m512i a, const __m512i b) {const __m512i even = _mm512_mullo_epi16(a, b); const __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)); return _mm512_or_si512(_mm512_slli_epi16(odd, 8), _mm512_and_si512(even, _mm512_set1_epi16(0xFF)));}(a, b);}
+                    static void store(uint8_t* ptr, const __m512i vec) {[](uint8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Mul, uint8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return [](const __m256i a, const __m256i b) {const __m256i even = _mm256_mullo_epi16(a, b); const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)); return _mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0xFF)));}(a, b);}
+                    static void store(uint8_t* ptr, const __m256i vec) {[](uint8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Mul, uint8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return [](const __m128i a, const __m128i b) {const __m128i even = _mm_mullo_epi16(a, b); const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)); return _mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xFF)));}(a, b);}
+                    static void store(uint8_t* ptr, const __m128i vec) {[](uint8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, uint8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, uint8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<uint8_t, S>& a, const uint8_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Fixed<void, op::Mul, uint16_t> {
+                static uint16_t apply(const uint16_t a, const uint16_t b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, uint16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_mullo_epi16(a, b);}
+                    static void store(uint16_t* ptr, const __m512i vec) {[](uint16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Mul, uint16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_mullo_epi16(a, b);}
+                    static void store(uint16_t* ptr, const __m256i vec) {[](uint16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Mul, uint16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return _mm_mullo_epi16(a, b);}
+                    static void store(uint16_t* ptr, const __m128i vec) {[](uint16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, uint16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, uint16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<uint16_t, S>& a, const uint16_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Fixed<void, op::Mul, uint32_t> {
+                static uint32_t apply(const uint32_t a, const uint32_t b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, uint32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_mullo_epi32(a, b);}
+                    static void store(uint32_t* ptr, const __m512i vec) {[](uint32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Mul, uint32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return _mm256_mullo_epi32(a, b);}
+                    static void store(uint32_t* ptr, const __m256i vec) {[](uint32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, uint32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, uint32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<uint32_t, S>& a, const uint32_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Fixed<void, op::Mul, uint64_t> {
+                static uint64_t apply(const uint64_t a, const uint64_t b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, uint64_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m512i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint64_t value) {return _mm512_set1_epi64(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return _mm512_mullo_epi64(a, b);}
+                    static void store(uint64_t* ptr, const __m512i vec) {[](uint64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Mul, uint64_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m256i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint64_t value) {return _mm256_set1_epi64x(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return [](const __m256i a, const __m256i b) {const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32))); return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));}(a, b);}
+                    static void store(uint64_t* ptr, const __m256i vec) {[](uint64_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Mul, uint64_t> {
+                    static constexpr size_t lanes = 2;
+                    static __m128i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint64_t value) {return _mm_set1_epi64x(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return [](const __m128i a, const __m128i b) {const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32))); return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));}(a, b);}
+                    static void store(uint64_t* ptr, const __m128i vec) {[](uint64_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, uint64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, uint64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<uint64_t, S>& a, const uint64_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Fixed<void, op::Mul, __uint128_t> {
+                static __uint128_t apply(const __uint128_t a, const __uint128_t b) {return a * b;}
+            };
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, __uint128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, __uint128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<__uint128_t, S>& a, const __uint128_t b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Fixed<void, op::Mul, _Float16> {
+                static _Float16 apply(const _Float16 a, const _Float16 b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512FP16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512FP16, op::Mul, _Float16> {
+                    static constexpr size_t lanes = 32;
+                    static __m512h load(const _Float16* ptr) {return _mm512_loadu_ph(ptr);}
+                    static __m512h set1(const _Float16 value) {return _mm512_set1_ph(value);}
+                    static __m512h apply(const __m512h a, const __m512h b) {return _mm512_mul_ph(a, b);}
+                    static void store(_Float16* ptr, const __m512h vec) {_mm512_storeu_ph(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512FP16
+            #ifdef EZSIMD_F16C
+                template <>
+                struct Fixed<isa::F16C, op::Mul, _Float16> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const _Float16* ptr) {return [](const _Float16* ptr) {return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}(ptr);}
+                    static __m256 set1(const _Float16 value) {return [](const _Float16 value) {return _mm256_set1_ps(static_cast<float>(value));}(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_mul_ps(a, b);}
+                    static void store(_Float16* ptr, const __m256 vec) {[](_Float16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));}(ptr, vec);}
+                };
+            #endif // EZSIMD_F16C
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<_Float16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, _Float16>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<_Float16, S>& a, const std::array<_Float16, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<_Float16, S>& a, const _Float16 b, std::array<_Float16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, _Float16>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<_Float16, S>& a, const _Float16 b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Fixed<void, op::Mul, bfloat16> {
+                static bfloat16 apply(const bfloat16 a, const bfloat16 b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512BF16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512BF16, op::Mul, bfloat16> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const bfloat16* ptr) {return [](const bfloat16* ptr) {return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));}(ptr);}
+                    static __m512 set1(const bfloat16 value) {return [](const bfloat16 value) {return _mm512_set1_ps(static_cast<float>(value));}(value);}
+                    static __m512 apply(const __m512 a, const __m512 b) {return _mm512_mul_ps(a, b);}
+                    static void store(bfloat16* ptr, const __m512 vec) {[](bfloat16* ptr, const __m512 vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reinterpret_cast<__m256i>(_mm512_cvtneps_pbh(vec)));}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512BF16
+            #ifdef EZSIMD_F16C
+                template <>
+                struct Fixed<isa::F16C, op::Mul, bfloat16> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const bfloat16* ptr) {return [](const bfloat16* ptr) {return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))), 16));}(ptr);}
+                    static __m256 set1(const bfloat16 value) {return [](const bfloat16 value) {return _mm256_set1_ps(static_cast<float>(value));}(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_mul_ps(a, b);}
+                    static void store(bfloat16* ptr, const __m256 vec) {[](bfloat16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), narrowBf16F16C(vec));}(ptr, vec);}
+                };
+            #endif // EZSIMD_F16C
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<bfloat16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, bfloat16>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<bfloat16, S>& a, const bfloat16 b, std::array<bfloat16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, bfloat16>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<bfloat16, S>& a, const bfloat16 b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Fixed<void, op::Mul, float> {
+                static float apply(const float a, const float b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, float> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const float* ptr) {return _mm512_loadu_ps(ptr);}
+                    static __m512 set1(const float value) {return _mm512_set1_ps(value);}
+                    static __m512 apply(const __m512 a, const __m512 b) {return _mm512_mul_ps(a, b);}
+                    static void store(float* ptr, const __m512 vec) {_mm512_storeu_ps(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX__
+                template <>
+                struct Fixed<isa::AVX, op::Mul, float> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const float* ptr) {return _mm256_loadu_ps(ptr);}
+                    static __m256 set1(const float value) {return _mm256_set1_ps(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_mul_ps(a, b);}
+                    static void store(float* ptr, const __m256 vec) {_mm256_storeu_ps(ptr, vec);}
+                };
+            #endif // __AVX__
+            #ifdef __SSE__
+                template <>
+                struct Fixed<isa::SSE, op::Mul, float> {
+                    static constexpr size_t lanes = 4;
+                    static __m128 load(const float* ptr) {return _mm_loadu_ps(ptr);}
+                    static __m128 set1(const float value) {return _mm_set1_ps(value);}
+                    static __m128 apply(const __m128 a, const __m128 b) {return _mm_mul_ps(a, b);}
+                    static void store(float* ptr, const __m128 vec) {_mm_storeu_ps(ptr, vec);}
+                };
+            #endif // __SSE__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, float>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<float, S>& a, const std::array<float, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<float, S>& a, const float b, std::array<float, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, float>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<float, S>& a, const float b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // float
+
+        #pragma region // double
+            template <>
+            struct Fixed<void, op::Mul, double> {
+                static double apply(const double a, const double b) {return a * b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Mul, double> {
+                    static constexpr size_t lanes = 8;
+                    static __m512d load(const double* ptr) {return _mm512_loadu_pd(ptr);}
+                    static __m512d set1(const double value) {return _mm512_set1_pd(value);}
+                    static __m512d apply(const __m512d a, const __m512d b) {return _mm512_mul_pd(a, b);}
+                    static void store(double* ptr, const __m512d vec) {_mm512_storeu_pd(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX__
+                template <>
+                struct Fixed<isa::AVX, op::Mul, double> {
+                    static constexpr size_t lanes = 4;
+                    static __m256d load(const double* ptr) {return _mm256_loadu_pd(ptr);}
+                    static __m256d set1(const double value) {return _mm256_set1_pd(value);}
+                    static __m256d apply(const __m256d a, const __m256d b) {return _mm256_mul_pd(a, b);}
+                    static void store(double* ptr, const __m256d vec) {_mm256_storeu_pd(ptr, vec);}
+                };
+            #endif // __AVX__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Mul, double> {
+                    static constexpr size_t lanes = 2;
+                    static __m128d load(const double* ptr) {return _mm_loadu_pd(ptr);}
+                    static __m128d set1(const double value) {return _mm_set1_pd(value);}
+                    static __m128d apply(const __m128d a, const __m128d b) {return _mm_mul_pd(a, b);}
+                    static void store(double* ptr, const __m128d vec) {_mm_storeu_pd(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, double>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<double, S>& a, const std::array<double, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<double, S>& a, const double b, std::array<double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, double>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<double, S>& a, const double b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // double
+
+        #pragma region // long double
+            template <>
+            struct Fixed<void, op::Mul, long double> {
+                static long double apply(const long double a, const long double b) {return a * b;}
+            };
+
+            template <size_t S, typename Isa>
+            void mul(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Mul, long double>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<long double, S>& a, const std::array<long double, S>& b) {
+                mul<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void mul(const std::array<long double, S>& a, const long double b, std::array<long double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::MulScalar, long double>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Mul, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void mulInplace(std::array<long double, S>& a, const long double b) {
+                mul<S, Isa>(a, b, a);
+            }
+        #pragma endregion // long double
+    #pragma endregion // mul
+    
+    #pragma region // div
+        #pragma region // int8_t
+            template <>
+            struct Fixed<void, op::Div, int8_t> {
+                static int8_t apply(const int8_t a, const int8_t b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Div, int8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return divInt8AVX512(a, b);}
+                    static void store(int8_t* ptr, const __m512i vec) {[](int8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Div, int8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return divInt8AVX2(a, b);}
+                    static void store(int8_t* ptr, const __m256i vec) {[](int8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Div, int8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return divInt8SSE2(a, b);}
+                    static void store(int8_t* ptr, const __m128i vec) {[](int8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void div(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, int8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<int8_t, S>& a, const std::array<int8_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<int8_t, S>& a, const int8_t b, std::array<int8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, int8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<int8_t, S>& a, const int8_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Fixed<void, op::Div, int16_t> {
+                static int16_t apply(const int16_t a, const int16_t b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Div, int16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return divInt16AVX512(a, b);}
+                    static void store(int16_t* ptr, const __m512i vec) {[](int16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Div, int16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return divInt16AVX2(a, b);}
+                    static void store(int16_t* ptr, const __m256i vec) {[](int16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Div, int16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return divInt16SSE2(a, b);}
+                    static void store(int16_t* ptr, const __m128i vec) {[](int16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void div(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, int16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<int16_t, S>& a, const std::array<int16_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<int16_t, S>& a, const int16_t b, std::array<int16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, int16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<int16_t, S>& a, const int16_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Fixed<void, op::Div, int32_t> {
+                static int32_t apply(const int32_t a, const int32_t b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Div, int32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return divInt32AVX512(a, b);}
+                    static void store(int32_t* ptr, const __m512i vec) {[](int32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Div, int32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return divInt32AVX2(a, b);}
+                    static void store(int32_t* ptr, const __m256i vec) {[](int32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Div, int32_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m128i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int32_t value) {return _mm_set1_epi32(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return divInt32SSE2(a, b);}
+                    static void store(int32_t* ptr, const __m128i vec) {[](int32_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void div(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, int32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<int32_t, S>& a, const std::array<int32_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<int32_t, S>& a, const int32_t b, std::array<int32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, int32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<int32_t, S>& a, const int32_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Fixed<void, op::Div, int64_t> {
+                static int64_t apply(const int64_t a, const int64_t b) {return a / b;}
+            };
+
+            template <size_t S, typename Isa>
+            void div(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, int64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<int64_t, S>& a, const std::array<int64_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<int64_t, S>& a, const int64_t b, std::array<int64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, int64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<int64_t, S>& a, const int64_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Fixed<void, op::Div, __int128_t> {
+                static __int128_t apply(const __int128_t a, const __int128_t b) {return a / b;}
+            };
+
+            template <size_t S, typename Isa>
+            void div(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, __int128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<__int128_t, S>& a, const __int128_t b, std::array<__int128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, __int128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<__int128_t, S>& a, const __int128_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Fixed<void, op::Div, uint8_t> {
+                static uint8_t apply(const uint8_t a, const uint8_t b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Div, uint8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return divUint8AVX512(a, b);}
+                    static void store(uint8_t* ptr, const __m512i vec) {[](uint8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Div, uint8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return divUint8AVX2(a, b);}
+                    static void store(uint8_t* ptr, const __m256i vec) {[](uint8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Div, uint8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return divUint8SSE2(a, b);}
+                    static void store(uint8_t* ptr, const __m128i vec) {[](uint8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void div(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, uint8_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<uint8_t, S>& a, const uint8_t b, std::array<uint8_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, uint8_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<uint8_t, S>& a, const uint8_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Fixed<void, op::Div, uint16_t> {
+                static uint16_t apply(const uint16_t a, const uint16_t b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Div, uint16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return divUint16AVX512(a, b);}
+                    static void store(uint16_t* ptr, const __m512i vec) {[](uint16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Div, uint16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return divUint16AVX2(a, b);}
+                    static void store(uint16_t* ptr, const __m256i vec) {[](uint16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Div, uint16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return divUint16SSE2(a, b);}
+                    static void store(uint16_t* ptr, const __m128i vec) {[](uint16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void div(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, uint16_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<uint16_t, S>& a, const uint16_t b, std::array<uint16_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, uint16_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<uint16_t, S>& a, const uint16_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Fixed<void, op::Div, uint32_t> {
+                static uint32_t apply(const uint32_t a, const uint32_t b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Div, uint32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b) {return divUint32AVX512(a, b);}
+                    static void store(uint32_t* ptr, const __m512i vec) {[](uint32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Div, uint32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b) {return divUint32AVX2(a, b);}
+                    static void store(uint32_t* ptr, const __m256i vec) {[](uint32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Div, uint32_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m128i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint32_t value) {return _mm_set1_epi32(value);}
+                    static __m128i apply(const __m128i a, const __m128i b) {return divUint32SSE2(a, b);}
+                    static void store(uint32_t* ptr, const __m128i vec) {[](uint32_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void div(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, uint32_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<uint32_t, S>& a, const uint32_t b, std::array<uint32_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, uint32_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<uint32_t, S>& a, const uint32_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Fixed<void, op::Div, uint64_t> {
+                static uint64_t apply(const uint64_t a, const uint64_t b) {return a / b;}
+            };
+
+            template <size_t S, typename Isa>
+            void div(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, uint64_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<uint64_t, S>& a, const uint64_t b, std::array<uint64_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, uint64_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<uint64_t, S>& a, const uint64_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Fixed<void, op::Div, __uint128_t> {
+                static __uint128_t apply(const __uint128_t a, const __uint128_t b) {return a / b;}
+            };
+
+            template <size_t S, typename Isa>
+            void div(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, __uint128_t>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<__uint128_t, S>& a, const __uint128_t b, std::array<__uint128_t, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, __uint128_t>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<__uint128_t, S>& a, const __uint128_t b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Fixed<void, op::Div, _Float16> {
+                static _Float16 apply(const _Float16 a, const _Float16 b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512FP16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512FP16, op::Div, _Float16> {
+                    static constexpr size_t lanes = 32;
+                    static __m512h load(const _Float16* ptr) {return _mm512_loadu_ph(ptr);}
+                    static __m512h set1(const _Float16 value) {return _mm512_set1_ph(value);}
+                    static __m512h apply(const __m512h a, const __m512h b) {return _mm512_div_ph(a, b);}
+                    static void store(_Float16* ptr, const __m512h vec) {_mm512_storeu_ph(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512FP16
+            #ifdef EZSIMD_F16C
+                template <>
+                struct Fixed<isa::F16C, op::Div, _Float16> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const _Float16* ptr) {return [](const _Float16* ptr) {return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}(ptr);}
+                    static __m256 set1(const _Float16 value) {return [](const _Float16 value) {return _mm256_set1_ps(static_cast<float>(value));}(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_div_ps(a, b);}
+                    static void store(_Float16* ptr, const __m256 vec) {[](_Float16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));}(ptr, vec);}
+                };
+            #endif // EZSIMD_F16C
+
+            template <size_t S, typename Isa>
+            void div(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<_Float16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, _Float16>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<_Float16, S>& a, const std::array<_Float16, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<_Float16, S>& a, const _Float16 b, std::array<_Float16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, _Float16>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<_Float16, S>& a, const _Float16 b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Fixed<void, op::Div, bfloat16> {
+                static bfloat16 apply(const bfloat16 a, const bfloat16 b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512BF16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512BF16, op::Div, bfloat16> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const bfloat16* ptr) {return [](const bfloat16* ptr) {return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));}(ptr);}
+                    static __m512 set1(const bfloat16 value) {return [](const bfloat16 value) {return _mm512_set1_ps(static_cast<float>(value));}(value);}
+                    static __m512 apply(const __m512 a, const __m512 b) {return _mm512_div_ps(a, b);}
+                    static void store(bfloat16* ptr, const __m512 vec) {[](bfloat16* ptr, const __m512 vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reinterpret_cast<__m256i>(_mm512_cvtneps_pbh(vec)));}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512BF16
+            #ifdef EZSIMD_F16C
+                template <>
+                struct Fixed<isa::F16C, op::Div, bfloat16> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const bfloat16* ptr) {return [](const bfloat16* ptr) {return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))), 16));}(ptr);}
+                    static __m256 set1(const bfloat16 value) {return [](const bfloat16 value) {return _mm256_set1_ps(static_cast<float>(value));}(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_div_ps(a, b);}
+                    static void store(bfloat16* ptr, const __m256 vec) {[](bfloat16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), narrowBf16F16C(vec));}(ptr, vec);}
+                };
+            #endif // EZSIMD_F16C
+
+            template <size_t S, typename Isa>
+            void div(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<bfloat16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, bfloat16>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<bfloat16, S>& a, const bfloat16 b, std::array<bfloat16, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, bfloat16>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<bfloat16, S>& a, const bfloat16 b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <>
+            struct Fixed<void, op::Div, float> {
+                static float apply(const float a, const float b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Div, float> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const float* ptr) {return _mm512_loadu_ps(ptr);}
+                    static __m512 set1(const float value) {return _mm512_set1_ps(value);}
+                    static __m512 apply(const __m512 a, const __m512 b) {return _mm512_div_ps(a, b);}
+                    static void store(float* ptr, const __m512 vec) {_mm512_storeu_ps(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX__
+                template <>
+                struct Fixed<isa::AVX, op::Div, float> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const float* ptr) {return _mm256_loadu_ps(ptr);}
+                    static __m256 set1(const float value) {return _mm256_set1_ps(value);}
+                    static __m256 apply(const __m256 a, const __m256 b) {return _mm256_div_ps(a, b);}
+                    static void store(float* ptr, const __m256 vec) {_mm256_storeu_ps(ptr, vec);}
+                };
+            #endif // __AVX__
+            #ifdef __SSE__
+                template <>
+                struct Fixed<isa::SSE, op::Div, float> {
+                    static constexpr size_t lanes = 4;
+                    static __m128 load(const float* ptr) {return _mm_loadu_ps(ptr);}
+                    static __m128 set1(const float value) {return _mm_set1_ps(value);}
+                    static __m128 apply(const __m128 a, const __m128 b) {return _mm_div_ps(a, b);}
+                    static void store(float* ptr, const __m128 vec) {_mm_storeu_ps(ptr, vec);}
+                };
+            #endif // __SSE__
+
+            template <size_t S, typename Isa>
+            void div(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, float>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<float, S>& a, const std::array<float, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<float, S>& a, const float b, std::array<float, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, float>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<float, S>& a, const float b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // float
+
+        #pragma region // double
+            template <>
+            struct Fixed<void, op::Div, double> {
+                static double apply(const double a, const double b) {return a / b;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Div, double> {
+                    static constexpr size_t lanes = 8;
+                    static __m512d load(const double* ptr) {return _mm512_loadu_pd(ptr);}
+                    static __m512d set1(const double value) {return _mm512_set1_pd(value);}
+                    static __m512d apply(const __m512d a, const __m512d b) {return _mm512_div_pd(a, b);}
+                    static void store(double* ptr, const __m512d vec) {_mm512_storeu_pd(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX__
+                template <>
+                struct Fixed<isa::AVX, op::Div, double> {
+                    static constexpr size_t lanes = 4;
+                    static __m256d load(const double* ptr) {return _mm256_loadu_pd(ptr);}
+                    static __m256d set1(const double value) {return _mm256_set1_pd(value);}
+                    static __m256d apply(const __m256d a, const __m256d b) {return _mm256_div_pd(a, b);}
+                    static void store(double* ptr, const __m256d vec) {_mm256_storeu_pd(ptr, vec);}
+                };
+            #endif // __AVX__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Div, double> {
+                    static constexpr size_t lanes = 2;
+                    static __m128d load(const double* ptr) {return _mm_loadu_pd(ptr);}
+                    static __m128d set1(const double value) {return _mm_set1_pd(value);}
+                    static __m128d apply(const __m128d a, const __m128d b) {return _mm_div_pd(a, b);}
+                    static void store(double* ptr, const __m128d vec) {_mm_storeu_pd(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void div(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, double>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<double, S>& a, const std::array<double, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<double, S>& a, const double b, std::array<double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, double>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<double, S>& a, const double b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // double
+
+        #pragma region // long double
+            template <>
+            struct Fixed<void, op::Div, long double> {
+                static long double apply(const long double a, const long double b) {return a / b;}
+            };
+
+            template <size_t S, typename Isa>
+            void div(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Div, long double>()(a.data(), b.data(), c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b.data());
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<long double, S>& a, const std::array<long double, S>& b) {
+                div<S, Isa>(a, b, a);
+            }
+            template <size_t S, typename Isa>
+            void div(const std::array<long double, S>& a, const long double b, std::array<long double, S>& c) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::DivScalar, long double>()(a.data(), b, c.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Div, S>(maxIsa(), c.data(), a.data(), b);
+                }
+            }
+            
+            template <size_t S, typename Isa>
+            void divInplace(std::array<long double, S>& a, const long double b) {
+                div<S, Isa>(a, b, a);
+            }
+        #pragma endregion // long double
+    #pragma endregion // div
+    
+    #pragma region // fma
+        #pragma region // int8_t
+            template <>
+            struct Fixed<void, op::Fma, int8_t> {
+                static int8_t apply(const int8_t a, const int8_t b, const int8_t c) {return a * b + c;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, int8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b, const __m512i c) {return [](const __m512i a, const __m512i b, const __m512i c) {const __m512i even = _mm512_mullo_epi16(a, b); const __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)); return _mm512_add_epi8(_mm512_or_si512(_mm512_slli_epi16(odd, 8), _mm512_and_si512(even, _mm512_set1_epi16(0xFF))), c);}(a, b, c);}
+                    static void store(int8_t* ptr, const __m512i vec) {[](int8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Fma, int8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b, const __m256i c) {return [](const __m256i a, const __m256i b, const __m256i c) {const __m256i even = _mm256_mullo_epi16(a, b); const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)); return _mm256_add_epi8(_mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0xFF))), c);}(a, b, c);}
+                    static void store(int8_t* ptr, const __m256i vec) {[](int8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Fma, int8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const int8_t* ptr) {return [](const int8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b, const __m128i c) {return [](const __m128i a, const __m128i b, const __m128i c) {const __m128i even = _mm_mullo_epi16(a, b); const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)); return _mm_add_epi8(_mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xFF))), c);}(a, b, c);}
+                    static void store(int8_t* ptr, const __m128i vec) {[](int8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, const std::array<int8_t, S>& c, std::array<int8_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, int8_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <>
+            struct Fixed<void, op::Fma, int16_t> {
+                static int16_t apply(const int16_t a, const int16_t b, const int16_t c) {return a * b + c;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, int16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b, const __m512i c) {return [](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi16(_mm512_mullo_epi16(a, b), c);}(a, b, c);}
+                    static void store(int16_t* ptr, const __m512i vec) {[](int16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Fma, int16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b, const __m256i c) {return [](const __m256i a, const __m256i b, const __m256i c) {return _mm256_add_epi16(_mm256_mullo_epi16(a, b), c);}(a, b, c);}
+                    static void store(int16_t* ptr, const __m256i vec) {[](int16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Fma, int16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const int16_t* ptr) {return [](const int16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b, const __m128i c) {return [](const __m128i a, const __m128i b, const __m128i c) {return _mm_add_epi16(_mm_mullo_epi16(a, b), c);}(a, b, c);}
+                    static void store(int16_t* ptr, const __m128i vec) {[](int16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, const std::array<int16_t, S>& c, std::array<int16_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, int16_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <>
+            struct Fixed<void, op::Fma, int32_t> {
+                static int32_t apply(const int32_t a, const int32_t b, const int32_t c) {return a * b + c;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, int32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b, const __m512i c) {return [](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi32(_mm512_mullo_epi32(a, b), c);}(a, b, c);}
+                    static void store(int32_t* ptr, const __m512i vec) {[](int32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Fma, int32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const int32_t* ptr) {return [](const int32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b, const __m256i c) {return [](const __m256i a, const __m256i b, const __m256i c) {return _mm256_add_epi32(_mm256_mullo_epi32(a, b), c);}(a, b, c);}
+                    static void store(int32_t* ptr, const __m256i vec) {[](int32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, const std::array<int32_t, S>& c, std::array<int32_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, int32_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <>
+            struct Fixed<void, op::Fma, int64_t> {
+                static int64_t apply(const int64_t a, const int64_t b, const int64_t c) {return a * b + c;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, int64_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m512i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const int64_t value) {return _mm512_set1_epi64(value);}
+                    static __m512i apply(const __m512i a, const __m512i b, const __m512i c) {return [](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi64(_mm512_mullo_epi64(a, b), c);}(a, b, c);}
+                    static void store(int64_t* ptr, const __m512i vec) {[](int64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Fma, int64_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m256i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const int64_t value) {return _mm256_set1_epi64x(value);}
+                    static __m256i apply(const __m256i a, const __m256i b, const __m256i c) {return [](const __m256i a, const __m256i b, const __m256i c) {const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32))); return _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32)), c);}(a, b, c);}
+                    static void store(int64_t* ptr, const __m256i vec) {[](int64_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Fma, int64_t> {
+                    static constexpr size_t lanes = 2;
+                    static __m128i load(const int64_t* ptr) {return [](const int64_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const int64_t value) {return _mm_set1_epi64x(value);}
+                    static __m128i apply(const __m128i a, const __m128i b, const __m128i c) {return [](const __m128i a, const __m128i b, const __m128i c) {const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32))); return _mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32)), c);}(a, b, c);}
+                    static void store(int64_t* ptr, const __m128i vec) {[](int64_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, const std::array<int64_t, S>& c, std::array<int64_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, int64_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <>
+            struct Fixed<void, op::Fma, __int128_t> {
+                static __int128_t apply(const __int128_t a, const __int128_t b, const __int128_t c) {return a * b + c;}
+            };
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, const std::array<__int128_t, S>& c, std::array<__int128_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, __int128_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <>
+            struct Fixed<void, op::Fma, uint8_t> {
+                static uint8_t apply(const uint8_t a, const uint8_t b, const uint8_t c) {return a * b + c;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, uint8_t> {
+                    static constexpr size_t lanes = 64;
+                    static __m512i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint8_t value) {return _mm512_set1_epi8(value);}
+                    static __m512i apply(const __m512i a, const __m512i b, const __m512i c) {return [](const __m512i a, const __m512i b, const __m512i c) {const __m512i even = _mm512_mullo_epi16(a, b); const __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)); return _mm512_add_epi8(_mm512_or_si512(_mm512_slli_epi16(odd, 8), _mm512_and_si512(even, _mm512_set1_epi16(0xFF))), c);}(a, b, c);}
+                    static void store(uint8_t* ptr, const __m512i vec) {[](uint8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Fma, uint8_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m256i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint8_t value) {return _mm256_set1_epi8(value);}
+                    static __m256i apply(const __m256i a, const __m256i b, const __m256i c) {return [](const __m256i a, const __m256i b, const __m256i c) {const __m256i even = _mm256_mullo_epi16(a, b); const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)); return _mm256_add_epi8(_mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0xFF))), c);}(a, b, c);}
+                    static void store(uint8_t* ptr, const __m256i vec) {[](uint8_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Fma, uint8_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m128i load(const uint8_t* ptr) {return [](const uint8_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint8_t value) {return _mm_set1_epi8(value);}
+                    static __m128i apply(const __m128i a, const __m128i b, const __m128i c) {return [](const __m128i a, const __m128i b, const __m128i c) {const __m128i even = _mm_mullo_epi16(a, b); const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)); return _mm_add_epi8(_mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xFF))), c);}(a, b, c);}
+                    static void store(uint8_t* ptr, const __m128i vec) {[](uint8_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, const std::array<uint8_t, S>& c, std::array<uint8_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, uint8_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <>
+            struct Fixed<void, op::Fma, uint16_t> {
+                static uint16_t apply(const uint16_t a, const uint16_t b, const uint16_t c) {return a * b + c;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, uint16_t> {
+                    static constexpr size_t lanes = 32;
+                    static __m512i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint16_t value) {return _mm512_set1_epi16(value);}
+                    static __m512i apply(const __m512i a, const __m512i b, const __m512i c) {return [](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi16(_mm512_mullo_epi16(a, b), c);}(a, b, c);}
+                    static void store(uint16_t* ptr, const __m512i vec) {[](uint16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Fma, uint16_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m256i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint16_t value) {return _mm256_set1_epi16(value);}
+                    static __m256i apply(const __m256i a, const __m256i b, const __m256i c) {return [](const __m256i a, const __m256i b, const __m256i c) {return _mm256_add_epi16(_mm256_mullo_epi16(a, b), c);}(a, b, c);}
+                    static void store(uint16_t* ptr, const __m256i vec) {[](uint16_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Fma, uint16_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m128i load(const uint16_t* ptr) {return [](const uint16_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint16_t value) {return _mm_set1_epi16(value);}
+                    static __m128i apply(const __m128i a, const __m128i b, const __m128i c) {return [](const __m128i a, const __m128i b, const __m128i c) {return _mm_add_epi16(_mm_mullo_epi16(a, b), c);}(a, b, c);}
+                    static void store(uint16_t* ptr, const __m128i vec) {[](uint16_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, const std::array<uint16_t, S>& c, std::array<uint16_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, uint16_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <>
+            struct Fixed<void, op::Fma, uint32_t> {
+                static uint32_t apply(const uint32_t a, const uint32_t b, const uint32_t c) {return a * b + c;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, uint32_t> {
+                    static constexpr size_t lanes = 16;
+                    static __m512i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint32_t value) {return _mm512_set1_epi32(value);}
+                    static __m512i apply(const __m512i a, const __m512i b, const __m512i c) {return [](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi32(_mm512_mullo_epi32(a, b), c);}(a, b, c);}
+                    static void store(uint32_t* ptr, const __m512i vec) {[](uint32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Fma, uint32_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m256i load(const uint32_t* ptr) {return [](const uint32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint32_t value) {return _mm256_set1_epi32(value);}
+                    static __m256i apply(const __m256i a, const __m256i b, const __m256i c) {return [](const __m256i a, const __m256i b, const __m256i c) {return _mm256_add_epi32(_mm256_mullo_epi32(a, b), c);}(a, b, c);}
+                    static void store(uint32_t* ptr, const __m256i vec) {[](uint32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, const std::array<uint32_t, S>& c, std::array<uint32_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, uint32_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <>
+            struct Fixed<void, op::Fma, uint64_t> {
+                static uint64_t apply(const uint64_t a, const uint64_t b, const uint64_t c) {return a * b + c;}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, uint64_t> {
+                    static constexpr size_t lanes = 8;
+                    static __m512i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm512_loadu_si512(ptr);}(ptr);}
+                    static __m512i set1(const uint64_t value) {return _mm512_set1_epi64(value);}
+                    static __m512i apply(const __m512i a, const __m512i b, const __m512i c) {return [](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi64(_mm512_mullo_epi64(a, b), c);}(a, b, c);}
+                    static void store(uint64_t* ptr, const __m512i vec) {[](uint64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __AVX2__
+                template <>
+                struct Fixed<isa::AVX2, op::Fma, uint64_t> {
+                    static constexpr size_t lanes = 4;
+                    static __m256i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}(ptr);}
+                    static __m256i set1(const uint64_t value) {return _mm256_set1_epi64x(value);}
+                    static __m256i apply(const __m256i a, const __m256i b, const __m256i c) {return [](const __m256i a, const __m256i b, const __m256i c) {const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32))); return _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32)), c);}(a, b, c);}
+                    static void store(uint64_t* ptr, const __m256i vec) {[](uint64_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __AVX2__
+            #ifdef __SSE2__
+                template <>
+                struct Fixed<isa::SSE2, op::Fma, uint64_t> {
+                    static constexpr size_t lanes = 2;
+                    static __m128i load(const uint64_t* ptr) {return [](const uint64_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}(ptr);}
+                    static __m128i set1(const uint64_t value) {return _mm_set1_epi64x(value);}
+                    static __m128i apply(const __m128i a, const __m128i b, const __m128i c) {return [](const __m128i a, const __m128i b, const __m128i c) {const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32))); return _mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32)), c);}(a, b, c);}
+                    static void store(uint64_t* ptr, const __m128i vec) {[](uint64_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}(ptr, vec);}
+                };
+            #endif // __SSE2__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, const std::array<uint64_t, S>& c, std::array<uint64_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, uint64_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <>
+            struct Fixed<void, op::Fma, __uint128_t> {
+                static __uint128_t apply(const __uint128_t a, const __uint128_t b, const __uint128_t c) {return a * b + c;}
+            };
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, const std::array<__uint128_t, S>& c, std::array<__uint128_t, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, __uint128_t>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <>
+            struct Fixed<void, op::Fma, _Float16> {
+                static _Float16 apply(const _Float16 a, const _Float16 b, const _Float16 c) {return std::fma(static_cast<float>(a), static_cast<float>(b), static_cast<float>(c));}
+            };
+            #ifdef EZSIMD_AVX512FP16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512FP16, op::Fma, _Float16> {
+                    static constexpr size_t lanes = 32;
+                    static __m512h load(const _Float16* ptr) {return _mm512_loadu_ph(ptr);}
+                    static __m512h set1(const _Float16 value) {return _mm512_set1_ph(value);}
+                    static __m512h apply(const __m512h a, const __m512h b, const __m512h c) {return _mm512_fmadd_ph(a, b, c);}
+                    static void store(_Float16* ptr, const __m512h vec) {_mm512_storeu_ph(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512FP16
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, const std::array<_Float16, S>& c, std::array<_Float16, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, _Float16>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <>
+            struct Fixed<void, op::Fma, bfloat16> {
+                static bfloat16 apply(const bfloat16 a, const bfloat16 b, const bfloat16 c) {return std::fma(static_cast<float>(a), static_cast<float>(b), static_cast<float>(c));}
+            };
+            #ifdef EZSIMD_AVX512BF16
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512BF16, op::Fma, bfloat16> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const bfloat16* ptr) {return [](const bfloat16* ptr) {return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));}(ptr);}
+                    static __m512 set1(const bfloat16 value) {return [](const bfloat16 value) {return _mm512_set1_ps(static_cast<float>(value));}(value);}
+                    static __m512 apply(const __m512 a, const __m512 b, const __m512 c) {return _mm512_fmadd_ps(a, b, c);}
+                    static void store(bfloat16* ptr, const __m512 vec) {[](bfloat16* ptr, const __m512 vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reinterpret_cast<__m256i>(_mm512_cvtneps_pbh(vec)));}(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512BF16
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, const std::array<bfloat16, S>& c, std::array<bfloat16, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, bfloat16>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // bfloat16
 
         #pragma region // float
-            __attribute__((target("default")))
-            inline void subBackend(const float* a, const float* b, float* c, const size_t l);
+            template <>
+            struct Fixed<void, op::Fma, float> {
+                static float apply(const float a, const float b, const float c) {return std::fma(a, b, c);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, float> {
+                    static constexpr size_t lanes = 16;
+                    static __m512 load(const float* ptr) {return _mm512_loadu_ps(ptr);}
+                    static __m512 set1(const float value) {return _mm512_set1_ps(value);}
+                    static __m512 apply(const __m512 a, const __m512 b, const __m512 c) {return _mm512_fmadd_ps(a, b, c);}
+                    static void store(float* ptr, const __m512 vec) {_mm512_storeu_ps(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __FMA__
+                template <>
+                struct Fixed<isa::FMA, op::Fma, float> {
+                    static constexpr size_t lanes = 8;
+                    static __m256 load(const float* ptr) {return _mm256_loadu_ps(ptr);}
+                    static __m256 set1(const float value) {return _mm256_set1_ps(value);}
+                    static __m256 apply(const __m256 a, const __m256 b, const __m256 c) {return _mm256_fmadd_ps(a, b, c);}
+                    static void store(float* ptr, const __m256 vec) {_mm256_storeu_ps(ptr, vec);}
+                };
+            #endif // __FMA__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<float, S>& a, const std::array<float, S>& b, const std::array<float, S>& c, std::array<float, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, float>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // float
 
-            #ifdef __SSE__
-                __attribute__((target("sse")))
-                inline void subBackend(const float* a, const float* b, float* c, const size_t l);
-            #endif // __SSE__
+        #pragma region // double
+            template <>
+            struct Fixed<void, op::Fma, double> {
+                static double apply(const double a, const double b, const double c) {return std::fma(a, b, c);}
+            };
+            #ifdef EZSIMD_AVX512
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+                #pragma GCC diagnostic ignored "-Wuninitialized"
+                template <>
+                struct Fixed<isa::AVX512, op::Fma, double> {
+                    static constexpr size_t lanes = 8;
+                    static __m512d load(const double* ptr) {return _mm512_loadu_pd(ptr);}
+                    static __m512d set1(const double value) {return _mm512_set1_pd(value);}
+                    static __m512d apply(const __m512d a, const __m512d b, const __m512d c) {return _mm512_fmadd_pd(a, b, c);}
+                    static void store(double* ptr, const __m512d vec) {_mm512_storeu_pd(ptr, vec);}
+                };
+                #pragma GCC diagnostic pop
+            #endif // EZSIMD_AVX512
+            #ifdef __FMA__
+                template <>
+                struct Fixed<isa::FMA, op::Fma, double> {
+                    static constexpr size_t lanes = 4;
+                    static __m256d load(const double* ptr) {return _mm256_loadu_pd(ptr);}
+                    static __m256d set1(const double value) {return _mm256_set1_pd(value);}
+                    static __m256d apply(const __m256d a, const __m256d b, const __m256d c) {return _mm256_fmadd_pd(a, b, c);}
+                    static void store(double* ptr, const __m256d vec) {_mm256_storeu_pd(ptr, vec);}
+                };
+            #endif // __FMA__
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<double, S>& a, const std::array<double, S>& b, const std::array<double, S>& c, std::array<double, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, double>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // double
 
-            #ifdef __AVX__
-                __attribute__((target("avx")))
-                inline void subBackend(const float* a, const float* b, float* c, const size_t l);
-            #endif // __AVX__
+        #pragma region // long double
+            template <>
+            struct Fixed<void, op::Fma, long double> {
+                static long double apply(const long double a, const long double b, const long double c) {return std::fma(a, b, c);}
+            };
+
+            template <size_t S, typename Isa>
+            void fma(const std::array<long double, S>& a, const std::array<long double, S>& b, const std::array<long double, S>& c, std::array<long double, S>& d) {
+                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {
+                    dispatch<op::Fma, long double>()(a.data(), b.data(), c.data(), d.data(), S);
+                } else {
+                    fixedCapped<Isa, op::Fma, S>(maxIsa(), d.data(), a.data(), b.data(), c.data());
+                }
+            }
+        #pragma endregion // long double
+    #pragma endregion // fma
+    
+    #pragma region // sum
+        #pragma region // int8_t
+            template <size_t S>
+            int8_t sum(const std::array<int8_t, S>& a) {
+                return dispatch<op::Sum, int8_t>()(a.data(), S);
+            }
+        #pragma endregion // int8_t
 
+        #pragma region // int16_t
             template <size_t S>
-            void sub(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+            int16_t sum(const std::array<int16_t, S>& a) {
+                return dispatch<op::Sum, int16_t>()(a.data(), S);
+            }
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <size_t S>
+            int32_t sum(const std::array<int32_t, S>& a) {
+                return dispatch<op::Sum, int32_t>()(a.data(), S);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <size_t S>
+            int64_t sum(const std::array<int64_t, S>& a) {
+                return dispatch<op::Sum, int64_t>()(a.data(), S);
+            }
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <size_t S>
+            __int128_t sum(const std::array<__int128_t, S>& a) {
+                return dispatch<op::Sum, __int128_t>()(a.data(), S);
+            }
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <size_t S>
+            uint8_t sum(const std::array<uint8_t, S>& a) {
+                return dispatch<op::Sum, uint8_t>()(a.data(), S);
+            }
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <size_t S>
+            uint16_t sum(const std::array<uint16_t, S>& a) {
+                return dispatch<op::Sum, uint16_t>()(a.data(), S);
+            }
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <size_t S>
+            uint32_t sum(const std::array<uint32_t, S>& a) {
+                return dispatch<op::Sum, uint32_t>()(a.data(), S);
+            }
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <size_t S>
+            uint64_t sum(const std::array<uint64_t, S>& a) {
+                return dispatch<op::Sum, uint64_t>()(a.data(), S);
+            }
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <size_t S>
+            __uint128_t sum(const std::array<__uint128_t, S>& a) {
+                return dispatch<op::Sum, __uint128_t>()(a.data(), S);
+            }
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <size_t S>
+            _Float16 sum(const std::array<_Float16, S>& a) {
+                return dispatch<op::Sum, _Float16>()(a.data(), S);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <size_t S>
+            bfloat16 sum(const std::array<bfloat16, S>& a) {
+                return dispatch<op::Sum, bfloat16>()(a.data(), S);
+            }
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <size_t S>
+            float sum(const std::array<float, S>& a) {
+                return dispatch<op::Sum, float>()(a.data(), S);
             }
         #pragma endregion // float
 
         #pragma region // double
-            __attribute__((target("default")))
-            inline void subBackend(const double* a, const double* b, double* c, const size_t l);
+            template <size_t S>
+            double sum(const std::array<double, S>& a) {
+                return dispatch<op::Sum, double>()(a.data(), S);
+            }
+        #pragma endregion // double
 
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void subBackend(const double* a, const double* b, double* c, const size_t l);
-            #endif // __SSE2__
+        #pragma region // long double
+            template <size_t S>
+            long double sum(const std::array<long double, S>& a) {
+                return dispatch<op::Sum, long double>()(a.data(), S);
+            }
+        #pragma endregion // long double
+    #pragma endregion // sum
+    
+    #pragma region // min
+        #pragma region // int8_t
+            template <size_t S>
+            int8_t min(const std::array<int8_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, int8_t>()(a.data(), S);
+            }
+        #pragma endregion // int8_t
 
-            #ifdef __AVX__
-                __attribute__((target("avx")))
-                inline void subBackend(const double* a, const double* b, double* c, const size_t l);
-            #endif // __AVX__
+        #pragma region // int16_t
+            template <size_t S>
+            int16_t min(const std::array<int16_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, int16_t>()(a.data(), S);
+            }
+        #pragma endregion // int16_t
 
+        #pragma region // int32_t
             template <size_t S>
-            void sub(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+            int32_t min(const std::array<int32_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, int32_t>()(a.data(), S);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <size_t S>
+            int64_t min(const std::array<int64_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, int64_t>()(a.data(), S);
+            }
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <size_t S>
+            __int128_t min(const std::array<__int128_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, __int128_t>()(a.data(), S);
+            }
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <size_t S>
+            uint8_t min(const std::array<uint8_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, uint8_t>()(a.data(), S);
+            }
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <size_t S>
+            uint16_t min(const std::array<uint16_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, uint16_t>()(a.data(), S);
+            }
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <size_t S>
+            uint32_t min(const std::array<uint32_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, uint32_t>()(a.data(), S);
+            }
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <size_t S>
+            uint64_t min(const std::array<uint64_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, uint64_t>()(a.data(), S);
+            }
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <size_t S>
+            __uint128_t min(const std::array<__uint128_t, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, __uint128_t>()(a.data(), S);
+            }
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <size_t S>
+            _Float16 min(const std::array<_Float16, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, _Float16>()(a.data(), S);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <size_t S>
+            bfloat16 min(const std::array<bfloat16, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, bfloat16>()(a.data(), S);
+            }
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <size_t S>
+            float min(const std::array<float, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, float>()(a.data(), S);
+            }
+        #pragma endregion // float
+
+        #pragma region // double
+            template <size_t S>
+            double min(const std::array<double, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, double>()(a.data(), S);
             }
         #pragma endregion // double
 
         #pragma region // long double
-            __attribute__((target("default")))
-            inline void subBackend(const long double* a, const long double* b, long double* c, const size_t l);
+            template <size_t S>
+            long double min(const std::array<long double, S>& a) {
+                static_assert(S != 0, "min of an empty array");
+                return dispatch<op::Min, long double>()(a.data(), S);
+            }
+        #pragma endregion // long double
+    #pragma endregion // min
+    
+    #pragma region // max
+        #pragma region // int8_t
+            template <size_t S>
+            int8_t max(const std::array<int8_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, int8_t>()(a.data(), S);
+            }
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <size_t S>
+            int16_t max(const std::array<int16_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, int16_t>()(a.data(), S);
+            }
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <size_t S>
+            int32_t max(const std::array<int32_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, int32_t>()(a.data(), S);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // int64_t
+            template <size_t S>
+            int64_t max(const std::array<int64_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, int64_t>()(a.data(), S);
+            }
+        #pragma endregion // int64_t
+
+        #pragma region // __int128_t
+            template <size_t S>
+            __int128_t max(const std::array<__int128_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, __int128_t>()(a.data(), S);
+            }
+        #pragma endregion // __int128_t
+
+        #pragma region // uint8_t
+            template <size_t S>
+            uint8_t max(const std::array<uint8_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, uint8_t>()(a.data(), S);
+            }
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <size_t S>
+            uint16_t max(const std::array<uint16_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, uint16_t>()(a.data(), S);
+            }
+        #pragma endregion // uint16_t
 
+        #pragma region // uint32_t
+            template <size_t S>
+            uint32_t max(const std::array<uint32_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, uint32_t>()(a.data(), S);
+            }
+        #pragma endregion // uint32_t
+
+        #pragma region // uint64_t
+            template <size_t S>
+            uint64_t max(const std::array<uint64_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, uint64_t>()(a.data(), S);
+            }
+        #pragma endregion // uint64_t
+
+        #pragma region // __uint128_t
+            template <size_t S>
+            __uint128_t max(const std::array<__uint128_t, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, __uint128_t>()(a.data(), S);
+            }
+        #pragma endregion // __uint128_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <size_t S>
+            _Float16 max(const std::array<_Float16, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, _Float16>()(a.data(), S);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <size_t S>
+            bfloat16 max(const std::array<bfloat16, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, bfloat16>()(a.data(), S);
+            }
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <size_t S>
+            float max(const std::array<float, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, float>()(a.data(), S);
+            }
+        #pragma endregion // float
+
+        #pragma region // double
+            template <size_t S>
+            double max(const std::array<double, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, double>()(a.data(), S);
+            }
+        #pragma endregion // double
+
+        #pragma region // long double
             template <size_t S>
-            void sub(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c) {
-                subBackend(a.data(), b.data(), c.data(), S);
+            long double max(const std::array<long double, S>& a) {
+                static_assert(S != 0, "max of an empty array");
+                return dispatch<op::Max, long double>()(a.data(), S);
             }
         #pragma endregion // long double
-    #pragma endregion // sub
+    #pragma endregion // max
     
-    #pragma region // mul
+    #pragma region // dot
         #pragma region // int8_t
-            __attribute__((target("default")))
-            inline void mulBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
-
             template <size_t S>
-            void mul(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            int8_t dot(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b) {
+                return dispatch<op::Dot, int8_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // int8_t
 
         #pragma region // int16_t
-            __attribute__((target("default")))
-            inline void mulBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void mulBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void mulBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-            #endif // __SSE2__
-
-            #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void mulBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-            #endif // __AVX2__
-
             template <size_t S>
-            void mul(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            int16_t dot(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b) {
+                return dispatch<op::Dot, int16_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // int16_t
 
         #pragma region // int32_t
-            __attribute__((target("default")))
-            inline void mulBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
-
-            #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void mulBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
-            #endif // __AVX2__
-
             template <size_t S>
-            void mul(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            int32_t dot(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b) {
+                return dispatch<op::Dot, int32_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // int32_t
 
         #pragma region // int64_t
-            __attribute__((target("default")))
-            inline void mulBackend(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
-
             template <size_t S>
-            void mul(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            int64_t dot(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b) {
+                return dispatch<op::Dot, int64_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // int64_t
 
         #pragma region // __int128_t
-            __attribute__((target("default")))
-            inline void mulBackend(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
-
             template <size_t S>
-            void mul(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            __int128_t dot(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b) {
+                return dispatch<op::Dot, __int128_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // __int128_t
 
         #pragma region // uint8_t
-            __attribute__((target("default")))
-            inline void mulBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
-
             template <size_t S>
-            void mul(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            uint8_t dot(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b) {
+                return dispatch<op::Dot, uint8_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // uint8_t
 
         #pragma region // uint16_t
-            __attribute__((target("default")))
-            inline void mulBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-
-            #ifdef __MMX__
-                __attribute__((target("mmx")))
-                inline void mulBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-            #endif // __MMX__
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void mulBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-            #endif // __SSE2__
-
-            #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void mulBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-            #endif // __AVX2__
-
             template <size_t S>
-            void mul(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            uint16_t dot(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b) {
+                return dispatch<op::Dot, uint16_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // uint16_t
 
         #pragma region // uint32_t
-            __attribute__((target("default")))
-            inline void mulBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
-
-            #ifdef __AVX2__
-                __attribute__((target("avx2")))
-                inline void mulBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
-            #endif // __AVX2__
-
             template <size_t S>
-            void mul(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            uint32_t dot(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b) {
+                return dispatch<op::Dot, uint32_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // uint32_t
 
         #pragma region // uint64_t
-            __attribute__((target("default")))
-            inline void mulBackend(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
-
             template <size_t S>
-            void mul(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            uint64_t dot(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b) {
+                return dispatch<op::Dot, uint64_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // uint64_t
 
         #pragma region // __uint128_t
-            __attribute__((target("default")))
-            inline void mulBackend(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
-
             template <size_t S>
-            void mul(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            __uint128_t dot(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b) {
+                return dispatch<op::Dot, __uint128_t>()(a.data(), b.data(), S);
             }
         #pragma endregion // __uint128_t
 
-        #pragma region // float
-            __attribute__((target("default")))
-            inline void mulBackend(const float* a, const float* b, float* c, const size_t l);
-
-            #ifdef __SSE__
-                __attribute__((target("sse")))
-                inline void mulBackend(const float* a, const float* b, float* c, const size_t l);
-            #endif // __SSE__
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <size_t S>
+            _Float16 dot(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b) {
+                return dispatch<op::Dot, _Float16>()(a.data(), b.data(), S);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
 
-            #ifdef __AVX__
-                __attribute__((target("avx")))
-                inline void mulBackend(const float* a, const float* b, float* c, const size_t l);
-            #endif // __AVX__
+        #pragma region // bfloat16
+            template <size_t S>
+            bfloat16 dot(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b) {
+                return dispatch<op::Dot, bfloat16>()(a.data(), b.data(), S);
+            }
+        #pragma endregion // bfloat16
 
+        #pragma region // float
             template <size_t S>
-            void mul(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            float dot(const std::array<float, S>& a, const std::array<float, S>& b) {
+                return dispatch<op::Dot, float>()(a.data(), b.data(), S);
             }
         #pragma endregion // float
 
         #pragma region // double
-            __attribute__((target("default")))
-            inline void mulBackend(const double* a, const double* b, double* c, const size_t l);
-
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void mulBackend(const double* a, const double* b, double* c, const size_t l);
-            #endif // __SSE2__
-
-            #ifdef __AVX__
-                __attribute__((target("avx")))
-                inline void mulBackend(const double* a, const double* b, double* c, const size_t l);
-            #endif // __AVX__
-
             template <size_t S>
-            void mul(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            double dot(const std::array<double, S>& a, const std::array<double, S>& b) {
+                return dispatch<op::Dot, double>()(a.data(), b.data(), S);
             }
         #pragma endregion // double
 
         #pragma region // long double
-            __attribute__((target("default")))
-            inline void mulBackend(const long double* a, const long double* b, long double* c, const size_t l);
-
             template <size_t S>
-            void mul(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c) {
-                mulBackend(a.data(), b.data(), c.data(), S);
+            long double dot(const std::array<long double, S>& a, const std::array<long double, S>& b) {
+                return dispatch<op::Dot, long double>()(a.data(), b.data(), S);
             }
         #pragma endregion // long double
-    #pragma endregion // mul
+    #pragma endregion // dot
     
-    #pragma region // div
+    #pragma region // addWiden
         #pragma region // int8_t
-            __attribute__((target("default")))
-            inline void divBackend(const int8_t* a, const int8_t* b, int8_t* c, const size_t l);
-
             template <size_t S>
-            void div(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int8_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void addWiden(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int16_t, S>& c) {
+                dispatch<op::AddWiden, int8_t>()(a.data(), b.data(), c.data(), S);
             }
         #pragma endregion // int8_t
 
         #pragma region // int16_t
-            __attribute__((target("default")))
-            inline void divBackend(const int16_t* a, const int16_t* b, int16_t* c, const size_t l);
-
             template <size_t S>
-            void div(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int16_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void addWiden(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int32_t, S>& c) {
+                dispatch<op::AddWiden, int16_t>()(a.data(), b.data(), c.data(), S);
             }
         #pragma endregion // int16_t
 
         #pragma region // int32_t
-            __attribute__((target("default")))
-            inline void divBackend(const int32_t* a, const int32_t* b, int32_t* c, const size_t l);
-
             template <size_t S>
-            void div(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int32_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void addWiden(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int64_t, S>& c) {
+                dispatch<op::AddWiden, int32_t>()(a.data(), b.data(), c.data(), S);
             }
         #pragma endregion // int32_t
 
-        #pragma region // int64_t
-            __attribute__((target("default")))
-            inline void divBackend(const int64_t* a, const int64_t* b, int64_t* c, const size_t l);
+        #pragma region // uint8_t
+            template <size_t S>
+            void addWiden(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint16_t, S>& c) {
+                dispatch<op::AddWiden, uint8_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // uint8_t
 
+        #pragma region // uint16_t
             template <size_t S>
-            void div(const std::array<int64_t, S>& a, const std::array<int64_t, S>& b, std::array<int64_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void addWiden(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint32_t, S>& c) {
+                dispatch<op::AddWiden, uint16_t>()(a.data(), b.data(), c.data(), S);
             }
-        #pragma endregion // int64_t
+        #pragma endregion // uint16_t
 
-        #pragma region // __int128_t
-            __attribute__((target("default")))
-            inline void divBackend(const __int128_t* a, const __int128_t* b, __int128_t* c, const size_t l);
+        #pragma region // uint32_t
+            template <size_t S>
+            void addWiden(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint64_t, S>& c) {
+                dispatch<op::AddWiden, uint32_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // uint32_t
 
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
             template <size_t S>
-            void div(const std::array<__int128_t, S>& a, const std::array<__int128_t, S>& b, std::array<__int128_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void addWiden(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<float, S>& c) {
+                dispatch<op::AddWiden, _Float16>()(a.data(), b.data(), c.data(), S);
             }
-        #pragma endregion // __int128_t
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
 
-        #pragma region // uint8_t
-            __attribute__((target("default")))
-            inline void divBackend(const uint8_t* a, const uint8_t* b, uint8_t* c, const size_t l);
+        #pragma region // bfloat16
+            template <size_t S>
+            void addWiden(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<float, S>& c) {
+                dispatch<op::AddWiden, bfloat16>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // bfloat16
 
+        #pragma region // float
             template <size_t S>
-            void div(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint8_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void addWiden(const std::array<float, S>& a, const std::array<float, S>& b, std::array<double, S>& c) {
+                dispatch<op::AddWiden, float>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // float
+    #pragma endregion // addWiden
+    
+    #pragma region // subWiden
+        #pragma region // int8_t
+            template <size_t S>
+            void subWiden(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int16_t, S>& c) {
+                dispatch<op::SubWiden, int8_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // int8_t
+
+        #pragma region // int16_t
+            template <size_t S>
+            void subWiden(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int32_t, S>& c) {
+                dispatch<op::SubWiden, int16_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <size_t S>
+            void subWiden(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int64_t, S>& c) {
+                dispatch<op::SubWiden, int32_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // uint8_t
+            template <size_t S>
+            void subWiden(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint16_t, S>& c) {
+                dispatch<op::SubWiden, uint8_t>()(a.data(), b.data(), c.data(), S);
             }
         #pragma endregion // uint8_t
 
         #pragma region // uint16_t
-            __attribute__((target("default")))
-            inline void divBackend(const uint16_t* a, const uint16_t* b, uint16_t* c, const size_t l);
-
             template <size_t S>
-            void div(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint16_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void subWiden(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint32_t, S>& c) {
+                dispatch<op::SubWiden, uint16_t>()(a.data(), b.data(), c.data(), S);
             }
         #pragma endregion // uint16_t
 
         #pragma region // uint32_t
-            __attribute__((target("default")))
-            inline void divBackend(const uint32_t* a, const uint32_t* b, uint32_t* c, const size_t l);
-
             template <size_t S>
-            void div(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint32_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void subWiden(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint64_t, S>& c) {
+                dispatch<op::SubWiden, uint32_t>()(a.data(), b.data(), c.data(), S);
             }
         #pragma endregion // uint32_t
 
-        #pragma region // uint64_t
-            __attribute__((target("default")))
-            inline void divBackend(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t l);
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <size_t S>
+            void subWiden(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<float, S>& c) {
+                dispatch<op::SubWiden, _Float16>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
 
+        #pragma region // bfloat16
             template <size_t S>
-            void div(const std::array<uint64_t, S>& a, const std::array<uint64_t, S>& b, std::array<uint64_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void subWiden(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<float, S>& c) {
+                dispatch<op::SubWiden, bfloat16>()(a.data(), b.data(), c.data(), S);
             }
-        #pragma endregion // uint64_t
+        #pragma endregion // bfloat16
 
-        #pragma region // __uint128_t
-            __attribute__((target("default")))
-            inline void divBackend(const __uint128_t* a, const __uint128_t* b, __uint128_t* c, const size_t l);
+        #pragma region // float
+            template <size_t S>
+            void subWiden(const std::array<float, S>& a, const std::array<float, S>& b, std::array<double, S>& c) {
+                dispatch<op::SubWiden, float>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // float
+    #pragma endregion // subWiden
+    
+    #pragma region // mulWiden
+        #pragma region // int8_t
+            template <size_t S>
+            void mulWiden(const std::array<int8_t, S>& a, const std::array<int8_t, S>& b, std::array<int16_t, S>& c) {
+                dispatch<op::MulWiden, int8_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // int8_t
 
+        #pragma region // int16_t
             template <size_t S>
-            void div(const std::array<__uint128_t, S>& a, const std::array<__uint128_t, S>& b, std::array<__uint128_t, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void mulWiden(const std::array<int16_t, S>& a, const std::array<int16_t, S>& b, std::array<int32_t, S>& c) {
+                dispatch<op::MulWiden, int16_t>()(a.data(), b.data(), c.data(), S);
             }
-        #pragma endregion // __uint128_t
+        #pragma endregion // int16_t
+
+        #pragma region // int32_t
+            template <size_t S>
+            void mulWiden(const std::array<int32_t, S>& a, const std::array<int32_t, S>& b, std::array<int64_t, S>& c) {
+                dispatch<op::MulWiden, int32_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // uint8_t
+            template <size_t S>
+            void mulWiden(const std::array<uint8_t, S>& a, const std::array<uint8_t, S>& b, std::array<uint16_t, S>& c) {
+                dispatch<op::MulWiden, uint8_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // uint8_t
+
+        #pragma region // uint16_t
+            template <size_t S>
+            void mulWiden(const std::array<uint16_t, S>& a, const std::array<uint16_t, S>& b, std::array<uint32_t, S>& c) {
+                dispatch<op::MulWiden, uint16_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <size_t S>
+            void mulWiden(const std::array<uint32_t, S>& a, const std::array<uint32_t, S>& b, std::array<uint64_t, S>& c) {
+                dispatch<op::MulWiden, uint32_t>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // uint32_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <size_t S>
+            void mulWiden(const std::array<_Float16, S>& a, const std::array<_Float16, S>& b, std::array<float, S>& c) {
+                dispatch<op::MulWiden, _Float16>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <size_t S>
+            void mulWiden(const std::array<bfloat16, S>& a, const std::array<bfloat16, S>& b, std::array<float, S>& c) {
+                dispatch<op::MulWiden, bfloat16>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // bfloat16
 
         #pragma region // float
-            __attribute__((target("default")))
-            inline void divBackend(const float* a, const float* b, float* c, const size_t l);
+            template <size_t S>
+            void mulWiden(const std::array<float, S>& a, const std::array<float, S>& b, std::array<double, S>& c) {
+                dispatch<op::MulWiden, float>()(a.data(), b.data(), c.data(), S);
+            }
+        #pragma endregion // float
+    #pragma endregion // mulWiden
+    
+    #pragma region // widen
+        #pragma region // int8_t
+            template <size_t S>
+            void widen(const std::array<int8_t, S>& a, std::array<int16_t, S>& c) {
+                dispatch<op::Widen, int8_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // int8_t
 
-            #ifdef __SSE__
-                __attribute__((target("sse")))
-                inline void divBackend(const float* a, const float* b, float* c, const size_t l);
-            #endif // __SSE__
+        #pragma region // int16_t
+            template <size_t S>
+            void widen(const std::array<int16_t, S>& a, std::array<int32_t, S>& c) {
+                dispatch<op::Widen, int16_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // int16_t
 
-            #ifdef __AVX__
-                __attribute__((target("avx")))
-                inline void divBackend(const float* a, const float* b, float* c, const size_t l);
-            #endif // __AVX__
+        #pragma region // int32_t
+            template <size_t S>
+            void widen(const std::array<int32_t, S>& a, std::array<int64_t, S>& c) {
+                dispatch<op::Widen, int32_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // int32_t
+
+        #pragma region // uint8_t
+            template <size_t S>
+            void widen(const std::array<uint8_t, S>& a, std::array<uint16_t, S>& c) {
+                dispatch<op::Widen, uint8_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // uint8_t
 
+        #pragma region // uint16_t
             template <size_t S>
-            void div(const std::array<float, S>& a, const std::array<float, S>& b, std::array<float, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void widen(const std::array<uint16_t, S>& a, std::array<uint32_t, S>& c) {
+                dispatch<op::Widen, uint16_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // uint16_t
+
+        #pragma region // uint32_t
+            template <size_t S>
+            void widen(const std::array<uint32_t, S>& a, std::array<uint64_t, S>& c) {
+                dispatch<op::Widen, uint32_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // uint32_t
+
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
+            template <size_t S>
+            void widen(const std::array<_Float16, S>& a, std::array<float, S>& c) {
+                dispatch<op::Widen, _Float16>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <size_t S>
+            void widen(const std::array<bfloat16, S>& a, std::array<float, S>& c) {
+                dispatch<op::Widen, bfloat16>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <size_t S>
+            void widen(const std::array<float, S>& a, std::array<double, S>& c) {
+                dispatch<op::Widen, float>()(a.data(), c.data(), S);
             }
         #pragma endregion // float
+    #pragma endregion // widen
+    
+    #pragma region // narrow
+        #pragma region // int8_t
+            template <size_t S>
+            void narrow(const std::array<int16_t, S>& a, std::array<int8_t, S>& c) {
+                dispatch<op::Narrow, int8_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // int8_t
 
-        #pragma region // double
-            __attribute__((target("default")))
-            inline void divBackend(const double* a, const double* b, double* c, const size_t l);
+        #pragma region // int16_t
+            template <size_t S>
+            void narrow(const std::array<int32_t, S>& a, std::array<int16_t, S>& c) {
+                dispatch<op::Narrow, int16_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // int16_t
 
-            #ifdef __SSE2__
-                __attribute__((target("sse2")))
-                inline void divBackend(const double* a, const double* b, double* c, const size_t l);
-            #endif // __SSE2__
+        #pragma region // int32_t
+            template <size_t S>
+            void narrow(const std::array<int64_t, S>& a, std::array<int32_t, S>& c) {
+                dispatch<op::Narrow, int32_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // int32_t
 
-            #ifdef __AVX__
-                __attribute__((target("avx")))
-                inline void divBackend(const double* a, const double* b, double* c, const size_t l);
-            #endif // __AVX__
+        #pragma region // uint8_t
+            template <size_t S>
+            void narrow(const std::array<uint16_t, S>& a, std::array<uint8_t, S>& c) {
+                dispatch<op::Narrow, uint8_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // uint8_t
 
+        #pragma region // uint16_t
             template <size_t S>
-            void div(const std::array<double, S>& a, const std::array<double, S>& b, std::array<double, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void narrow(const std::array<uint32_t, S>& a, std::array<uint16_t, S>& c) {
+                dispatch<op::Narrow, uint16_t>()(a.data(), c.data(), S);
             }
-        #pragma endregion // double
+        #pragma endregion // uint16_t
 
-        #pragma region // long double
-            __attribute__((target("default")))
-            inline void divBackend(const long double* a, const long double* b, long double* c, const size_t l);
+        #pragma region // uint32_t
+            template <size_t S>
+            void narrow(const std::array<uint64_t, S>& a, std::array<uint32_t, S>& c) {
+                dispatch<op::Narrow, uint32_t>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // uint32_t
 
+        #ifdef EZSIMD_FLOAT16
+        #pragma region // _Float16
             template <size_t S>
-            void div(const std::array<long double, S>& a, const std::array<long double, S>& b, std::array<long double, S>& c) {
-                divBackend(a.data(), b.data(), c.data(), S);
+            void narrow(const std::array<float, S>& a, std::array<_Float16, S>& c) {
+                dispatch<op::Narrow, _Float16>()(a.data(), c.data(), S);
             }
-        #pragma endregion // long double
-    #pragma endregion // div
+        #pragma endregion // _Float16
+        #endif // EZSIMD_FLOAT16
+
+        #pragma region // bfloat16
+            template <size_t S>
+            void narrow(const std::array<float, S>& a, std::array<bfloat16, S>& c) {
+                dispatch<op::Narrow, bfloat16>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // bfloat16
+
+        #pragma region // float
+            template <size_t S>
+            void narrow(const std::array<double, S>& a, std::array<float, S>& c) {
+                dispatch<op::Narrow, float>()(a.data(), c.data(), S);
+            }
+        #pragma endregion // float
+    #pragma endregion // narrow
+    
+    #pragma region // aligned_allocator
+        template <typename T, size_t Align>
+        template <typename U>
+        aligned_allocator<T, Align>::aligned_allocator(const aligned_allocator<U, Align>&) noexcept {}
+        
+        template <typename T, size_t Align>
+        T* aligned_allocator<T, Align>::allocate(const size_t n) {
+            if (n > (SIZE_MAX - alignment) / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            
+            const size_t bytes = (n * sizeof(T) + alignment - 1) / alignment * alignment;
+            return static_cast<T*>(::operator new(bytes, std::align_val_t(alignment)));
+        }
+        
+        template <typename T, size_t Align>
+        void aligned_allocator<T, Align>::deallocate(T* ptr, size_t) noexcept {
+            ::operator delete(ptr, std::align_val_t(alignment));
+        }
+        
+        template <typename T, size_t Align>
+        template <typename U>
+        bool aligned_allocator<T, Align>::operator==(const aligned_allocator<U, Align>&) const noexcept {
+            return true;
+        }
+        
+        template <typename T, size_t Align>
+        template <typename U>
+        bool aligned_allocator<T, Align>::operator!=(const aligned_allocator<U, Align>&) const noexcept {
+            return false;
+        }
+    #pragma endregion // aligned_allocator
+    
+    #pragma region // scratch
+        template <typename T>
+        T* Scratch::allocate(const size_t n) {
+            static_assert(alignof(T) <= simdAlignment, "Scratch can't align T");
+            
+            if (n > SIZE_MAX / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            
+            return static_cast<T*>(allocateBytes(n * sizeof(T)));
+        }
+        
+        template <typename T>
+        T* ScratchScope::allocate(const size_t n) {
+            return arena.allocate<T>(n);
+        }
+    #pragma endregion // scratch
+    
+    #pragma region // expressions
+        // an array in an expression, read one vector at a time
+        template <typename T>
+        struct ExprArray {
+            using type = T;
+            const T* data;
+            size_t size;
+        };
+        
+        // a single value in an expression, applied to every element like the broadcast overloads
+        template <typename T>
+        struct ExprValue {
+            using type = T;
+            T value;
+        };
+        
+        // a op b on every element, a and b are ExprArray, ExprValue, or other ExprNodes of the same type
+        template <typename Op, typename A, typename B>
+        struct ExprNode {
+            using type = typename A::type;
+            A a;
+            B b;
+        };
+        
+        template <typename E>
+        struct IsExpr : std::false_type {};
+        
+        template <typename T>
+        struct IsExpr<ExprArray<T>> : std::true_type {};
+        
+        template <typename Op, typename A, typename B>
+        struct IsExpr<ExprNode<Op, A, B>> : std::true_type {};
+        
+        template <typename T, typename Alloc>
+        ExprArray<T> expr(const std::vector<T, Alloc>& a) {
+            return {a.data(), a.size()};
+        }
+        
+        template <typename T, size_t S>
+        ExprArray<T> expr(const std::array<T, S>& a) {
+            return {a.data(), S};
+        }
+        
+        template <typename T>
+        ExprArray<T> expr(const T* a, const size_t l) {
+            return {a, l};
+        }
+        
+        // the other operand of + - * / as an expression of element type T
+        template <typename T>
+        inline ExprArray<T> exprOperand(const ExprArray<T>& e) {
+            return e;
+        }
+        
+        template <typename T, typename Op, typename A, typename B>
+        inline ExprNode<Op, A, B> exprOperand(const ExprNode<Op, A, B>& e) {
+            static_assert(std::is_same<T, typename A::type>::value, "every array in an expression must have the same element type");
+            return e;
+        }
+        
+        template <typename T, typename Alloc>
+        inline ExprArray<T> exprOperand(const std::vector<T, Alloc>& a) {
+            return {a.data(), a.size()};
+        }
+        
+        template <typename T, size_t S>
+        inline ExprArray<T> exprOperand(const std::array<T, S>& a) {
+            return {a.data(), S};
+        }
+        
+        template <typename T, typename V, typename = typename std::enable_if<std::is_convertible<V, T>::value>::type>
+        inline ExprValue<T> exprOperand(const V& value) {
+            return {static_cast<T>(value)};
+        }
+        
+        template <typename Op, typename A, typename B>
+        inline auto exprCombine(const A& a, const B& b) {
+            using T = typename std::conditional<IsExpr<A>::value, A, B>::type::type;
+            return ExprNode<Op, decltype(exprOperand<T>(a)), decltype(exprOperand<T>(b))>{exprOperand<T>(a), exprOperand<T>(b)};
+        }
+        
+        // only when one side is already an expression, so + - * / on plain vectors and numbers are left alone
+        template <typename A, typename B, typename = typename std::enable_if<IsExpr<A>::value || IsExpr<B>::value>::type>
+        inline auto operator+(const A& a, const B& b) {
+            return exprCombine<op::Add>(a, b);
+        }
+        
+        template <typename A, typename B, typename = typename std::enable_if<IsExpr<A>::value || IsExpr<B>::value>::type>
+        inline auto operator-(const A& a, const B& b) {
+            return exprCombine<op::Sub>(a, b);
+        }
+        
+        template <typename A, typename B, typename = typename std::enable_if<IsExpr<A>::value || IsExpr<B>::value>::type>
+        inline auto operator*(const A& a, const B& b) {
+            return exprCombine<op::Mul>(a, b);
+        }
+        
+        template <typename A, typename B, typename = typename std::enable_if<IsExpr<A>::value || IsExpr<B>::value>::type>
+        inline auto operator/(const A& a, const B& b) {
+            return exprCombine<op::Div>(a, b);
+        }
+        
+        // element count of an expression, SIZE_MAX for a single value
+        template <typename T>
+        inline size_t exprSize(const ExprArray<T>& e) {
+            return e.size;
+        }
+        
+        template <typename T>
+        inline size_t exprSize(const ExprValue<T>&) {
+            return SIZE_MAX;
+        }
+        
+        template <typename Op, typename A, typename B>
+        inline size_t exprSize(const ExprNode<Op, A, B>& e) {
+            const size_t a = exprSize(e.a);
+            const size_t b = exprSize(e.b);
+            assert(a == b || a == SIZE_MAX || b == SIZE_MAX);
+            return std::min(a, b);
+        }
+        
+        // lanes every op of E has on Isa, 0 if one of them has no Fixed specialization there, SIZE_MAX for arrays and values
+        template <typename Isa, typename E>
+        struct ExprLanes {
+            static constexpr size_t value = SIZE_MAX;
+        };
+        
+        template <typename Isa, typename Op, typename A, typename B>
+        struct ExprLanes<Isa, ExprNode<Op, A, B>> {
+            static constexpr size_t lanes = Fixed<Isa, Op, typename A::type>::lanes;
+            static constexpr size_t a = ExprLanes<Isa, A>::value;
+            static constexpr size_t b = ExprLanes<Isa, B>::value;
+            static constexpr size_t value = lanes != 0 && (a == SIZE_MAX || a == lanes) && (b == SIZE_MAX || b == lanes) ? lanes : 0;
+        };
+        
+        // one vector of the expression at element i, F is the Fixed specialization of the op using it
+        template <typename Isa, typename F, typename T>
+        inline auto exprVector(const ExprArray<T>& e, const size_t i) {
+            return F::load(e.data + i);
+        }
+        
+        template <typename Isa, typename F, typename T>
+        inline auto exprVector(const ExprValue<T>& e, size_t) {
+            return F::set1(e.value);
+        }
+        
+        template <typename Isa, typename F, typename Op, typename A, typename B>
+        inline auto exprVector(const ExprNode<Op, A, B>& e, const size_t i) {
+            using G = Fixed<Isa, Op, typename A::type>;
+            return G::apply(exprVector<Isa, G>(e.a, i), exprVector<Isa, G>(e.b, i));
+        }
+        
+        template <typename T>
+        inline T exprElement(const ExprArray<T>& e, const size_t i) {
+            return e.data[i];
+        }
+        
+        template <typename T>
+        inline T exprElement(const ExprValue<T>& e, size_t) {
+            return e.value;
+        }
+        
+        template <typename Op, typename A, typename B>
+        inline typename A::type exprElement(const ExprNode<Op, A, B>& e, const size_t i) {
+            return Fixed<void, Op, typename A::type>::apply(exprElement(e.a, i), exprElement(e.b, i));
+        }
+        
+        // c[0, l) = e with whole Isa vectors, then the scalar ops for what's left, void is all scalar
+        template <typename Isa, typename Op, typename A, typename B, typename T>
+        inline void exprKernel(const ExprNode<Op, A, B>& e, T* c, const size_t l) {
+            size_t i = 0;
+            
+            if constexpr (!std::is_void<Isa>::value) {
+                using F = Fixed<Isa, Op, T>;
+                for (; i + F::lanes <= l; i += F::lanes) {
+                    F::store(c + i, exprVector<Isa, F>(e, i));
+                }
+            }
+            
+            for (; i < l; i++) {
+                c[i] = exprElement(e, i);
+            }
+        }
+        
+        // the widest instruction set that has every op in e, that this CPU supports, and that maxIsa() allows, starting from Isa
+        template <typename Isa, typename Op, typename A, typename B, typename T>
+        void exprDispatch(const ExprNode<Op, A, B>& e, T* c, const size_t l) {
+            if constexpr (std::is_void<Isa>::value) {
+                exprKernel<void>(e, c, l);
+            } else {
+                if constexpr (ExprLanes<Isa, ExprNode<Op, A, B>>::value != 0) {
+                    if (Isa::tier <= maxIsa() && cpuSupports(Isa::tier)) {
+                        exprKernel<Isa>(e, c, l);
+                        return;
+                    }
+                }
+                
+                exprDispatch<typename NarrowerIsa<Isa>::type>(e, c, l);
+            }
+        }
+        
+        template <typename Op, typename A, typename B>
+        void eval(const ExprNode<Op, A, B>& e, typename A::type* c) {
+            exprDispatch<isa::AVX512FP16>(e, c, exprSize(e));
+        }
+        
+        template <typename Op, typename A, typename B, typename Alloc>
+        void eval(const ExprNode<Op, A, B>& e, std::vector<typename A::type, Alloc>& c) {
+            assert(c.size() >= exprSize(e));
+            exprDispatch<isa::AVX512FP16>(e, c.data(), exprSize(e));
+        }
+        
+        template <typename Op, typename A, typename B, size_t S>
+        void eval(const ExprNode<Op, A, B>& e, std::array<typename A::type, S>& c) {
+            assert(S >= exprSize(e));
+            exprDispatch<isa::AVX512FP16>(e, c.data(), exprSize(e));
+        }
+    #pragma endregion // expressions
 } // namespace ezsimd
\ No newline at end of file
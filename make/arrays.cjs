@@ -4,17 +4,52 @@ const simdType = [
     "SSE2",
     "AVX",
     "AVX2",
+    "FMA",
+    "F16C",
+    "AVX512",
+    "AVX512BF16",
+    "AVX512FP16",
 ];
 
 const opType = [
     "ADD",
     "SUB",
+    "ADDS",
+    "SUBS",
     "MUL",
     "DIV",
+    "FMA",
+    "MIN",
+    "MAX",
     "PACK_ALIGNED",
     "PACK_UNALIGNED",
+    "SET_ZERO",
+    "SET1",
     "UNPACK_ALIGNED",
     "UNPACK_UNALIGNED",
+    "PACK_MASKED",
+    "UNPACK_MASKED",
+    "UNPACK_STREAM",
+    "DIVISOR",
+    "DIV_BY",
+    "WIDEN",
+    "NARROW",
+    "MUL_WIDEN",
+];
+
+const reduceType = [
+    "SUM",
+    "MIN",
+    "MAX",
+    "DOT",
+];
+
+const widenType = [
+    "ADD_WIDEN",
+    "SUB_WIDEN",
+    "MUL_WIDEN",
+    "WIDEN",
+    "NARROW",
 ];
 
 const numType = [
@@ -29,6 +64,7 @@ const numType = [
     "UINT64",
     "UINT128",
     "FLOAT16",
+    "BFLOAT16",
     "FLOAT32",
     "FLOAT64",
     "FLOAT128",
@@ -37,5 +73,7 @@ const numType = [
 module.exports = {
     simdType,
     opType,
+    reduceType,
+    widenType,
     numType,
 };
\ No newline at end of file
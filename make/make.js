@@ -5,6 +5,8 @@ const objects = require("./objects.cjs");
 global.simdType = arrays.simdType;
 global.numType = arrays.numType;
 global.opType = arrays.opType;
+global.reduceType = arrays.reduceType;
+global.widenType = arrays.widenType;
 
 global.simdRegTypenames = objects.simdRegTypenames;
 global.supportedOps = objects.supportedOps;
@@ -12,29 +14,1862 @@ global.functions = objects.functions;
 global.simdMeta = objects.simdMeta;
 global.numMeta = objects.numMeta;
 global.opMeta = objects.opMeta;
+global.reduceMeta = objects.reduceMeta;
+global.widenMeta = objects.widenMeta;
+
+// `scalars` lists the args passed as a single value that applies to every element ("const T b")
+
+// "const T* a, const T* b, T* c" for the op's arguments and result
+function pointerParams(_opType, _numType, scalars = []) {
+    return opMeta[_opType].args.map((arg) => "const " + numMeta[_numType].numName + (scalars.includes(arg) ? " " : "* ") + arg).join(", ")
+        + ", " + numMeta[_numType].numName + "* " + opMeta[_opType].result;
+}
+
+function vectorParams(_opType, _numType, scalars = []) {
+    return opMeta[_opType].args.map((arg) => (scalars.includes(arg) ? "const " + numMeta[_numType].numName + " " : "const std::vector<" + numMeta[_numType].numName + ">& ") + arg).join(", ")
+        + ", std::vector<" + numMeta[_numType].numName + ">& " + opMeta[_opType].result;
+}
+
+function arrayParams(_opType, _numType, scalars = []) {
+    return opMeta[_opType].args.map((arg) => (scalars.includes(arg) ? "const " + numMeta[_numType].numName + " " : "const std::array<" + numMeta[_numType].numName + ", S>& ") + arg).join(", ")
+        + ", std::array<" + numMeta[_numType].numName + ", S>& " + opMeta[_opType].result;
+}
+
+// "a, b, c" with `suffix` after each array name, like ".data()" or " + begin"
+function allArgs(_opType, suffix, scalars = []) {
+    return opMeta[_opType].args.concat([opMeta[_opType].result]).map((arg) => scalars.includes(arg) ? arg : arg + suffix).join(", ");
+}
+
+// args that are arrays, loaded from memory every step
+function arrayArgs(_opType, scalars = []) {
+    return opMeta[_opType].args.filter((arg) => !scalars.includes(arg));
+}
+
+// scalar expression for element i
+function scalarExpr(_opType, _numType, scalars = []) {
+    const args = opMeta[_opType].args.map((arg) => scalars.includes(arg) ? arg : arg + "[i]");
+
+    if (_opType == "FMA") {
+        // std::fma rounds once like the FMA instructions do, half-precision types go through float like their SIMD functions
+        if (_numType == "FLOAT16" || _numType == "BFLOAT16") {
+            return "std::fma(" + args.map((arg) => "static_cast<float>(" + arg + ")").join(", ") + ")";
+        }
+
+        return numMeta[_numType].numName == "float" || numMeta[_numType].numName == "double" || numMeta[_numType].numName == "long double"
+            ? "std::fma(" + args.join(", ") + ")"
+            : args[0] + " * " + args[1] + " + " + args[2];
+    }
+
+    if (opMeta[_opType].scalar) {
+        return opMeta[_opType].scalar + "(" + args.join(", ") + ")";
+    }
+
+    return args[0] + " " + opMeta[_opType].op + " " + args[1];
+}
+
+function isInteger(_numType) {
+    return _numType.startsWith("INT") || _numType.startsWith("UINT");
+}
+
+// function applying the op to vectors, the broadcast DIV divides by a DIVISOR prepared once per call where a tier has one
+function opFunction(_simdType, _opType, _numType, scalars = []) {
+    return _opType == "DIV" && scalars.length && functions[_simdType]["DIV_BY"] && functions[_simdType]["DIV_BY"][_numType]
+        ? functions[_simdType]["DIV_BY"][_numType]
+        : functions[_simdType][_opType][_numType]
+    ;
+}
+
+// one vector of result = op(args) at element offset `at`, using the given PACK/UNPACK function set
+function vectorStep(_simdType, _opType, _numType, indent, at, pack, unpack, scalars = []) {
+    const args = opMeta[_opType].args;
+    const result = opMeta[_opType].result;
+    let step = "";
+
+    for (const arg of arrayArgs(_opType, scalars)) {
+        step += "\n" + indent + "vec_" + arg + " = " + functions[_simdType][pack][_numType] + "(" + arg + " + " + at + ");";
+    }
+
+    return step
+        + "\n" + indent + "vec_" + result + " = " + opFunction(_simdType, _opType, _numType, scalars) + "(" + args.map((arg) => "vec_" + arg).join(", ") + ");"
+        + "\n" + indent + functions[_simdType][unpack][_numType] + "(" + result + " + " + at + ", vec_" + result + ");"
+    ;
+}
+
+// first n elements of result = op(args) at element offset `at`, using masked load/store
+function maskedStep(_simdType, _opType, _numType, indent, at, n, scalars = []) {
+    const args = opMeta[_opType].args;
+    const result = opMeta[_opType].result;
+    let step = "";
+
+    for (const arg of arrayArgs(_opType, scalars)) {
+        step += "\n" + indent + "vec_" + arg + " = " + functions[_simdType]["PACK_MASKED"][_numType] + "(" + arg + " + " + at + ", " + n + ");";
+    }
+
+    return step
+        + "\n" + indent + "vec_" + result + " = " + opFunction(_simdType, _opType, _numType, scalars) + "(" + args.map((arg) => "vec_" + arg).join(", ") + ");"
+        + "\n" + indent + functions[_simdType]["UNPACK_MASKED"][_numType] + "(" + result + " + " + at + ", vec_" + result + ", " + n + ");"
+    ;
+}
+
+// `count` independent vectors of result = op(args) starting at element offset `at`, all loads issued before the ops and stores
+function unrolledStep(_simdType, _opType, _numType, indent, at, count, pack, unpack, scalars = []) {
+    const lanes = simdMeta[_simdType].bitSize / numMeta[_numType].bitSize;
+    const args = opMeta[_opType].args;
+    const result = opMeta[_opType].result;
+    let step = "";
+
+    for (let u = 0; u < count; u++) {
+        for (const arg of arrayArgs(_opType, scalars)) {
+            step += "\n" + indent + "const " + simdRegTypenames[_simdType][_numType] + " vec_" + arg + u + " = " + functions[_simdType][pack][_numType] + "(" + arg + " + " + at + (u ? " + " + (u * lanes) : "") + ");";
+        }
+    }
+
+    for (let u = 0; u < count; u++) {
+        step += "\n" + indent + "const " + simdRegTypenames[_simdType][_numType] + " vec_" + result + u + " = " + opFunction(_simdType, _opType, _numType, scalars) + "(" + args.map((arg) => "vec_" + arg + (scalars.includes(arg) ? "" : u)).join(", ") + ");";
+    }
+
+    for (let u = 0; u < count; u++) {
+        step += "\n" + indent + functions[_simdType][unpack][_numType] + "(" + result + " + " + at + (u ? " + " + (u * lanes) : "") + ", vec_" + result + u + ");";
+    }
+
+    return step;
+}
+
+// prefetch the args EZSIMD_PREFETCH_DISTANCE bytes ahead, one per cache line an unrolled iteration covers (prefetch needs SSE)
+function prefetchStep(_simdType, args, indent) {
+    if (_simdType == "MMX") {
+        return "";
+    }
+
+    const lines = Math.max(simdMeta[_simdType].unroll * simdMeta[_simdType].bitSize / 8 / 64, 1);
+    let step = "\n" + indent + "#ifdef EZSIMD_PREFETCH_DISTANCE";
+
+    for (let line = 0; line < lines; line++) {
+        for (const arg of args) {
+            step += "\n" + indent + "    _mm_prefetch(reinterpret_cast<const char*>(" + arg + " + i) + EZSIMD_PREFETCH_DISTANCE" + (line ? " + " + (line * 64) : "") + ", _MM_HINT_T0);";
+        }
+    }
+
+    return step + "\n" + indent + "#endif";
+}
+
+// steady-state loops: unrolled by simdMeta unroll while enough elements are left, then one vector at a time
+// with whole, the last vector runs even if fewer than lanes elements are left, for arrays padded to whole vectors
+function steadyLoops(_simdType, _opType, _numType, indent, pack, unpack, scalars = [], whole = false) {
+    const lanes = simdMeta[_simdType].bitSize / numMeta[_numType].bitSize;
+    const unroll = simdMeta[_simdType].unroll;
+    let loops = "";
+
+    if (unroll > 1) {
+        loops += ""
+            + "\n" + indent + "for (; i + " + (unroll * lanes - 1) + " < l; i += " + (unroll * lanes) + ") {"
+            + prefetchStep(_simdType, arrayArgs(_opType, scalars), indent + "    ")
+            + unrolledStep(_simdType, _opType, _numType, indent + "    ", "i", unroll, pack, unpack, scalars)
+            + "\n" + indent + "}"
+            + "\n" + indent
+        ;
+    }
+
+    loops += ""
+        + "\n" + indent + "for (; i " + (whole ? "" : "+ " + (lanes - 1) + " ") + "< l; i += " + lanes + ") {"
+        + vectorStep(_simdType, _opType, _numType, indent + "    ", "i", pack, unpack, scalars)
+        + "\n" + indent + "}"
+    ;
+
+    return loops;
+}
+
+function scalarLoop(_opType, _numType, indent, start, end, scalars = []) {
+    return ""
+        + "\n" + indent + "for (" + start + "; i < " + end + "; i++) {"
+        + "\n" + indent + "    " + opMeta[_opType].result + "[i] = " + scalarExpr(_opType, _numType, scalars) + ";"
+        + "\n" + indent + "}"
+    ;
+}
+
+// partially overlapping args are copied first, so every backend reads all of its args before writing the result like memmove,
+// call is what runs on the copies, like "addBackendAVX2("
+function overlapGuard(_opType, _numType, indent, call, scalars = []) {
+    const loaded = arrayArgs(_opType, scalars);
+    const result = opMeta[_opType].result;
+
+    return ""
+        + "\n" + indent + "if (" + loaded.map((arg) => "partiallyOverlaps(" + arg + ", " + result + ", l)").join(" || ") + ") {"
+        + "\n" + indent + "    ScratchScope scope;"
+        + loaded.map((arg) => ""
+            + "\n" + indent + "    " + numMeta[_numType].numName + "* const copy_" + arg + " = scope.allocate<" + numMeta[_numType].numName + ">(l);"
+            + "\n" + indent + "    std::copy(" + arg + ", " + arg + " + l, copy_" + arg + ");"
+        ).join("")
+        + "\n" + indent + "    " + call + opMeta[_opType].args.concat([result]).map((arg) => loaded.includes(arg) ? "copy_" + arg : arg).join(", ") + ", l);"
+        + "\n" + indent + "    return;"
+        + "\n" + indent + "}"
+        + "\n" + indent
+    ;
+}
+
+// op tag, element type, and tier of every backend in the order they are generated, a backend's counters are at its index
+const statsEntries = [];
+
+// counts a call of a backend and its l elements when EZSIMD_STATS is defined, bytes is what one element reads and writes
+function statsCount(tag, numName, tier, bytes, indent, id = statsEntries.length) {
+    if (id == statsEntries.length) {
+        statsEntries.push({tag, numName, tier});
+    }
+
+    return ""
+        + "\n" + indent + "#ifdef EZSIMD_STATS"
+        + "\n" + indent + "    countCall(" + id + ", l, " + bytes + ");"
+        + "\n" + indent + "#endif"
+        + "\n" + indent
+    ;
+}
+
+// args that aren't the result are __restrict so the compiler vectorizes the loop without checking for overlap itself,
+// a result that is exactly one of the args keeps the plain loop
+function defaultBody(_opType, _numType, scalars = []) {
+    const loaded = arrayArgs(_opType, scalars);
+    const result = opMeta[_opType].result;
+    const indent = "                ";
+
+    return ""
+        + "\n" + indent + "if (" + loaded.map((arg) => arg + " != " + result).join(" && ") + ") {"
+        + "\n" + indent + "    [](" + pointerParams(_opType, _numType, scalars).replace(/\* /g, "* __restrict ") + ", const size_t l) {"
+        + scalarLoop(_opType, _numType, indent + "        ", "size_t i = 0", "l", scalars)
+        + "\n" + indent + "    }(" + allArgs(_opType, "", scalars) + ", l);"
+        + "\n" + indent + "} else {"
+        + scalarLoop(_opType, _numType, indent + "    ", "size_t i = 0", "l", scalars)
+        + "\n" + indent + "}"
+    ;
+}
+
+// body of a SIMD backend: peel until the result is aligned, run streaming, aligned, or unaligned steady-state loops, then finish the remainder
+function simdBody(_simdType, _opType, _numType, scalars = []) {
+    const lanes = simdMeta[_simdType].bitSize / numMeta[_numType].bitSize;
+    const bytes = simdMeta[_simdType].bitSize / 8;
+    const masked = functions[_simdType]["PACK_MASKED"] && functions[_simdType]["PACK_MASKED"][_numType];
+    const args = opMeta[_opType].args;
+    const loaded = arrayArgs(_opType, scalars);
+    const result = opMeta[_opType].result;
+    const indent = "                    ";
+    const prepared = opFunction(_simdType, _opType, _numType, scalars) != functions[_simdType][_opType][_numType];
+    let body = "\n" + indent + "size_t i = 0;";
+
+    for (const arg of args.concat([result])) {
+        body += scalars.includes(arg)
+            ? (prepared
+                ? "\n" + indent + "const auto vec_" + arg + " = " + functions[_simdType]["DIVISOR"][_numType] + "(" + arg + ");"
+                : "\n" + indent + "const " + simdRegTypenames[_simdType][_numType] + " vec_" + arg + " = " + functions[_simdType]["SET1"][_numType] + "(" + arg + ");")
+            : "\n" + indent + simdRegTypenames[_simdType][_numType] + " vec_" + arg + ";"
+        ;
+    }
+
+    if (!masked) {
+        // without masked load/store, the first and last vectors overlap the steady-state ones unless the result aliases an arg
+        body += "\n" + indent + "const bool canOverlap = l >= " + lanes + loaded.map((arg) => " && !overlaps(" + arg + ", " + result + ", l)").join("") + ";";
+    }
+
+    body += ""
+        + "\n" + indent + "const size_t peel = peelCount(" + result + ", " + bytes + ", l);"
+        + "\n" + indent
+        + "\n" + indent + "if (peel != 0) {"
+    ;
+
+    if (masked) {
+        body += maskedStep(_simdType, _opType, _numType, indent + "    ", "i", "peel", scalars);
+    } else {
+        body += ""
+            + "\n" + indent + "    if (canOverlap) {"
+            + vectorStep(_simdType, _opType, _numType, indent + "        ", "i", "PACK_UNALIGNED", "UNPACK_UNALIGNED", scalars)
+            + "\n" + indent + "    } else {"
+            + scalarLoop(_opType, _numType, indent + "        ", "", "peel", scalars)
+            + "\n" + indent + "    }"
+        ;
+    }
+
+    body += ""
+        + "\n" + indent + "    i = peel;"
+        + "\n" + indent + "}"
+        + "\n" + indent
+    ;
+
+    if (functions[_simdType]["UNPACK_STREAM"] && functions[_simdType]["UNPACK_STREAM"][_numType]) {
+        // non-temporal stores need the result aligned, the args may not be
+        body += ""
+            + "\n" + indent + "if (isAligned(" + result + " + i, " + bytes + ") && useStreamingStores(l * sizeof(" + numMeta[_numType].numName + "))) {"
+            + steadyLoops(_simdType, _opType, _numType, indent + "    ", "PACK_UNALIGNED", "UNPACK_STREAM", scalars)
+            + "\n" + indent + "    "
+            + "\n" + indent + "    _mm_sfence();"
+            + "\n" + indent + "} else "
+        ;
+    } else {
+        body += "\n" + indent;
+    }
+
+    body += ""
+        + "if (" + loaded.concat([result]).map((arg) => "isAligned(" + arg + " + i, " + bytes + ")").join(" && ") + ") {"
+        + steadyLoops(_simdType, _opType, _numType, indent + "    ", "PACK_ALIGNED", "UNPACK_ALIGNED", scalars)
+        + "\n" + indent + "} else {"
+        + steadyLoops(_simdType, _opType, _numType, indent + "    ", "PACK_UNALIGNED", "UNPACK_UNALIGNED", scalars)
+        + "\n" + indent + "}"
+        + "\n" + indent
+        + "\n" + indent + "if (i < l) {"
+    ;
+
+    if (masked) {
+        body += maskedStep(_simdType, _opType, _numType, indent + "    ", "i", "l - i", scalars);
+    } else {
+        body += ""
+            + "\n" + indent + "    if (canOverlap) {"
+            + "\n" + indent + "        i = l - " + lanes + ";"
+            + vectorStep(_simdType, _opType, _numType, indent + "        ", "i", "PACK_UNALIGNED", "UNPACK_UNALIGNED", scalars)
+            + "\n" + indent + "    } else {"
+            + scalarLoop(_opType, _numType, indent + "        ", "", "l", scalars)
+            + "\n" + indent + "    }"
+        ;
+    }
+
+    body += "\n" + indent + "}";
+    return body;
+}
+
+// body of a SIMD backend for arrays from ezsimd::aligned_allocator: no peel and no alignment checks,
+// and the remainder is one more whole vector reading and writing the padding
+function alignedBody(_simdType, _opType, _numType, scalars = []) {
+    const args = opMeta[_opType].args;
+    const result = opMeta[_opType].result;
+    const indent = "                    ";
+    const prepared = opFunction(_simdType, _opType, _numType, scalars) != functions[_simdType][_opType][_numType];
+    let body = "\n" + indent + "size_t i = 0;";
+
+    for (const arg of args.concat([result])) {
+        body += scalars.includes(arg)
+            ? (prepared
+                ? "\n" + indent + "const auto vec_" + arg + " = " + functions[_simdType]["DIVISOR"][_numType] + "(" + arg + ");"
+                : "\n" + indent + "const " + simdRegTypenames[_simdType][_numType] + " vec_" + arg + " = " + functions[_simdType]["SET1"][_numType] + "(" + arg + ");")
+            : "\n" + indent + simdRegTypenames[_simdType][_numType] + " vec_" + arg + ";"
+        ;
+    }
+
+    body += "\n" + indent;
+
+    if (functions[_simdType]["UNPACK_STREAM"] && functions[_simdType]["UNPACK_STREAM"][_numType]) {
+        body += ""
+            + "\n" + indent + "if (useStreamingStores(l * sizeof(" + numMeta[_numType].numName + "))) {"
+            + steadyLoops(_simdType, _opType, _numType, indent + "    ", "PACK_ALIGNED", "UNPACK_STREAM", scalars, true)
+            + "\n" + indent + "    "
+            + "\n" + indent + "    _mm_sfence();"
+            + "\n" + indent + "} else {"
+            + steadyLoops(_simdType, _opType, _numType, indent + "    ", "PACK_ALIGNED", "UNPACK_ALIGNED", scalars, true)
+            + "\n" + indent + "}"
+        ;
+    } else {
+        body += steadyLoops(_simdType, _opType, _numType, indent, "PACK_ALIGNED", "UNPACK_ALIGNED", scalars, true);
+    }
+
+    return body;
+}
+
+function reduceSupported(_simdType, _reduceType, _numType) {
+    const ops = supportedOps[_simdType];
+
+    if (_reduceType == "DOT") {
+        return ops.FMA[_numType] || (ops.ADD[_numType] && ops.MUL[_numType]);
+    }
+
+    return ops[reduceMeta[_reduceType].combine][_numType];
+}
+
+// scalar expression merging partial results x and y
+function scalarCombine(_reduceType, x, y) {
+    switch (reduceMeta[_reduceType].combine) {
+        case "MIN": return "std::min(" + x + ", " + y + ")";
+        case "MAX": return "std::max(" + x + ", " + y + ")";
+        default: return x + " + " + y;
+    }
+}
+
+// scalar loop merging elements [start, end) into r
+function scalarReduceLoop(_reduceType, indent, start, end) {
+    const element = _reduceType == "DOT" ? "a[i] * b[i]" : "a[i]";
+
+    return ""
+        + "\n" + indent + "for (" + start + "; i < " + end + "; i++) {"
+        + "\n" + indent + "    r = " + scalarCombine(_reduceType, "r", element) + ";"
+        + "\n" + indent + "}"
+    ;
+}
+
+// acc = reduce(acc, element vectors of the args with suffix u)
+function vectorAccumulate(_simdType, _reduceType, _numType, acc, u) {
+    const f = functions[_simdType];
+
+    if (_reduceType == "DOT") {
+        return f.FMA[_numType]
+            ? acc + " = " + f.FMA[_numType] + "(vec_a" + u + ", vec_b" + u + ", " + acc + ");"
+            : acc + " = " + f.ADD[_numType] + "(" + acc + ", " + f.MUL[_numType] + "(vec_a" + u + ", vec_b" + u + "));"
+        ;
+    }
+
+    return acc + " = " + f[reduceMeta[_reduceType].combine][_numType] + "(" + acc + ", vec_a" + u + ");";
+}
+
+// steady-state loops for a reduction, one accumulator per unrolled vector so the adds don't wait on each other
+function reduceLoops(_simdType, _reduceType, _numType, indent, pack) {
+    const lanes = simdMeta[_simdType].bitSize / numMeta[_numType].bitSize;
+    const unroll = simdMeta[_simdType].unroll;
+    const args = reduceMeta[_reduceType].args;
+    const reg = simdRegTypenames[_simdType][_numType];
+    let loops = ""
+        + "\n" + indent + "for (; i + " + (unroll * lanes - 1) + " < l; i += " + (unroll * lanes) + ") {"
+        + prefetchStep(_simdType, args, indent + "    ")
+    ;
+
+    for (let u = 0; u < unroll; u++) {
+        for (const arg of args) {
+            loops += "\n" + indent + "    const " + reg + " vec_" + arg + u + " = " + functions[_simdType][pack][_numType] + "(" + arg + " + i" + (u ? " + " + (u * lanes) : "") + ");";
+        }
+    }
+
+    for (let u = 0; u < unroll; u++) {
+        loops += "\n" + indent + "    " + vectorAccumulate(_simdType, _reduceType, _numType, "acc" + u, u);
+    }
+
+    loops += ""
+        + "\n" + indent + "}"
+        + "\n" + indent
+        + "\n" + indent + "for (; i + " + (lanes - 1) + " < l; i += " + lanes + ") {"
+    ;
+
+    for (const arg of args) {
+        loops += "\n" + indent + "    const " + reg + " vec_" + arg + " = " + functions[_simdType][pack][_numType] + "(" + arg + " + i);";
+    }
+
+    return loops
+        + "\n" + indent + "    " + vectorAccumulate(_simdType, _reduceType, _numType, "acc0", "")
+        + "\n" + indent + "}"
+    ;
+}
+
+// body of a SIMD reduction: scalar peel until a is aligned, unrolled accumulators, horizontal reduction through memory, scalar tail
+function reduceBody(_simdType, _reduceType, _numType) {
+    const lanes = simdMeta[_simdType].bitSize / numMeta[_numType].bitSize;
+    const bytes = simdMeta[_simdType].bitSize / 8;
+    const unroll = simdMeta[_simdType].unroll;
+    const args = reduceMeta[_reduceType].args;
+    const combine = functions[_simdType][reduceMeta[_reduceType].combine][_numType];
+    const numName = numMeta[_numType].numName;
+    const reg = simdRegTypenames[_simdType][_numType];
+    const identity = reduceMeta[_reduceType].combine == "ADD";
+    const indent = "                    ";
+    let body = ""
+        + "\n" + indent + "size_t i = 0;"
+        + "\n" + indent + numName + " r = " + (identity ? "0" : "a[0]") + ";"
+        + "\n" + indent + "const size_t peel = peelCount(a, " + bytes + ", l);"
+        + "\n" + indent
+        + scalarReduceLoop(_reduceType, indent, "", "peel")
+        + "\n" + indent
+        + "\n" + indent + "if (l - i >= " + lanes + ") {"
+    ;
+
+    for (let u = 0; u < unroll; u++) {
+        // min and max start every accumulator from the first vector, a repeated element does not change the result
+        body += "\n" + indent + "    " + reg + " acc" + u + " = " + (identity ? functions[_simdType]["SET_ZERO"][_numType] + "()" : functions[_simdType]["PACK_UNALIGNED"][_numType] + "(a + i)") + ";";
+    }
+
+    body += ""
+        + "\n" + indent + "    "
+        + "\n" + indent + "    if (" + args.map((arg) => "isAligned(" + arg + " + i, " + bytes + ")").join(" && ") + ") {"
+        + reduceLoops(_simdType, _reduceType, _numType, indent + "        ", "PACK_ALIGNED")
+        + "\n" + indent + "    } else {"
+        + reduceLoops(_simdType, _reduceType, _numType, indent + "        ", "PACK_UNALIGNED")
+        + "\n" + indent + "    }"
+        + "\n" + indent + "    "
+    ;
+
+    for (let step = 1; step < unroll; step *= 2) {
+        for (let u = 0; u + step < unroll; u += 2 * step) {
+            body += "\n" + indent + "    acc" + u + " = " + combine + "(acc" + u + ", acc" + (u + step) + ");";
+        }
+    }
+
+    body += ""
+        + "\n" + indent + "    "
+        + "\n" + indent + "    alignas(" + bytes + ") " + numName + " lanes[" + lanes + "];"
+        + "\n" + indent + "    " + functions[_simdType]["UNPACK_ALIGNED"][_numType] + "(lanes, acc0);"
+        + "\n" + indent + "    for (size_t k = 0; k < " + lanes + "; k++) {"
+        + "\n" + indent + "        r = " + scalarCombine(_reduceType, "r", "lanes[k]") + ";"
+        + "\n" + indent + "    }"
+    ;
+
+    if (_simdType == "MMX") {
+        body += ""
+            + "\n" + indent + "    "
+            + "\n" + indent + "    _mm_empty();"
+        ;
+    }
+
+    return body
+        + "\n" + indent + "}"
+        + "\n" + indent
+        + scalarReduceLoop(_reduceType, indent, "", "l")
+        + "\n" + indent
+        + "\n" + indent + "return r;"
+    ;
+}
+
+// the args and result types of a widening op on _numType, narrowing ops read the wider type and write _numType
+function widenTypes(_widenType, _numType) {
+    const wider = numMeta[_numType].wider;
+    return widenMeta[_widenType].narrows ? {arg: wider, result: _numType} : {arg: _numType, result: wider};
+}
+
+function widenPointerParams(_widenType, _numType) {
+    const types = widenTypes(_widenType, _numType);
+    return widenMeta[_widenType].args.map((arg) => "const " + numMeta[types.arg].numName + "* " + arg).join(", ")
+        + ", " + numMeta[types.result].numName + "* c";
+}
+
+function widenContainerParams(_widenType, _numType, container) {
+    const types = widenTypes(_widenType, _numType);
+    return widenMeta[_widenType].args.map((arg) => "const " + container(numMeta[types.arg].numName) + "& " + arg).join(", ")
+        + ", " + container(numMeta[types.result].numName) + "& c";
+}
+
+function widenSupported(_simdType, _widenType, _numType) {
+    const f = functions[_simdType];
+    const meta = widenMeta[_widenType];
+    const wider = numMeta[_numType].wider;
+
+    if (meta.narrows) {
+        return Boolean(f.NARROW && f.NARROW[_numType] && f.PACK_UNALIGNED[wider]);
+    }
+
+    return Boolean(f.WIDEN && f.WIDEN[_numType] && f.UNPACK_UNALIGNED[wider]
+        && (!meta.op || (f[_widenType] && f[_widenType][_numType]) || (f[meta.op] && f[meta.op][wider])));
+}
+
+// scalar expression for element i, the args are converted before the op so it can't overflow the narrower type
+function widenExpr(_widenType, _numType) {
+    const meta = widenMeta[_widenType];
+    const result = numMeta[widenTypes(_widenType, _numType).result].numName;
+    const converted = meta.args.map((arg) => "static_cast<" + result + ">(" + arg + "[i])");
+
+    return meta.op ? converted.join(" " + opMeta[meta.op].op + " ") : converted[0];
+}
+
+function widenScalarLoop(_widenType, _numType, indent, start, end) {
+    return ""
+        + "\n" + indent + "for (" + start + "; i < " + end + "; i++) {"
+        + "\n" + indent + "    c[i] = " + widenExpr(_widenType, _numType) + ";"
+        + "\n" + indent + "}"
+    ;
+}
+
+// lanes of the wider type in one register, which F16C and AVX512BF16 make wider than simdMeta's bitSize
+function widenLanes(_simdType, _numType) {
+    const wider = numMeta[_numType].wider;
+    return Number(simdRegTypenames[_simdType][wider].match(/\d+/)[0]) / numMeta[wider].bitSize;
+}
+
+// `count` vectors of the wider type, the narrower side is always loaded or stored unaligned since it covers half a register
+function widenStep(_simdType, _widenType, _numType, indent, count, aligned) {
+    const f = functions[_simdType];
+    const meta = widenMeta[_widenType];
+    const wider = numMeta[_numType].wider;
+    const reg = simdRegTypenames[_simdType][wider];
+    const lanes = widenLanes(_simdType, _numType);
+    const at = (u) => "i" + (u ? " + " + (u * lanes) : "");
+    const name = (arg, u) => "vec_" + arg + (count > 1 ? u : "");
+    let step = "";
+
+    for (let u = 0; u < count; u++) {
+        for (const arg of meta.args) {
+            step += "\n" + indent + "const " + reg + " " + name(arg, u) + " = "
+                + (meta.narrows ? f[aligned ? "PACK_ALIGNED" : "PACK_UNALIGNED"][wider] : f.WIDEN[_numType]) + "(" + arg + " + " + at(u) + ");";
+        }
+    }
+
+    if (meta.op) {
+        const op = f[_widenType] && f[_widenType][_numType] ? f[_widenType][_numType] : f[meta.op][wider];
+
+        for (let u = 0; u < count; u++) {
+            step += "\n" + indent + "const " + reg + " " + name("c", u) + " = " + op + "(" + meta.args.map((arg) => name(arg, u)).join(", ") + ");";
+        }
+    }
+
+    for (let u = 0; u < count; u++) {
+        step += "\n" + indent + (meta.narrows ? f.NARROW[_numType] : f[aligned ? "UNPACK_ALIGNED" : "UNPACK_UNALIGNED"][wider])
+            + "(c + " + at(u) + ", " + name(meta.op ? "c" : "a", u) + ");";
+    }
+
+    return step;
+}
+
+function widenLoops(_simdType, _widenType, _numType, indent, aligned) {
+    const lanes = widenLanes(_simdType, _numType);
+    const unroll = simdMeta[_simdType].unroll;
+
+    return ""
+        + "\n" + indent + "for (; i + " + (unroll * lanes - 1) + " < l; i += " + (unroll * lanes) + ") {"
+        + prefetchStep(_simdType, widenMeta[_widenType].args, indent + "    ")
+        + widenStep(_simdType, _widenType, _numType, indent + "    ", unroll, aligned)
+        + "\n" + indent + "}"
+        + "\n" + indent
+        + "\n" + indent + "for (; i + " + (lanes - 1) + " < l; i += " + lanes + ") {"
+        + widenStep(_simdType, _widenType, _numType, indent + "    ", 1, aligned)
+        + "\n" + indent + "}"
+    ;
+}
+
+// body of a widening backend: scalar peel until the array of the wider type is aligned, whole registers of it, scalar tail
+function widenBody(_simdType, _widenType, _numType) {
+    const wide = widenMeta[_widenType].narrows ? "a" : "c";
+    const bytes = widenLanes(_simdType, _numType) * numMeta[numMeta[_numType].wider].bitSize / 8;
+    const indent = "                    ";
+
+    return ""
+        + "\n" + indent + "size_t i = 0;"
+        + "\n" + indent + "const size_t peel = peelCount(" + wide + ", " + bytes + ", l);"
+        + widenScalarLoop(_widenType, _numType, indent, "", "peel")
+        + "\n" + indent
+        + "\n" + indent + "if (isAligned(" + wide + " + i, " + bytes + ")) {"
+        + widenLoops(_simdType, _widenType, _numType, indent + "    ", true)
+        + "\n" + indent + "} else {"
+        + widenLoops(_simdType, _widenType, _numType, indent + "    ", false)
+        + "\n" + indent + "}"
+        + "\n" + indent
+        + widenScalarLoop(_widenType, _numType, indent, "", "l")
+    ;
+}
+
+// intrinsic names that differ between the tiers with integer division helpers
+const divTiers = {
+    SSE2: {
+        p: "_mm", i: "__m128i", f: "__m128", d: "__m128d", si: "si128", set1Epi64: "_mm_set1_epi64x",
+        lo: (x) => "_mm_cvtepi32_pd(" + x + ")",
+        hi: (x) => "_mm_cvtepi32_pd(_mm_shuffle_epi32(" + x + ", 0xEE))",
+        join: (lo, hi) => "_mm_unpacklo_epi64(_mm_cvttpd_epi32(" + lo + "), _mm_cvttpd_epi32(" + hi + "))",
+        ge: (x, y) => "_mm_cmpge_pd(" + x + ", " + y + ")",
+    },
+    AVX2: {
+        p: "_mm256", i: "__m256i", f: "__m256", d: "__m256d", si: "si256", set1Epi64: "_mm256_set1_epi64x",
+        lo: (x) => "_mm256_cvtepi32_pd(_mm256_castsi256_si128(" + x + "))",
+        hi: (x) => "_mm256_cvtepi32_pd(_mm256_extracti128_si256(" + x + ", 1))",
+        join: (lo, hi) => "_mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(" + lo + ")), _mm256_cvttpd_epi32(" + hi + "), 1)",
+        ge: (x, y) => "_mm256_cmp_pd(" + x + ", " + y + ", _CMP_GE_OQ)",
+    },
+    AVX512: {
+        p: "_mm512", i: "__m512i", f: "__m512", d: "__m512d", si: "si512", set1Epi64: "_mm512_set1_epi64",
+        lo: (x) => "_mm512_cvtepi32_pd(_mm512_castsi512_si256(" + x + "))",
+        hi: (x) => "_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(" + x + ", 1))",
+        join: (lo, hi) => "_mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(" + lo + ")), _mm512_cvttpd_epi32(" + hi + "), 1)",
+        ge: null, // AVX-512 converts uint32 to and from double directly
+    },
+}; // divTiers
+
+// "#ifdef" for a tier's code, AVX-512 tiers also silence the uninitialized warnings GCC gives for the
+// _mm512_undefined_* inside the AVX-512 intrinsics wherever they are inlined
+function tierIfdef(_simdType, indent) {
+    return "\n" + indent + "#ifdef " + simdMeta[_simdType].ifdefMacro
+        + (simdMeta[_simdType].name.includes("avx512") ? ""
+            + "\n" + indent + "    #pragma GCC diagnostic push"
+            + "\n" + indent + "    #pragma GCC diagnostic ignored \"-Wmaybe-uninitialized\""
+            + "\n" + indent + "    #pragma GCC diagnostic ignored \"-Wuninitialized\""
+            : "")
+    ;
+}
+
+// "#endif" closing tierIfdef
+function tierEndif(_simdType, indent) {
+    return (simdMeta[_simdType].name.includes("avx512") ? "\n" + indent + "    #pragma GCC diagnostic pop" : "")
+        + "\n" + indent + "#endif // " + simdMeta[_simdType].ifdefMacro
+    ;
+}
+
+// elementwise integer division helpers for one tier, in libezsimd.tpp since the std::array kernels use them too
+function divHelpers(_simdType) {
+    const t = divTiers[_simdType];
+    const p = t.p;
+    const I = t.i;
+    const s = _simdType;
+    let helpers = ""
+        + "\n    "
+        + tierIfdef(_simdType, "    ")
+        + "\n        // a / b on int32 lanes that fit in 16 bits, the float quotient is close enough that truncating it is exact"
+        + "\n        inline " + I + " divSmallEpi32" + s + "(const " + I + " a, const " + I + " b) {"
+        + "\n            return " + p + "_cvttps_epi32(" + p + "_div_ps(" + p + "_cvtepi32_ps(a), " + p + "_cvtepi32_ps(b)));"
+        + "\n        }"
+        + "\n        "
+        + "\n        // packs two vectors of int32 lanes into int16 lanes keeping the low 16 bits, so -32768 / -1 wraps like the scalar loop"
+        + "\n        inline " + I + " narrowEpi32" + s + "(const " + I + " lo, const " + I + " hi) {"
+        + "\n            return " + p + "_packs_epi32(" + p + "_srai_epi32(" + p + "_slli_epi32(lo, 16), 16), " + p + "_srai_epi32(" + p + "_slli_epi32(hi, 16), 16));"
+        + "\n        }"
+        + "\n        "
+        + "\n        // same for int16 lanes into int8 lanes"
+        + "\n        inline " + I + " narrowEpi16" + s + "(const " + I + " lo, const " + I + " hi) {"
+        + "\n            return " + p + "_packs_epi16(" + p + "_srai_epi16(" + p + "_slli_epi16(lo, 8), 8), " + p + "_srai_epi16(" + p + "_slli_epi16(hi, 8), 8));"
+        + "\n        }"
+        + "\n        "
+        + "\n        inline " + I + " divInt16" + s + "(const " + I + " a, const " + I + " b) {"
+        + "\n            const " + I + " lo = divSmallEpi32" + s + "(" + p + "_srai_epi32(" + p + "_unpacklo_epi16(a, a), 16), " + p + "_srai_epi32(" + p + "_unpacklo_epi16(b, b), 16));"
+        + "\n            const " + I + " hi = divSmallEpi32" + s + "(" + p + "_srai_epi32(" + p + "_unpackhi_epi16(a, a), 16), " + p + "_srai_epi32(" + p + "_unpackhi_epi16(b, b), 16));"
+        + "\n            return narrowEpi32" + s + "(lo, hi);"
+        + "\n        }"
+        + "\n        "
+        + "\n        inline " + I + " divUint16" + s + "(const " + I + " a, const " + I + " b) {"
+        + "\n            const " + I + " zero = " + p + "_setzero_" + t.si + "();"
+        + "\n            const " + I + " lo = divSmallEpi32" + s + "(" + p + "_unpacklo_epi16(a, zero), " + p + "_unpacklo_epi16(b, zero));"
+        + "\n            const " + I + " hi = divSmallEpi32" + s + "(" + p + "_unpackhi_epi16(a, zero), " + p + "_unpackhi_epi16(b, zero));"
+        + "\n            return narrowEpi32" + s + "(lo, hi);"
+        + "\n        }"
+        + "\n        "
+        + "\n        inline " + I + " divInt8" + s + "(const " + I + " a, const " + I + " b) {"
+        + "\n            const " + I + " lo = divInt16" + s + "(" + p + "_srai_epi16(" + p + "_unpacklo_epi8(a, a), 8), " + p + "_srai_epi16(" + p + "_unpacklo_epi8(b, b), 8));"
+        + "\n            const " + I + " hi = divInt16" + s + "(" + p + "_srai_epi16(" + p + "_unpackhi_epi8(a, a), 8), " + p + "_srai_epi16(" + p + "_unpackhi_epi8(b, b), 8));"
+        + "\n            return narrowEpi16" + s + "(lo, hi);"
+        + "\n        }"
+        + "\n        "
+        + "\n        inline " + I + " divUint8" + s + "(const " + I + " a, const " + I + " b) {"
+        + "\n            const " + I + " zero = " + p + "_setzero_" + t.si + "();"
+        + "\n            const " + I + " lo = divInt16" + s + "(" + p + "_unpacklo_epi8(a, zero), " + p + "_unpacklo_epi8(b, zero));"
+        + "\n            const " + I + " hi = divInt16" + s + "(" + p + "_unpackhi_epi8(a, zero), " + p + "_unpackhi_epi8(b, zero));"
+        + "\n            return narrowEpi16" + s + "(lo, hi);"
+        + "\n        }"
+        + "\n        "
+        + "\n        // int32 needs double, where the quotient of any two int32 values truncates exactly"
+        + "\n        inline " + I + " divInt32" + s + "(const " + I + " a, const " + I + " b) {"
+        + "\n            return " + t.join(p + "_div_pd(" + t.lo("a") + ", " + t.lo("b") + ")", p + "_div_pd(" + t.hi("a") + ", " + t.hi("b") + ")") + ";"
+        + "\n        }"
+        + "\n        "
+    ;
+
+    if (t.ge) {
+        helpers += ""
+            + "\n        // uint32 lanes as double, flipping the top bit makes them int32 and the conversion is shifted back up"
+            + "\n        inline " + t.d + " uint32Lo" + s + "(const " + I + " x) {"
+            + "\n            return " + p + "_add_pd(" + t.lo(p + "_xor_" + t.si + "(x, " + p + "_set1_epi32(INT32_MIN))") + ", " + p + "_set1_pd(2147483648.0));"
+            + "\n        }"
+            + "\n        "
+            + "\n        inline " + t.d + " uint32Hi" + s + "(const " + I + " x) {"
+            + "\n            return " + p + "_add_pd(" + t.hi(p + "_xor_" + t.si + "(x, " + p + "_set1_epi32(INT32_MIN))") + ", " + p + "_set1_pd(2147483648.0));"
+            + "\n        }"
+            + "\n        "
+            + "\n        // a quotient of at least 2^31 means b was 1, so it is a whole number and subtracting 2^32 leaves the same low 32 bits"
+            + "\n        inline " + t.d + " wrapUint32" + s + "(const " + t.d + " q) {"
+            + "\n            return " + p + "_sub_pd(q, " + p + "_and_pd(" + t.ge("q", p + "_set1_pd(2147483648.0)") + ", " + p + "_set1_pd(4294967296.0)));"
+            + "\n        }"
+            + "\n        "
+            + "\n        inline " + I + " divUint32" + s + "(const " + I + " a, const " + I + " b) {"
+            + "\n            return " + t.join("wrapUint32" + s + "(" + p + "_div_pd(uint32Lo" + s + "(a), uint32Lo" + s + "(b)))", "wrapUint32" + s + "(" + p + "_div_pd(uint32Hi" + s + "(a), uint32Hi" + s + "(b)))") + ";"
+            + "\n        }"
+        ;
+    } else {
+        helpers += ""
+            + "\n        inline " + I + " divUint32" + s + "(const " + I + " a, const " + I + " b) {"
+            + "\n            const " + t.d + " lo = " + p + "_div_pd(" + p + "_cvtepu32_pd(" + p + "_castsi512_si256(a)), " + p + "_cvtepu32_pd(" + p + "_castsi512_si256(b)));"
+            + "\n            const " + t.d + " hi = " + p + "_div_pd(" + p + "_cvtepu32_pd(" + p + "_extracti64x4_epi64(a, 1)), " + p + "_cvtepu32_pd(" + p + "_extracti64x4_epi64(b, 1)));"
+            + "\n            return " + p + "_inserti64x4(" + p + "_castsi256_si512(" + p + "_cvttpd_epu32(lo)), " + p + "_cvttpd_epu32(hi), 1);"
+            + "\n        }"
+        ;
+    }
+
+    return helpers + tierEndif(_simdType, "    ");
+}
+
+// helpers for dividing by one value for a whole call, in ezsimd.hpp since only the backends use them
+function divisorHelpers(_simdType) {
+    const t = divTiers[_simdType];
+    const p = t.p;
+    const I = t.i;
+    const s = _simdType;
+    const set1 = (bits, x) => p + "_set1_epi" + bits + "(" + x + ")";
+    let helpers = ""
+        + "\n    "
+        + tierIfdef(_simdType, "    ")
+        + "\n        // DivMagic as vectors, shifts as the count operand of sra/srl"
+        + "\n        struct Divisor" + s + " {"
+        + "\n            " + I + " magic;"
+        + "\n            " + I + " sign;"
+        + "\n            __m128i shift1;"
+        + "\n            __m128i shift2;"
+        + "\n        };"
+        + "\n        "
+        + "\n        // high 32 bits of each unsigned 32x32-bit product, even lanes from one mul_epu32 and odd lanes from another"
+        + "\n        inline " + I + " mulhiEpu32" + s + "(const " + I + " a, const " + I + " b) {"
+        + "\n            const " + I + " even = " + p + "_srli_epi64(" + p + "_mul_epu32(a, b), 32);"
+        + "\n            const " + I + " odd = " + p + "_mul_epu32(" + p + "_srli_epi64(a, 32), " + p + "_srli_epi64(b, 32));"
+        + "\n            return " + p + "_or_" + t.si + "(even, " + p + "_and_" + t.si + "(odd, " + t.set1Epi64 + "(int64_t(0xFFFFFFFF00000000))));"
+        + "\n        }"
+        + "\n        "
+        + "\n        // the signed product is the unsigned one minus b where a is negative and a where b is negative"
+        + "\n        inline " + I + " mulhiEpi32" + s + "(const " + I + " a, const " + I + " b) {"
+        + "\n            const " + I + " negative = " + p + "_add_epi32(" + p + "_and_" + t.si + "(" + p + "_srai_epi32(a, 31), b), " + p + "_and_" + t.si + "(" + p + "_srai_epi32(b, 31), a));"
+        + "\n            return " + p + "_sub_epi32(mulhiEpu32" + s + "(a, b), negative);"
+        + "\n        }"
+        + "\n        "
+    ;
+
+    for (const bits of [16, 32]) {
+        const mulhi = (signed) => bits == 16 ? p + "_mulhi_ep" + (signed ? "i" : "u") + "16" : "mulhiEp" + (signed ? "i" : "u") + "32" + s;
+
+        helpers += ""
+            + "\n        inline Divisor" + s + " divisorInt" + bits + s + "(const int" + bits + "_t d) {"
+            + "\n            const DivMagic<int" + bits + "_t> m = divMagic(d);"
+            + "\n            return {" + set1(bits, "m.magic") + ", " + set1(bits, "m.sign") + ", _mm_cvtsi32_si128(m.shift1), _mm_cvtsi32_si128(m.shift2)};"
+            + "\n        }"
+            + "\n        "
+            + "\n        inline " + I + " divByInt" + bits + s + "(const " + I + " n, const Divisor" + s + "& d) {"
+            + "\n            const " + I + " q = " + p + "_sub_epi" + bits + "(" + p + "_sra_epi" + bits + "(" + p + "_add_epi" + bits + "(n, " + mulhi(true) + "(n, d.magic)), d.shift1), " + p + "_srai_epi" + bits + "(n, " + (bits - 1) + "));"
+            + "\n            return " + p + "_sub_epi" + bits + "(" + p + "_xor_" + t.si + "(q, d.sign), d.sign);"
+            + "\n        }"
+            + "\n        "
+            + "\n        inline Divisor" + s + " divisorUint" + bits + s + "(const uint" + bits + "_t d) {"
+            + "\n            const DivMagic<uint" + bits + "_t> m = divMagic(d);"
+            + "\n            return {" + set1(bits, "m.magic") + ", " + p + "_setzero_" + t.si + "(), _mm_cvtsi32_si128(m.shift1), _mm_cvtsi32_si128(m.shift2)};"
+            + "\n        }"
+            + "\n        "
+            + "\n        inline " + I + " divByUint" + bits + s + "(const " + I + " n, const Divisor" + s + "& d) {"
+            + "\n            const " + I + " t = " + mulhi(false) + "(n, d.magic);"
+            + "\n            return " + p + "_srl_epi" + bits + "(" + p + "_add_epi" + bits + "(t, " + p + "_srl_epi" + bits + "(" + p + "_sub_epi" + bits + "(n, t), d.shift1)), d.shift2);"
+            + "\n        }"
+            + "\n        "
+        ;
+    }
+
+    return helpers
+        + "\n        // 8-bit lanes are divided as 16-bit lanes, which any 8-bit divisor's 16-bit magic number works for"
+        + "\n        inline Divisor" + s + " divisorInt8" + s + "(const int8_t d) {"
+        + "\n            return divisorInt16" + s + "(d);"
+        + "\n        }"
+        + "\n        "
+        + "\n        inline " + I + " divByInt8" + s + "(const " + I + " n, const Divisor" + s + "& d) {"
+        + "\n            const " + I + " lo = divByInt16" + s + "(" + p + "_srai_epi16(" + p + "_unpacklo_epi8(n, n), 8), d);"
+        + "\n            const " + I + " hi = divByInt16" + s + "(" + p + "_srai_epi16(" + p + "_unpackhi_epi8(n, n), 8), d);"
+        + "\n            return narrowEpi16" + s + "(lo, hi);"
+        + "\n        }"
+        + "\n        "
+        + "\n        inline Divisor" + s + " divisorUint8" + s + "(const uint8_t d) {"
+        + "\n            return divisorUint16" + s + "(d);"
+        + "\n        }"
+        + "\n        "
+        + "\n        inline " + I + " divByUint8" + s + "(const " + I + " n, const Divisor" + s + "& d) {"
+        + "\n            const " + I + " zero = " + p + "_setzero_" + t.si + "();"
+        + "\n            const " + I + " lo = divByUint16" + s + "(" + p + "_unpacklo_epi8(n, zero), d);"
+        + "\n            const " + I + " hi = divByUint16" + s + "(" + p + "_unpackhi_epi8(n, zero), d);"
+        + "\n            return narrowEpi16" + s + "(lo, hi);"
+        + "\n        }"
+        + tierEndif(_simdType, "    ")
+    ;
+}
+
+// tiers the std::array kernels can use, widest first (MMX is left out, it needs _mm_empty() before any float code runs)
+const fixedTiers = simdType.filter((_simdType) => _simdType != "MMX").reverse();
+
+// Fixed<Isa, Op, T> specialization for the std::array kernels, Isa void is the scalar one
+function fixedSpec(_simdType, _opType, _numType) {
+    const numName = numMeta[_numType].numName;
+    const args = opMeta[_opType].args;
+    const head = ""
+        + "\n            template <>"
+        + "\n            struct Fixed<" + (_simdType ? "isa::" + _simdType : "void") + ", op::" + opTag(opMeta[_opType].name) + ", " + numName + "> {"
+    ;
+
+    if (!_simdType) {
+        return head
+            + "\n                static " + numName + " apply(" + args.map((arg) => "const " + numName + " " + arg).join(", ") + ") {return " + scalarExpr(_opType, _numType, args) + ";}"
+            + "\n            };"
+        ;
+    }
+
+    const reg = simdRegTypenames[_simdType][_numType];
+    const f = functions[_simdType];
+
+    return ""
+        + tierIfdef(_simdType, "            ")
+        + head.replace(/\n            /g, "\n                ")
+        + "\n                    static constexpr size_t lanes = " + (simdMeta[_simdType].bitSize / numMeta[_numType].bitSize) + ";"
+        + "\n                    static " + reg + " load(const " + numName + "* ptr) {return " + f.PACK_UNALIGNED[_numType] + "(ptr);}"
+        + "\n                    static " + reg + " set1(const " + numName + " value) {return " + f.SET1[_numType] + "(value);}"
+        + "\n                    static " + reg + " apply(" + args.map((arg) => "const " + reg + " " + arg).join(", ") + ") {return " + f[_opType][_numType] + "(" + args.join(", ") + ");}"
+        + "\n                    static void store(" + numName + "* ptr, const " + reg + " vec) {" + f.UNPACK_UNALIGNED[_numType] + "(ptr, vec);}"
+        + "\n                };"
+        + tierEndif(_simdType, "            ")
+    ;
+}
+
+// types the compiler may not have are only declared when numMeta's ifdefMacro is defined
+function numIfdef(_numType) {
+    return numMeta[_numType].ifdefMacro ? "\n        #ifdef " + numMeta[_numType].ifdefMacro : "";
+}
+
+function numEndif(_numType) {
+    return numMeta[_numType].ifdefMacro ? "\n        #endif // " + numMeta[_numType].ifdefMacro : "";
+}
+
+// name of the op's tag type in ezsimd::op, "Add" or "AddScalar" for the broadcast overloads
+function opTag(name, scalars = []) {
+    return name.charAt(0).toUpperCase() + name.slice(1) + (scalars.length ? "Scalar" : "");
+}
+
+// Kernel<Op, T> specialization declared in the header
+function kernelDecl(tag, numName, returnType, params, aligned = false) {
+    return ""
+        + "\n            template <>"
+        + "\n            struct Kernel<op::" + tag + ", " + numName + "> {"
+        + "\n                using type = " + returnType + " (*)(" + params + ", const size_t l);"
+        + "\n                static type get();"
+        + "\n                static type get(Tier tier);"
+        + (aligned ? "\n                // for arrays from ezsimd::aligned_allocator only, reads and writes whole vectors past l into the padding" : "")
+        + (aligned ? "\n                static type getAligned();" : "")
+        + "\n            };"
+    ;
+}
+
+// Kernel<Op, T>::get() (or getAligned() with suffix "Aligned"), picks the backend of the best tier this CPU supports
+// and maxIsa() allows on the first call and keeps it until setMaxIsa is called.
+// picks are made one at a time under dispatchMutex(), so a thread that read an older version can't store its
+// backend after a newer one and leave the older backend marked as current
+function kernelPick(tag, numName, backend, tiers, name = "get", suffix = "") {
+    let get = ""
+        + "\n"
+        + "\n            Kernel<op::" + tag + ", " + numName + ">::type Kernel<op::" + tag + ", " + numName + ">::" + name + "() {"
+        + "\n                static std::atomic<type> kernel{nullptr};"
+        + "\n                static std::atomic<unsigned> version{0}; // dispatchVersion() kernel was picked for"
+        + "\n                "
+        + "\n                if (version.load(std::memory_order_acquire) != dispatchVersion().load(std::memory_order_acquire)) {"
+        + "\n                    std::lock_guard<std::mutex> lock(dispatchMutex());"
+        + "\n                    const unsigned current = dispatchVersion().load(std::memory_order_acquire);"
+        + "\n                    "
+        + "\n                    if (version.load(std::memory_order_relaxed) != current) {"
+        + "\n                        kernel.store([]() -> type {"
+    ;
+
+    for (const _simdType of tiers.slice().reverse()) {
+        get += ""
+            + "\n                            #ifdef " + simdMeta[_simdType].ifdefMacro
+            + "\n                                if (useTier(Tier::" + _simdType + ")) {"
+            + "\n                                    return " + backend + _simdType + suffix + ";"
+            + "\n                                }"
+            + "\n                            #endif // " + simdMeta[_simdType].ifdefMacro
+        ;
+    }
+
+    return get
+        + "\n                            "
+        + "\n                            return " + backend + "Default;"
+        + "\n                        }(), std::memory_order_relaxed);"
+        + "\n                        version.store(current, std::memory_order_release);"
+        + "\n                    }"
+        + "\n                }"
+        + "\n                "
+        + "\n                return kernel.load(std::memory_order_relaxed);"
+        + "\n            }"
+    ;
+}
+
+// Kernel<Op, T>::get() and get(Tier), the one built for a tier
+function kernelGet(tag, numName, backend, tiers) {
+    let get = kernelPick(tag, numName, backend, tiers)
+        + "\n            "
+        + "\n            Kernel<op::" + tag + ", " + numName + ">::type Kernel<op::" + tag + ", " + numName + ">::get(const Tier tier) {"
+        + "\n                switch (tier) {"
+    ;
+
+    for (const _simdType of tiers) {
+        get += ""
+            + "\n                    #ifdef " + simdMeta[_simdType].ifdefMacro
+            + "\n                        case Tier::" + _simdType + ":"
+            + "\n                            return " + backend + _simdType + ";"
+            + "\n                    #endif // " + simdMeta[_simdType].ifdefMacro
+        ;
+    }
+
+    return get
+        + "\n                    case Tier::Default:"
+        + "\n                        return " + backend + "Default;"
+        + "\n                    default:"
+        + "\n                        return nullptr;"
+        + "\n                }"
+        + "\n            }"
+    ;
+}
 
 function make(sourcePath, headerPath, templPath) {
     let source = "";
     let header = "";
     let templ = "";
 
-    source += `#pragma once
+    source += `#pragma once
+
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cctype>
+#include <type_traits>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "libezsimd.hpp"
+
+// __AVX2__, __FMA__, and AVX-512 use same header as __AVX__
+#if defined(__AVX__) || defined(__FMA__) || defined(EZSIMD_AVX512)
+    #include <immintrin.h>
+#endif
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+#if defined(__SSE__)
+    #include <xmmintrin.h>
+#endif
+#if defined(__MMX__)
+    #include <mmintrin.h>
+#endif
+
+namespace ezsimd {
+    template <typename T>
+    bool isAligned(const T* ptr, size_t alignment) {
+        return reinterpret_cast<std::uintptr_t>(static_cast<const void*>(ptr)) % alignment == 0;
+    }
+    
+    template <typename T>
+    bool overlaps(const T* x, const T* y, size_t l) {
+        const std::uintptr_t px = reinterpret_cast<std::uintptr_t>(static_cast<const void*>(x));
+        const std::uintptr_t py = reinterpret_cast<std::uintptr_t>(static_cast<const void*>(y));
+        return px < py + l * sizeof(T) && py < px + l * sizeof(T);
+    }
+    
+    // the only overlap backends can't compute in place, x and y start at different elements of the same memory
+    template <typename T>
+    bool partiallyOverlaps(const T* x, const T* y, size_t l) {
+        return x != y && overlaps(x, y, l);
+    }
+    
+    // elements to process before ptr reaches the alignment boundary, 0 if ptr can never reach it
+    template <typename T>
+    size_t peelCount(const T* ptr, size_t alignment, size_t l) {
+        const size_t misalignment = reinterpret_cast<std::uintptr_t>(static_cast<const void*>(ptr)) % alignment;
+        if (misalignment == 0 || misalignment % sizeof(T) != 0) {
+            return 0;
+        }
+        
+        return std::min((alignment - misalignment) / sizeof(T), l);
+    }
+    
+    // 8 lanes read from tailMask32 + 8 - n have the first n lanes set, used by AVX/AVX2 masked load/store
+    alignas(32) constexpr int32_t tailMask32[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+    
+    // workers stay alive between calls, the calling thread also takes part in every run
+    class ThreadPool {
+        public:
+            explicit ThreadPool(size_t threads) {
+                resize(threads);
+            }
+            
+            ~ThreadPool() {
+                stop();
+            }
+            
+            void resize(size_t threads) {
+                std::lock_guard<std::mutex> runLock(runMutex);
+                stop();
+                quit = false;
+                
+                for (size_t t = 1; t < threads; t++) {
+                    workers.emplace_back([this] {work();});
+                }
+            }
+            
+            // calls job(k) once for every k in [0, count), returns when all calls are done
+            void run(size_t count, const std::function<void(size_t)>& job) {
+                std::lock_guard<std::mutex> runLock(runMutex);
+                std::unique_lock<std::mutex> lock(mutex);
+                idle.wait(lock, [this] {return active == 0;}); // late workers from the previous run
+                currentJob = &job;
+                jobCount = count;
+                next = 0;
+                generation++;
+                lock.unlock();
+                wake.notify_all();
+                
+                help();
+                
+                lock.lock();
+                idle.wait(lock, [this] {return active == 0;});
+                currentJob = nullptr;
+            }
+        
+        private:
+            std::vector<std::thread> workers;
+            std::mutex runMutex; // one run at a time
+            std::mutex mutex;
+            std::condition_variable wake;
+            std::condition_variable idle;
+            const std::function<void(size_t)>* currentJob = nullptr;
+            size_t jobCount = 0;
+            std::atomic<size_t> next{0};
+            size_t generation = 0;
+            size_t active = 0;
+            bool quit = false;
+            
+            void help() {
+                for (size_t k = next++; k < jobCount; k = next++) {
+                    (*currentJob)(k);
+                }
+            }
+            
+            void work() {
+                size_t seen = 0;
+                std::unique_lock<std::mutex> lock(mutex);
+                
+                while (true) {
+                    wake.wait(lock, [&] {return quit || generation != seen;});
+                    if (quit) {
+                        return;
+                    }
+                    
+                    seen = generation;
+                    active++;
+                    lock.unlock();
+                    help();
+                    lock.lock();
+                    active--;
+                    
+                    if (active == 0) {
+                        idle.notify_all();
+                    }
+                }
+            }
+            
+            void stop() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    quit = true;
+                }
+                
+                wake.notify_all();
+                for (std::thread& worker : workers) {
+                    worker.join();
+                }
+                
+                workers.clear();
+            }
+    };
+    
+    inline size_t defaultThreadCount() {
+        return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    
+    inline ThreadPool& threadPool() {
+        static ThreadPool pool(defaultThreadCount());
+        return pool;
+    }
+    
+    inline std::atomic<size_t>& parallelThreshold() {
+        static std::atomic<size_t> threshold{size_t(1) << 22};
+        return threshold;
+    }
+    
+    inline std::atomic<size_t>& streamThreshold() {
+        static std::atomic<size_t> threshold{size_t(1) << 25};
+        return threshold;
+    }
+    
+    // set while a thread runs one chunk of an ezsimd::parallel call whose whole output is over the stream threshold
+    inline bool& streamingChunk() {
+        thread_local bool streaming = false;
+        return streaming;
+    }
+    
+    inline bool useStreamingStores(size_t bytes) {
+        return bytes >= streamThreshold() || streamingChunk();
+    }
+    
+    void setStreamThreshold(size_t bytes) {
+        streamThreshold() = bytes;
+    }
+    
+    // smallest block the scratch arena allocates, so small temporaries don't each get one
+    constexpr size_t scratchBlockBytes = size_t(1) << 16;
+    
+    Scratch::~Scratch() {
+        for (const Block& block : blocks) {
+            ::operator delete(block.data, std::align_val_t(simdAlignment));
+        }
+    }
+    
+    Scratch::Mark Scratch::mark() const {
+        return {current, used};
+    }
+    
+    void Scratch::release(const Mark m) {
+        current = m.block;
+        used = m.used;
+        
+        // the arena is empty and grew past its first block, so it becomes one block of the same size,
+        // and the next batch of the same sizes fits in it without moving between blocks
+        // (release runs in destructors, so if that allocation fails the blocks are just kept)
+        if (current == 0 && used == 0 && blocks.size() > 1) {
+            const size_t size = capacity();
+            void* const data = ::operator new(size, std::align_val_t(simdAlignment), std::nothrow);
+            
+            if (data != nullptr) {
+                for (const Block& block : blocks) {
+                    ::operator delete(block.data, std::align_val_t(simdAlignment));
+                }
+                
+                blocks.resize(1);
+                blocks[0] = {static_cast<unsigned char*>(data), size};
+            }
+        }
+    }
+    
+    size_t Scratch::capacity() const {
+        size_t size = 0;
+        for (const Block& block : blocks) {
+            size += block.size;
+        }
+        
+        return size;
+    }
+    
+    void* Scratch::allocateBytes(const size_t bytes) {
+        if (bytes > SIZE_MAX - simdAlignment) {
+            throw std::bad_array_new_length();
+        }
+        
+        // whole vectors, so the next allocation starts aligned and this one can be processed as whole vectors
+        const size_t size = (bytes + simdAlignment - 1) / simdAlignment * simdAlignment;
+        
+        if (current < blocks.size() && blocks[current].size - used >= size) {
+            used += size;
+            return blocks[current].data + used - size;
+        }
+        
+        if (current + 1 < blocks.size() && blocks[current + 1].size >= size) {
+            current++;
+            used = size;
+            return blocks[current].data;
+        }
+        
+        // the blocks after current are unused, the new one replaces them and is at least as big as everything held so far
+        const size_t first = blocks.empty() ? 0 : current + 1;
+        for (size_t k = first; k < blocks.size(); k++) {
+            ::operator delete(blocks[k].data, std::align_val_t(simdAlignment));
+        }
+        blocks.resize(first);
+        blocks.reserve(first + 1); // so push_back can't throw and leak the block
+        
+        const size_t blockSize = std::max({size, capacity(), scratchBlockBytes});
+        blocks.push_back({static_cast<unsigned char*>(::operator new(blockSize, std::align_val_t(simdAlignment))), blockSize});
+        current = first;
+        used = size;
+        return blocks[current].data;
+    }
+    
+    Scratch& scratch() {
+        thread_local Scratch arena;
+        return arena;
+    }
+    
+    ScratchScope::ScratchScope() : arena(scratch()), start(arena.mark()) {}
+    
+    ScratchScope::~ScratchScope() {
+        arena.release(start);
+    }
+    
+    #ifdef EZSIMD_STATS
+        // how many backends there are, defined after the last one
+        inline size_t backendCount();
+        
+        // calls, elements, and bytes of one backend, summed as one array per backend
+        using Counts = std::vector<std::array<uint64_t, 3>>;
+        
+        // one thread's counts of every backend. only that thread writes them, so counting is a plain load and store
+        // with no locked instructions, and stats() reads them from other threads
+        struct ThreadStats {
+            struct Counter {
+                std::atomic<uint64_t> calls{0};
+                std::atomic<uint64_t> elements{0};
+                std::atomic<uint64_t> bytes{0};
+            };
+            
+            std::vector<Counter> counters;
+            
+            ThreadStats();
+            ~ThreadStats();
+        };
+        
+        // every running thread's counts, the sums of the threads that exited, and the sums at the last resetStats
+        struct StatsRegistry {
+            std::mutex mutex;
+            std::vector<ThreadStats*> threads;
+            Counts exited = Counts(backendCount());
+            Counts baseline = Counts(backendCount());
+        };
+        
+        // never deleted, since pool workers and other threads can still be exiting after static destructors run,
+        // and each one's ~ThreadStats adds its counts here
+        inline StatsRegistry& statsRegistry() {
+            static StatsRegistry* const registry = new StatsRegistry;
+            return *registry;
+        }
+        
+        inline ThreadStats::ThreadStats() : counters(backendCount()) {
+            StatsRegistry& registry = statsRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.threads.push_back(this);
+        }
+        
+        inline ThreadStats::~ThreadStats() {
+            StatsRegistry& registry = statsRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            
+            for (size_t id = 0; id < counters.size(); id++) {
+                registry.exited[id][0] += counters[id].calls;
+                registry.exited[id][1] += counters[id].elements;
+                registry.exited[id][2] += counters[id].bytes;
+            }
+            
+            registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+        }
+        
+        inline void countCall(const size_t id, const size_t l, const size_t bytesPerElement) {
+            thread_local ThreadStats stats;
+            ThreadStats::Counter& counter = stats.counters[id];
+            counter.calls.store(counter.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            counter.elements.store(counter.elements.load(std::memory_order_relaxed) + l, std::memory_order_relaxed);
+            counter.bytes.store(counter.bytes.load(std::memory_order_relaxed) + l * bytesPerElement, std::memory_order_relaxed);
+        }
+        
+        // counts of every backend over all threads since the program started, the registry mutex must be held
+        inline Counts totalCounts(const StatsRegistry& registry) {
+            Counts totals = registry.exited;
+            
+            for (const ThreadStats* thread : registry.threads) {
+                for (size_t id = 0; id < totals.size(); id++) {
+                    totals[id][0] += thread->counters[id].calls.load(std::memory_order_relaxed);
+                    totals[id][1] += thread->counters[id].elements.load(std::memory_order_relaxed);
+                    totals[id][2] += thread->counters[id].bytes.load(std::memory_order_relaxed);
+                }
+            }
+            
+            return totals;
+        }
+    #endif // EZSIMD_STATS
+    
+    // output bytes per chunk, small enough that a chunk of every array stays in L2
+    constexpr size_t parallelChunkBytes = size_t(1) << 16;
+    static_assert(parallelChunkBytes % simdAlignment == 0, "chunks of an aligned_vector must start aligned");
+    
+    void setThreadCount(size_t n) {
+        threadPool().resize(n == 0 ? defaultThreadCount() : n);
+    }
+    
+    void setParallelThreshold(size_t bytes) {
+        parallelThreshold() = bytes;
+    }
+    
+    // splits [0, l) into cache-sized chunks and runs backend(begin, n) on each from the thread pool
+    template <typename T, typename F>
+    void parallelFor(const size_t l, F backend) {
+        const size_t chunk = parallelChunkBytes / sizeof(T);
+        if (l * sizeof(T) < parallelThreshold() || l <= chunk) {
+            backend(0, l);
+            return;
+        }
+        
+        const bool stream = l * sizeof(T) >= streamThreshold();
+        threadPool().run((l + chunk - 1) / chunk, [&](size_t k) {
+            const size_t begin = k * chunk;
+            streamingChunk() = stream;
+            backend(begin, std::min(chunk, l - begin));
+            streamingChunk() = false;
+        });
+    }
+    
+    // like parallelFor, but backend(begin, n) returns a partial result and the partials are merged in order with combine
+    template <typename T, typename F, typename C>
+    T parallelReduce(const size_t l, F backend, C combine) {
+        const size_t chunk = parallelChunkBytes / sizeof(T);
+        if (l * sizeof(T) < parallelThreshold() || l <= chunk) {
+            return backend(0, l);
+        }
+        
+        std::vector<T> partials((l + chunk - 1) / chunk);
+        threadPool().run(partials.size(), [&](size_t k) {
+            const size_t begin = k * chunk;
+            partials[k] = backend(begin, std::min(chunk, l - begin));
+        });
+        
+        T r = partials[0];
+        for (size_t k = 1; k < partials.size(); k++) {
+            r = combine(r, partials[k]);
+        }
+        
+        return r;
+    }`;
+
+    source += ""
+        + "\n    "
+        + "\n    // true if the running CPU has every feature a tier's backends are compiled for"
+    ;
 
-#include <vector>
-#include <array>
+    for (const _simdType of simdType) {
+        source += ""
+            + "\n    inline bool cpuHas" + _simdType + "() {"
+            + "\n        static const bool has = [] {"
+            + "\n            __builtin_cpu_init(); // may run before the CPU model is set up, from another static initializer"
+            + "\n            return " + simdMeta[_simdType].name.split(",").map((feature) => "__builtin_cpu_supports(\"" + feature + "\")").join(" && ") + ";"
+            + "\n        }();"
+            + "\n        return has;"
+            + "\n    }"
+        ;
+    }
+
+    source += ""
+        + "\n    "
+        + "\n    const char* tierName(const Tier tier) {"
+        + "\n        switch (tier) {"
+        + simdType.map((_simdType) => "\n            case Tier::" + _simdType + ": return \"" + _simdType + "\";").join("")
+        + "\n            default: return \"Default\";"
+        + "\n        }"
+        + "\n    }"
+        + "\n    "
+        + "\n    bool cpuSupports(const Tier tier) {"
+        + "\n        switch (tier) {"
+        + simdType.map((_simdType) => "\n            case Tier::" + _simdType + ": return cpuHas" + _simdType + "();").join("")
+        + "\n            default: return true;"
+        + "\n        }"
+        + "\n    }"
+    ;
+
+    source += `
+    
+    // EZSIMD_MAX_ISA names the newest instruction set to use, like SSE2 or avx2, no limit if it is unset or unknown
+    inline Tier maxIsaFromEnvironment() {
+        const char* value = std::getenv("EZSIMD_MAX_ISA");
+        
+        for (int i = int(Tier::Default); value != nullptr && i <= int(Tier::${simdType[simdType.length - 1]}); i++) {
+            const char* name = tierName(Tier(i));
+            size_t k = 0;
+            
+            while (value[k] != '\\0' && std::toupper(static_cast<unsigned char>(value[k])) == std::toupper(static_cast<unsigned char>(name[k]))) {
+                k++;
+            }
+            
+            if (value[k] == '\\0' && name[k] == '\\0') {
+                return Tier(i);
+            }
+        }
+        
+        return Tier::${simdType[simdType.length - 1]};
+    }
+    
+    inline std::atomic<Tier>& maxIsaSetting() {
+        static std::atomic<Tier> tier{maxIsaFromEnvironment()};
+        return tier;
+    }
+    
+    // changed by every setMaxIsa, so each Kernel<Op, T>::get() knows to pick its backend again
+    inline std::atomic<unsigned>& dispatchVersion() {
+        static std::atomic<unsigned> version{1};
+        return version;
+    }
+    
+    // held by Kernel<Op, T>::get() while it picks a backend, only after setMaxIsa or on the first call
+    inline std::mutex& dispatchMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+    
+    void setMaxIsa(const Tier tier) {
+        maxIsaSetting() = tier;
+        dispatchVersion()++;
+    }
+    
+    Tier maxIsa() {
+        return maxIsaSetting();
+    }
+    
+    // backends built for tier may run: the CPU has it and it is no newer than maxIsa()
+    inline bool useTier(const Tier tier) {
+        return tier <= maxIsa() && cpuSupports(tier);
+    }`;
+
+    source += `
+    
+    // n / d for a divisor that stays the same for a whole call, as a multiply and shifts (Granlund and Montgomery),
+    // unsigned: t = mulhi(n, magic), q = (t + ((n - t) >> shift1)) >> shift2
+    // signed: q = ((n + mulhi(n, magic)) >> shift1) - (n >> (bits - 1)), then negated if sign is -1
+    template <typename T>
+    struct DivMagic {
+        T magic;
+        T sign;
+        int shift1;
+        int shift2;
+    };
+    
+    template <typename T>
+    DivMagic<T> divMagic(const T d) {
+        constexpr int bits = sizeof(T) * 8;
+        DivMagic<T> m{};
+        if (d == 0) {
+            return m; // undefined like the scalar loop, but the call shouldn't trap before dividing any element
+        }
+        
+        if constexpr (std::is_signed<T>::value) {
+            const uint64_t abs = d < 0 ? uint64_t(0) - uint64_t(d) : uint64_t(d);
+            int l = 1;
+            while ((uint64_t(1) << l) < abs) {
+                l++;
+            }
+            
+            m.magic = T(1 + (uint64_t(1) << (bits + l - 1)) / abs); // drops the 2^bits that adding n puts back
+            m.sign = d < 0 ? T(-1) : T(0);
+            m.shift1 = l - 1;
+        } else {
+            int l = 0;
+            while ((uint64_t(1) << l) < d) {
+                l++;
+            }
+            
+            m.magic = T((((uint64_t(1) << l) - d) << bits) / d + 1);
+            m.shift1 = std::min(l, 1);
+            m.shift2 = std::max(l - 1, 0);
+        }
+        
+        return m;
+    }
+    
+`;
+
+    for (const _simdType of Object.keys(divTiers)) {
+        source += divisorHelpers(_simdType);
+    }
+
+    header += `#pragma once
+
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <cassert>
-#include <type_traits>
+#include <vector>
+#include <array>
 
-#ifdef EZSIMD_SHOW_FUNC
-    #include <iostream>
+// AVX-512 functions use the F, BW, DQ, and VL subsets together
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__) && defined(__AVX512VL__)
+    #define EZSIMD_AVX512
 #endif
 
-#include "libezsimd.hpp"
+#if defined(__clang__)
+    #warning "clang currently produces unwanted behavior for large amounts of multiversioned functions, keeping only default and best supported SIMD. use g++ for best results."
+
+    #if defined(EZSIMD_AVX512)
+        #undef __FMA__
+        #undef __MMX__
+        #undef __SSE__
+        #undef __SSE2__
+        #undef __AVX__
+        #undef __AVX2__
+    #elif (defined(__MMX__) && defined(__SSE2__) && defined(__AVX2__))
+        #undef __MMX__
+        #undef __SSE2__
+    #elif defined(__SSE2__)
+        #undef __MMX__
+    #elif defined(__MMX__) && defined(__AVX2__)
+        #undef __MMX__
+    #endif
+
+    #if defined(__AVX__)
+        #undef __SSE__
+    #endif
+#elif !(defined(__GNUC__) && !defined(__clang__))
+    #warning "compiler may not be supported. use g++ for best results."
+#endif
+
+// half-precision functions convert to float with F16C and AVX2 integer ops, or use AVX-512's FP16 and BF16 extensions
+#if defined(__AVX2__) && defined(__F16C__)
+    #define EZSIMD_F16C
+#endif
+#if defined(EZSIMD_AVX512) && defined(__AVX512BF16__)
+    #define EZSIMD_AVX512BF16
+#endif
+#if defined(EZSIMD_AVX512) && defined(__AVX512FP16__)
+    #define EZSIMD_AVX512FP16
+#endif
+
+// _Float16 functions are only declared when the compiler has the type
+#if defined(__FLT16_MAX__)
+    #define EZSIMD_FLOAT16
+#endif
+
+namespace ezsimd {
+    template <typename T, size_t N>
+    constexpr inline size_t arrayLength(T (&)[N]) noexcept;
+    
+    #if defined(__BFLT16_MAX__)
+        using bfloat16 = __bf16;
+    #else
+        // the top 16 bits of a float, for compilers without __bf16. arithmetic converts to float,
+        // and converting back rounds to nearest even like the SIMD functions do
+        struct bfloat16 {
+            uint16_t bits;
+            
+            bfloat16() = default;
+            
+            bfloat16(const float value) {
+                uint32_t u;
+                std::memcpy(&u, &value, sizeof(u));
+                bits = (u & 0x7FFFFFFF) > 0x7F800000
+                    ? uint16_t((u >> 16) | 0x40) // NaN, kept quiet instead of letting the rounding carry into the exponent
+                    : uint16_t((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+            }
+            
+            operator float() const {
+                const uint32_t u = uint32_t(bits) << 16;
+                float value;
+                std::memcpy(&value, &u, sizeof(value));
+                return value;
+            }
+        };
+    #endif
+    
+    // pass as the first argument to split large arrays across a thread pool
+    struct Parallel {};
+    constexpr Parallel parallel{};
+    
+    // threads used by ezsimd::parallel calls including the calling thread, 0 for one per hardware thread
+    void setThreadCount(size_t n);
+    // ezsimd::parallel calls on arrays smaller than this many bytes run on the calling thread only
+    void setParallelThreshold(size_t bytes);
+    // outputs of at least this many bytes are written with non-temporal stores that bypass the cache,
+    // 0 to always use them, SIZE_MAX to never use them
+    void setStreamThreshold(size_t bytes);
+    
+    // instruction sets the backends are built for, as runtime values, Default is the scalar loop every op has.
+    // the compile-time tags in ezsimd::isa carry theirs as isa::X::tier
+    enum class Tier {Default, ${simdType.join(", ")}};
+    
+    // "AVX2" for Tier::AVX2
+    const char* tierName(Tier tier);
+    // true if the running CPU has every feature tier's backends are compiled for, checked once per tier
+    bool cpuSupports(Tier tier);
+    // backends newer than tier aren't used even if the CPU has them, like on shared hosts where AVX-512 lowers the clock.
+    // starts as the EZSIMD_MAX_ISA environment variable (EZSIMD_MAX_ISA=SSE2), and can be changed at any time
+    void setMaxIsa(Tier tier);
+    Tier maxIsa();
+    
+    // how much one backend was used, summed over every thread
+    struct Stat {
+        const char* op; // op tag, like "Add" or "MulScalar"
+        const char* type; // element type, like "float"
+        Tier tier;
+        uint64_t calls; // a parallel call counts once per chunk
+        uint64_t elements;
+        uint64_t bytes; // read and written
+    };
+    
+    // every backend called since the program started or resetStats was called, in no particular order.
+    // counting is compiled in only when EZSIMD_STATS is defined, otherwise this is always empty
+    std::vector<Stat> stats();
+    void resetStats();
+    
+    // Kernel<Op, T>::type is the backend function pointer type for op tag Op on element type T,
+    // Kernel<Op, T>::get() returns the best one for this CPU, chosen on the first call,
+    // and Kernel<Op, T>::get(tier) returns the one built for tier without checking the CPU, nullptr if there is none
+    template <typename Op, typename T>
+    struct Kernel;
+    
+    // backend for Op on T, fetch it once and call it directly in hot loops:
+    // auto add = ezsimd::dispatch<ezsimd::op::Add, float>(); add(a, b, c, l);
+    template <typename Op, typename T>
+    typename Kernel<Op, T>::type dispatch();
+    
+    // op tags for ezsimd::dispatch, the Scalar ones take b as a single value
+    namespace op {`;
+
+    for (const _opType of opType) {
+        if (opMeta[_opType]) {
+            header += "\n        struct " + opTag(opMeta[_opType].name) + " {};";
+
+            if (opMeta[_opType].broadcast) {
+                header += "\n        struct " + opTag(opMeta[_opType].name, ["b"]) + " {};";
+            }
+        }
+    }
+
+    for (const _reduceType of reduceType) {
+        header += "\n        struct " + opTag(reduceMeta[_reduceType].name) + " {};";
+    }
+
+    for (const _widenType of widenType) {
+        header += "\n        struct " + opTag(widenMeta[_widenType].name) + " {};";
+    }
+
+    header += ""
+        + "\n    }"
+        + "\n    "
+        + "\n    // instruction sets for the std::array overloads, which are built for one at compile time and inlined,"
+        + "\n    // like ezsimd::add<S, ezsimd::isa::AVX2>(a, b, c). each also uses the narrower ones after it for what's left over."
+        + "\n    // Dispatch is the default, it picks the backend by the CPU and maxIsa() at runtime like the other overloads"
+        + "\n    namespace isa {"
+        + "\n        struct Dispatch {};"
+    ;
+
+    for (const _simdType of fixedTiers) {
+        header += "\n        struct " + _simdType + " {static constexpr Tier tier = Tier::" + _simdType + ";};";
+    }
+
+    header += "\n    }";
+
+    header += `
+    
+    template <typename T>
+    struct ExprArray;
+    
+    template <typename T>
+    struct ExprValue;
+    
+    template <typename Op, typename A, typename B>
+    struct ExprNode;
+    
+    // lazy expressions, ezsimd::eval(ezsimd::expr(a) * b + 1.0f, c) computes c = a * b + 1 in one pass over the arrays,
+    // with the widest instruction set that has every op in the expression and that this CPU supports
+    template <typename T, typename Alloc>
+    ExprArray<T> expr(const std::vector<T, Alloc>& a);
+    template <typename T, size_t S>
+    ExprArray<T> expr(const std::array<T, S>& a);
+    template <typename T>
+    ExprArray<T> expr(const T* a, const size_t l);
+    
+    template <typename Op, typename A, typename B>
+    void eval(const ExprNode<Op, A, B>& e, typename A::type* c);
+    template <typename Op, typename A, typename B, typename Alloc>
+    void eval(const ExprNode<Op, A, B>& e, std::vector<typename A::type, Alloc>& c);
+    template <typename Op, typename A, typename B, size_t S>
+    void eval(const ExprNode<Op, A, B>& e, std::array<typename A::type, S>& c);`;
+
+    header += `
+    
+    // bytes of the widest vector any backend loads or stores, an AVX-512 register. it is the same in every build
+    // so that aligned_vector<T> is one type in ezsimd.cpp and in programs compiled with other -m flags
+    constexpr size_t simdAlignment = 64;
+    
+    // allocates memory aligned to Align and rounded up to a whole Align bytes, so the vector overloads of
+    // ezsimd::aligned_vector skip the alignment checks and do the last few elements as one more whole vector
+    template <typename T, size_t Align = simdAlignment>
+    struct aligned_allocator {
+        using value_type = T;
+        
+        // __int128_t and long double need 16 bytes even when Align is 8
+        static constexpr size_t alignment = Align > alignof(T) ? Align : alignof(T);
+        
+        template <typename U>
+        struct rebind {
+            using other = aligned_allocator<U, Align>;
+        };
+        
+        aligned_allocator() = default;
+        template <typename U>
+        aligned_allocator(const aligned_allocator<U, Align>&) noexcept;
+        
+        T* allocate(size_t n);
+        void deallocate(T* ptr, size_t n) noexcept;
+        
+        template <typename U>
+        bool operator==(const aligned_allocator<U, Align>&) const noexcept;
+        template <typename U>
+        bool operator!=(const aligned_allocator<U, Align>&) const noexcept;
+    };
+    
+    // std::vector aligned and padded for the widest tier, ezsimd::add(a, b, c) on these takes the aligned path
+    template <typename T>
+    using aligned_vector = std::vector<T, aligned_allocator<T>>;
+    
+    // arena for temporary arrays, each allocation aligned and padded to whole vectors like aligned_allocator.
+    // released memory is kept and handed out again, so a loop that marks, allocates, and releases
+    // only calls malloc while the arena grows on its first few iterations:
+    //     const ezsimd::Scratch::Mark m = ezsimd::scratch().mark();
+    //     float* t = ezsimd::scratch().allocate<float>(l);
+    //     ezsimd::mul(a, b, t, l);
+    //     ezsimd::add(t, c, d, l);
+    //     ezsimd::scratch().release(m);
+    class Scratch {
+        public:
+            // how much of the arena was in use
+            struct Mark {
+                size_t block;
+                size_t used;
+            };
+            
+            Scratch() = default;
+            Scratch(const Scratch&) = delete;
+            Scratch& operator=(const Scratch&) = delete;
+            ~Scratch();
+            
+            // n uninitialized elements, valid until a mark taken before this call is released
+            template <typename T>
+            T* allocate(size_t n);
+            
+            Mark mark() const;
+            // frees everything allocated since m was taken, marks taken after m are invalid afterwards
+            void release(Mark m);
+            // bytes held by the arena, in use or not
+            size_t capacity() const;
+        
+        private:
+            struct Block {
+                unsigned char* data;
+                size_t size;
+            };
+            
+            std::vector<Block> blocks;
+            size_t current = 0; // block allocations come from
+            size_t used = 0; // bytes of it in use
+            
+            void* allocateBytes(size_t bytes);
+    };
+    
+    // this thread's arena, created on the first call and freed when the thread exits
+    Scratch& scratch();
+    
+    // marks scratch() when constructed and releases it when destroyed
+    class ScratchScope {
+        public:
+            ScratchScope();
+            ScratchScope(const ScratchScope&) = delete;
+            ScratchScope& operator=(const ScratchScope&) = delete;
+            ~ScratchScope();
+            
+            template <typename T>
+            T* allocate(size_t n);
+        
+        private:
+            Scratch& arena;
+            Scratch::Mark start;
+    };`;
+
+    templ += `#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#include <array>
+#include <new>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 
-// __AVX2__ uses same header as __AVX__
-#if defined(__AVX__)
+// same intrinsics headers as ezsimd.hpp, the std::array kernels are compiled into the calling file
+#if defined(__AVX__) || defined(__FMA__) || defined(EZSIMD_AVX512)
     #include <immintrin.h>
 #endif
 #if defined(__SSE2__)
@@ -43,240 +1878,816 @@ function make(sourcePath, headerPath, templPath) {
 #if defined(__SSE__)
     #include <xmmintrin.h>
 #endif
-#if defined(__MMX__)
-    #include <mmintrin.h>
-#endif
+
+// templated functions declared in libezsimd.hpp, defined in this file
 
 namespace ezsimd {
+    template <typename T, size_t N>
+    constexpr inline size_t arrayLength(T (&)[N]) noexcept {
+        return N;
+    }
+    
+    template <typename Op, typename T>
+    typename Kernel<Op, T>::type dispatch() {
+        return Kernel<Op, T>::get();
+    }
+    
+    // a + b and a - b clamped to T's range instead of wrapping around, what adds and subs do for every element
     template <typename T>
-    bool isAligned(const T* ptr, size_t alignment) {
-        return reinterpret_cast<std::uintptr_t>(static_cast<const void*>(ptr)) % alignment == 0;
+    inline T addSaturate(const T a, const T b) {
+        T r;
+        if (__builtin_add_overflow(a, b, &r)) {
+            return r < a ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min(); // wrapped past the top or the bottom
+        }
+        
+        return r;
+    }
+    
+    template <typename T>
+    inline T subSaturate(const T a, const T b) {
+        T r;
+        if (__builtin_sub_overflow(a, b, &r)) {
+            return r > a ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+        }
+        
+        return r;
     }`;
 
-    header += `#pragma once
+    for (const _simdType of Object.keys(divTiers)) {
+        templ += divHelpers(_simdType);
+    }
+
+    templ += `
+    
+    #ifdef EZSIMD_F16C
+        // 8 floats to bfloat16 bits, rounded to nearest even the same way as the bfloat16(float) conversion
+        inline __m128i narrowBf16F16C(const __m256 vec) {
+            const __m256i u = _mm256_castps_si256(vec);
+            const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(1));
+            const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(u, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), odd)), 16);
+            const __m256i nan = _mm256_or_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(0x40));
+            const __m256i bits = _mm256_blendv_epi8(rounded, nan, _mm256_castps_si256(_mm256_cmp_ps(vec, vec, _CMP_UNORD_Q)));
+            return _mm_packus_epi32(_mm256_castsi256_si128(bits), _mm256_extracti128_si256(bits, 1));
+        }
+    #endif // EZSIMD_F16C`;
+
+    templ += `
+    
+    // Fixed<Isa, Op, T> has lanes, load, set1, apply, and store when Isa's functions support Op on T,
+    // Fixed<void, Op, T> has the scalar apply
+    template <typename Isa, typename Op, typename T>
+    struct Fixed {
+        static constexpr size_t lanes = 0;
+    };
+    
+    // next instruction set to try once Isa can't fill a whole vector, void is scalar
+    template <typename Isa>
+    struct NarrowerIsa;
+    
+    template <typename T>
+    inline T fixedElement(const T* arg, size_t i) {
+        return arg[i];
+    }
+    
+    template <typename T>
+    inline T fixedElement(const T arg, size_t) {
+        return arg;
+    }
+    
+    template <typename F, typename T>
+    inline auto fixedVector(const T* arg, size_t i) {
+        return F::load(arg + i);
+    }
+    
+    template <typename F, typename T>
+    inline auto fixedVector(const T arg, size_t) {
+        return F::set1(arg);
+    }
+    
+    // result[begin, S) = op(args) with as many whole Isa vectors as fit, then the narrower instruction sets for the rest,
+    // all counts are known at compile time so nothing is left to check at runtime
+    template <typename Isa, typename Op, size_t S, size_t begin, typename T, typename... Args>
+    inline void fixedKernel(T* result, const Args... args) {
+        if constexpr (std::is_void<Isa>::value) {
+            #pragma GCC unroll 16
+            for (size_t i = begin; i < S; i++) {
+                result[i] = Fixed<void, Op, T>::apply(fixedElement(args, i)...);
+            }
+        } else {
+            using F = Fixed<Isa, Op, T>;
+            constexpr size_t end = F::lanes == 0 ? begin : begin + (S - begin) / F::lanes * F::lanes;
+            
+            if constexpr (end != begin) {
+                #pragma GCC unroll 16
+                for (size_t i = begin; i < end; i += F::lanes) {
+                    F::store(result + i, F::apply(fixedVector<F>(args, i)...));
+                }
+            }
+            
+            if constexpr (end != S) {
+                fixedKernel<typename NarrowerIsa<Isa>::type, Op, S, end>(result, args...);
+            }
+        }
+    }
+    
+    // fixedKernel from Isa, or from the widest narrower instruction set that cap allows when Isa is newer than cap
+    template <typename Isa, typename Op, size_t S, typename T, typename... Args>
+    inline void fixedCapped(const Tier cap, T* result, const Args... args) {
+        if constexpr (std::is_void<Isa>::value) {
+            fixedKernel<void, Op, S, 0>(result, args...);
+        } else {
+            if (Isa::tier <= cap) {
+                fixedKernel<Isa, Op, S, 0>(result, args...);
+            } else {
+                fixedCapped<typename NarrowerIsa<Isa>::type, Op, S>(cap, result, args...);
+            }
+        }
+    }`;
+
+    for (let k = 0; k < fixedTiers.length; k++) {
+        templ += ""
+            + "\n    "
+            + "\n    template <>"
+            + "\n    struct NarrowerIsa<isa::" + fixedTiers[k] + "> {"
+            + "\n        using type = " + (k + 1 < fixedTiers.length ? "isa::" + fixedTiers[k + 1] : "void") + ";"
+            + "\n    };"
+        ;
+    }
+
+    let _opType;
+    let _numType;
+    let _arrayType;
+    let _simdType;
+
+    for (let i = 0; i < opType.length; i++) { // for each arithmetic opType
+        _opType = opType[i];
+
+        if (!opMeta[_opType]) {
+            continue;
+            // PACK/UNPACK helpers, not ops
+        }
+        
+        source += ""
+            + "\n    "
+            + "\n    #pragma region // " + opMeta[_opType].name
+        ;
+
+        header += ""
+            + "\n    "
+            + "\n    #pragma region // " + opMeta[_opType].name
+        ;
+
+        templ += ""
+            + "\n    "
+            + "\n    #pragma region // " + opMeta[_opType].name
+        ;
+
+        for (let j = 0; j < numType.length; j++) { // for each numType
+            _numType = numType[j];
+
+            if (opMeta[_opType].integerOnly && !isInteger(_numType)) {
+                continue;
+            }
+
+            const args = opMeta[_opType].args;
+            const result = opMeta[_opType].result;
+
+            source += ""
+                + numIfdef(_numType)
+                + "\n        #pragma region // " + numMeta[_numType].numName
+            ;
+
+            header += ""
+                + numIfdef(_numType)
+                + "\n        #pragma region // " + numMeta[_numType].numName
+            ;
+
+            templ += ""
+                + numIfdef(_numType)
+                + "\n        #pragma region // " + numMeta[_numType].numName
+            ;
+
+            templ += fixedSpec(null, _opType, _numType);
+
+            for (const _fixedType of fixedTiers) {
+                if (supportedOps[_fixedType][_opType] && supportedOps[_fixedType][_opType][_numType]) {
+                    templ += fixedSpec(_fixedType, _opType, _numType);
+                }
+            }
+
+            templ += "\n";
+
+            // the broadcast overloads take the last arg as one value, so it is never loaded from memory
+            const variants = opMeta[_opType].broadcast ? [[], [args[args.length - 1]]] : [[]];
+
+            for (const scalars of variants) {
+                const tag = opTag(opMeta[_opType].name, scalars);
+                const kernel = "Kernel<op::" + tag + ", " + numMeta[_numType].numName + ">::get()";
+                const tiers = [];
+                const bytes = (arrayArgs(_opType, scalars).length + 1) + " * sizeof(" + numMeta[_numType].numName + ")";
+                const alignedParams = vectorParams(_opType, _numType, scalars).replace(/std::vector</g, "aligned_vector<");
+
+                source += ""
+                    + "\n            inline void " + opMeta[_opType].name + "BackendDefault(" + pointerParams(_opType, _numType, scalars) + ", const size_t l) {"
+                    + overlapGuard(_opType, _numType, "                ", opMeta[_opType].name + "BackendDefault(", scalars)
+                    + statsCount(tag, numMeta[_numType].numName, "Default", bytes, "                ")
+                    + defaultBody(_opType, _numType, scalars)
+                    + "\n            }"
+                ;
+
+                for (let k = 0; k < simdType.length; k++) { // for each simdType
+                    _simdType = simdType[k];
+
+                    if (supportedOps[_simdType][_opType] && supportedOps[_simdType][_opType][_numType] && (scalars.length == 0 || functions[_simdType]["SET1"][_numType])) {
+                        tiers.push(_simdType);
+
+                        source += ""
+                            + "\n"
+                            + tierIfdef(_simdType, "            ")
+                            + "\n                __attribute__((target(\"" + simdMeta[_simdType].name + "\")))"
+                            + "\n                inline void " + opMeta[_opType].name + "Backend" + _simdType + "(" + pointerParams(_opType, _numType, scalars) + ", const size_t l) {"
+                        ;
+
+                        const id = statsEntries.length;
+                        source += overlapGuard(_opType, _numType, "                    ", opMeta[_opType].name + "Backend" + _simdType + "(", scalars);
+                        source += statsCount(tag, numMeta[_numType].numName, _simdType, bytes, "                    ");
+                        source += simdBody(_simdType, _opType, _numType, scalars);
+
+                        if (_simdType == "MMX") {
+                            source += ""
+                                + "\n                    "
+                                + "\n                    _mm_empty();"
+                            ;
+                        }
+
+                        // separate arrays from ezsimd::aligned_allocator can't partially overlap, so there is no overlap guard
+                        source += ""
+                            + "\n                }"
+                            + "\n                "
+                            + "\n                __attribute__((target(\"" + simdMeta[_simdType].name + "\")))"
+                            + "\n                inline void " + opMeta[_opType].name + "Backend" + _simdType + "Aligned(" + pointerParams(_opType, _numType, scalars) + ", const size_t l) {"
+                            + statsCount(tag, numMeta[_numType].numName, _simdType, bytes, "                    ", id)
+                            + alignedBody(_simdType, _opType, _numType, scalars)
+                        ;
+
+                        if (_simdType == "MMX") {
+                            source += ""
+                                + "\n                    "
+                                + "\n                    _mm_empty();"
+                            ;
+                        }
+
+                        source += ""
+                            + "\n                }"
+                            + tierEndif(_simdType, "            ")
+                        ;
+                    }
+                }
+
+                source += kernelGet(tag, numMeta[_numType].numName, opMeta[_opType].name + "Backend", tiers);
+                source += kernelPick(tag, numMeta[_numType].numName, opMeta[_opType].name + "Backend", tiers, "getAligned", "Aligned");
+
+                source += ""
+                    + "\n"
+                    + "\n            void " + opMeta[_opType].name + "(" + vectorParams(_opType, _numType, scalars) + ") {"
+                    + arrayArgs(_opType, scalars).slice(1).map((arg) => "\n                assert(a.size() == " + arg + ".size());").join("")
+                    + "\n                assert(" + result + ".size() >= a.size());"
+                    + "\n                " + kernel + "(" + allArgs(_opType, ".data()", scalars) + ", a.size());"
+                    + "\n            }"
+                    + "\n            "
+                    + "\n            void " + opMeta[_opType].name + "(" + pointerParams(_opType, _numType, scalars) + ", const size_t l) {"
+                    + "\n                " + kernel + "(" + allArgs(_opType, "", scalars) + ", l);"
+                    + "\n            }"
+                    + "\n            "
+                    + "\n            void " + opMeta[_opType].name + "(Parallel, " + vectorParams(_opType, _numType, scalars) + ") {"
+                    + arrayArgs(_opType, scalars).slice(1).map((arg) => "\n                assert(a.size() == " + arg + ".size());").join("")
+                    + "\n                assert(" + result + ".size() >= a.size());"
+                    + "\n                " + opMeta[_opType].name + "(parallel, " + allArgs(_opType, ".data()", scalars) + ", a.size());"
+                    + "\n            }"
+                    + "\n            "
+                    + "\n            void " + opMeta[_opType].name + "(Parallel, " + pointerParams(_opType, _numType, scalars) + ", const size_t l) {"
+                    + overlapGuard(_opType, _numType, "                ", opMeta[_opType].name + "(parallel, ", scalars)
+                    + "\n                const auto backend = " + kernel + ";"
+                    + "\n                parallelFor<" + numMeta[_numType].numName + ">(l, [=](const size_t begin, const size_t n) {backend(" + allArgs(_opType, " + begin", scalars) + ", n);});"
+                    + "\n            }"
+                    + "\n            "
+                    + "\n            void " + opMeta[_opType].name + "(" + alignedParams + ") {"
+                    + arrayArgs(_opType, scalars).slice(1).map((arg) => "\n                assert(a.size() == " + arg + ".size());").join("")
+                    + "\n                assert(" + result + ".size() >= a.size());"
+                    + "\n                "
+                    + "\n                // a whole vector past a.size() would overwrite elements of a longer " + result + " instead of its padding"
+                    + "\n                if (" + result + ".size() == a.size()) {"
+                    + "\n                    Kernel<op::" + tag + ", " + numMeta[_numType].numName + ">::getAligned()(" + allArgs(_opType, ".data()", scalars) + ", a.size());"
+                    + "\n                } else {"
+                    + "\n                    " + kernel + "(" + allArgs(_opType, ".data()", scalars) + ", a.size());"
+                    + "\n                }"
+                    + "\n            }"
+                    + "\n            "
+                    + "\n            void " + opMeta[_opType].name + "(Parallel, " + alignedParams + ") {"
+                    + arrayArgs(_opType, scalars).slice(1).map((arg) => "\n                assert(a.size() == " + arg + ".size());").join("")
+                    + "\n                assert(" + result + ".size() >= a.size());"
+                    + "\n                "
+                    + "\n                // chunks start at multiples of parallelChunkBytes, so each one is aligned, and every chunk but the last"
+                    + "\n                // is whole vectors, so only the last one reads and writes the padding"
+                    + "\n                if (" + result + ".size() == a.size()) {"
+                    + "\n                    const auto backend = Kernel<op::" + tag + ", " + numMeta[_numType].numName + ">::getAligned();"
+                    + "\n                    parallelFor<" + numMeta[_numType].numName + ">(a.size(), [&](const size_t begin, const size_t n) {backend(" + allArgs(_opType, ".data() + begin", scalars) + ", n);});"
+                    + "\n                } else {"
+                    + "\n                    " + opMeta[_opType].name + "(parallel, " + allArgs(_opType, ".data()", scalars) + ", a.size());"
+                    + "\n                }"
+                    + "\n            }"
+                ;
+
+                header += ""
+                    + kernelDecl(tag, numMeta[_numType].numName, "void", pointerParams(_opType, _numType, scalars), true)
+                    + "\n            void " + opMeta[_opType].name + "(" + vectorParams(_opType, _numType, scalars) + ");"
+                    + "\n            template <size_t S, typename Isa = isa::Dispatch>"
+                    + "\n            void " + opMeta[_opType].name + "(" + arrayParams(_opType, _numType, scalars) + ");"
+                    + "\n            void " + opMeta[_opType].name + "(" + pointerParams(_opType, _numType, scalars) + ", const size_t l);"
+                    + "\n            void " + opMeta[_opType].name + "(Parallel, " + vectorParams(_opType, _numType, scalars) + ");"
+                    + "\n            void " + opMeta[_opType].name + "(Parallel, " + pointerParams(_opType, _numType, scalars) + ", const size_t l);"
+                    + "\n            void " + opMeta[_opType].name + "(" + alignedParams + ");"
+                    + "\n            void " + opMeta[_opType].name + "(Parallel, " + alignedParams + ");"
+                ;
+
+                templ += ""
+                    + "\n            template <size_t S, typename Isa>"
+                    + "\n            void " + opMeta[_opType].name + "(" + arrayParams(_opType, _numType, scalars) + ") {"
+                    + "\n                if constexpr (std::is_same<Isa, isa::Dispatch>::value) {"
+                    + "\n                    dispatch<op::" + tag + ", " + numMeta[_numType].numName + ">()(" + allArgs(_opType, ".data()", scalars) + ", S);"
+                    + "\n                } else {"
+                    + "\n                    fixedCapped<Isa, op::" + opTag(opMeta[_opType].name) + ", S>(maxIsa(), " + result + ".data(), " + args.map((arg) => scalars.includes(arg) ? arg : arg + ".data()").join(", ") + ");"
+                    + "\n                }"
+                    + "\n            }"
+                ;
+
+                if (args.length == 2) {
+                    // a op= b, the same kernels with the result being a
+                    const numName = numMeta[_numType].numName;
+                    const b = scalars.length ? "const " + numName + " b" : null;
+                    const vectors = "std::vector<" + numName + ">& a, " + (b || "const std::vector<" + numName + ">& b");
+                    const alignedVectors = vectors.replace(/std::vector</g, "aligned_vector<");
+                    const arrays = "std::array<" + numName + ", S>& a, " + (b || "const std::array<" + numName + ", S>& b");
+                    const pointers = numName + "* a, " + (b || "const " + numName + "* b");
+                    const name = opMeta[_opType].name + "Inplace";
+
+                    source += ""
+                        + "\n            "
+                        + "\n            void " + name + "(" + vectors + ") {"
+                        + "\n                " + opMeta[_opType].name + "(a, b, a);"
+                        + "\n            }"
+                        + "\n            "
+                        + "\n            void " + name + "(" + pointers + ", const size_t l) {"
+                        + "\n                " + kernel + "(a, b, a, l);"
+                        + "\n            }"
+                        + "\n            "
+                        + "\n            void " + name + "(Parallel, " + vectors + ") {"
+                        + "\n                " + opMeta[_opType].name + "(parallel, a, b, a);"
+                        + "\n            }"
+                        + "\n            "
+                        + "\n            void " + name + "(Parallel, " + pointers + ", const size_t l) {"
+                        + "\n                " + opMeta[_opType].name + "(parallel, a, b, a, l);"
+                        + "\n            }"
+                        + "\n            "
+                        + "\n            void " + name + "(" + alignedVectors + ") {"
+                        + "\n                " + opMeta[_opType].name + "(a, b, a);"
+                        + "\n            }"
+                        + "\n            "
+                        + "\n            void " + name + "(Parallel, " + alignedVectors + ") {"
+                        + "\n                " + opMeta[_opType].name + "(parallel, a, b, a);"
+                        + "\n            }"
+                    ;
 
-#include <cstdint>
-#include <vector>
-#include <array>
+                    header += ""
+                        + "\n            void " + name + "(" + vectors + ");"
+                        + "\n            template <size_t S, typename Isa = isa::Dispatch>"
+                        + "\n            void " + name + "(" + arrays + ");"
+                        + "\n            void " + name + "(" + pointers + ", const size_t l);"
+                        + "\n            void " + name + "(Parallel, " + vectors + ");"
+                        + "\n            void " + name + "(Parallel, " + pointers + ", const size_t l);"
+                        + "\n            void " + name + "(" + alignedVectors + ");"
+                        + "\n            void " + name + "(Parallel, " + alignedVectors + ");"
+                    ;
 
-#if defined(__clang__)
-    #warning "clang currently produces unwanted behavior for large amounts of multiversioned functions, keeping only default and best supported SIMD. use g++ for best results."
+                    templ += ""
+                        + "\n            "
+                        + "\n            template <size_t S, typename Isa>"
+                        + "\n            void " + name + "(" + arrays + ") {"
+                        + "\n                " + opMeta[_opType].name + "<S, Isa>(a, b, a);"
+                        + "\n            }"
+                    ;
+                }
+            }
 
-    #if (defined(__MMX__) && defined(__SSE2__) && defined(__AVX2__))
-        #undef __MMX__
-        #undef __SSE2__
-    #elif defined(__SSE2__)
-        #undef __MMX__
-    #elif defined(__MMX__) && defined(__AVX2__)
-        #undef __MMX__
-    #endif
+            source += ""
+                + "\n        #pragma endregion // " + numMeta[_numType].numName
+                + numEndif(_numType)
+                + "\n"
+            ;
 
-    #if defined(__AVX__)
-        #undef __SSE__
-    #endif
-#elif !(defined(__GNUC__) && !defined(__clang__))
-    #warning "compiler may not be supported. use g++ for best results."
-#endif
+            header += ""
+                + "\n        #pragma endregion // " + numMeta[_numType].numName
+                + numEndif(_numType)
+                + "\n"
+            ;
 
-namespace ezsimd {
-    template <typename T, size_t N>
-    constexpr inline size_t arrayLength(T (&)[N]) noexcept;`;
+            templ += ""
+                + "\n        #pragma endregion // " + numMeta[_numType].numName
+                + numEndif(_numType)
+                + "\n"
+            ;
+        }
 
-    templ += `#pragma once
+        source += ""
+            + "    #pragma endregion // " + opMeta[_opType].name
+        ;
 
-#include <cstdint>
-#include <array>
+        header += ""
+            + "        "
+            + "\n        #define " + opMeta[_opType].capsName + "(" + allArgs(_opType, "") + ") " + opMeta[_opType].name + "(" + allArgs(_opType, "") + ", ezsimd::arrayLength(a))"
+            + (opMeta[_opType].args.length == 2 ? "\n        #define " + opMeta[_opType].capsName + "_INPLACE(a, b) " + opMeta[_opType].name + "Inplace(a, b, ezsimd::arrayLength(a))" : "")
+            + "\n    #pragma endregion // " + opMeta[_opType].name
+        ;
 
-// all backend functions are declared here so templated frontends can work properly
-// templated functions declared in libezsimd.hpp, defined in this file
+        templ += ""
+            + "    #pragma endregion // " + opMeta[_opType].name
+        ;
+    }
 
-namespace ezsimd {
-    template <typename T, size_t N>
-    constexpr inline size_t arrayLength(T (&)[N]) noexcept {
-        return N;
-    }`;
+    let _reduceType;
 
-    let _opType;
-    let _numType;
-    let _arrayType;
-    let _simdType;
+    for (let i = 0; i < reduceType.length; i++) { // for each reduction
+        _reduceType = reduceType[i];
+        const name = reduceMeta[_reduceType].name;
+        const args = reduceMeta[_reduceType].args;
+        const nonEmpty = reduceMeta[_reduceType].combine != "ADD"; // min and max of nothing is undefined
 
-    for (let i = 0; i < 4; i++) { // for each opType
-        _opType = opType[i];
-        
         source += ""
             + "\n    "
-            + "\n    #pragma region // " + opMeta[_opType].name
+            + "\n    #pragma region // " + name
         ;
 
         header += ""
             + "\n    "
-            + "\n    #pragma region // " + opMeta[_opType].name
+            + "\n    #pragma region // " + name
         ;
 
         templ += ""
             + "\n    "
-            + "\n    #pragma region // " + opMeta[_opType].name
+            + "\n    #pragma region // " + name
         ;
 
-        for (let j = 0; j < 14; j++) { // for each numType
+        for (let j = 0; j < numType.length; j++) { // for each numType
             _numType = numType[j];
 
-            if (_numType == "FLOAT16") {
-                continue;
-                // not supported
-            }
+            const numName = numMeta[_numType].numName;
+            const pointers = args.map((arg) => "const " + numName + "* " + arg).join(", ");
+            const vectors = args.map((arg) => "const std::vector<" + numName + ">& " + arg).join(", ");
+            const alignedVectors = vectors.replace(/std::vector</g, "aligned_vector<");
+            const tag = opTag(name);
+            const kernel = "Kernel<op::" + tag + ", " + numName + ">::get()";
+            const tiers = [];
 
             source += ""
-                + "\n        #pragma region // " + numMeta[_numType].numName
+                + numIfdef(_numType)
+                + "\n        #pragma region // " + numName
+                + "\n            inline " + numName + " " + name + "BackendDefault(" + pointers + ", const size_t l) {"
+                + statsCount(tag, numName, "Default", args.length + " * sizeof(" + numName + ")", "                ")
+                + "\n                " + numName + " r = " + (nonEmpty ? "a[0]" : "0") + ";"
+                + scalarReduceLoop(_reduceType, "                ", "size_t i = " + (nonEmpty ? "1" : "0"), "l")
+                + "\n                "
+                + "\n                return r;"
+                + "\n            }"
             ;
 
             header += ""
-                + "\n        #pragma region // " + numMeta[_numType].numName
+                + numIfdef(_numType)
+                + "\n        #pragma region // " + numName
+                + kernelDecl(tag, numName, numName, pointers)
             ;
 
             templ += ""
-                + "\n        #pragma region // " + numMeta[_numType].numName
+                + numIfdef(_numType)
+                + "\n        #pragma region // " + numName
             ;
 
+            for (let k = 0; k < simdType.length; k++) { // for each simdType
+                _simdType = simdType[k];
+
+                if (!reduceSupported(_simdType, _reduceType, _numType)) {
+                    continue;
+                }
+
+                tiers.push(_simdType);
+
+                source += ""
+                    + "\n"
+                    + tierIfdef(_simdType, "            ")
+                    + "\n                __attribute__((target(\"" + simdMeta[_simdType].name + "\")))"
+                    + "\n                inline " + numName + " " + name + "Backend" + _simdType + "(" + pointers + ", const size_t l) {"
+                    + statsCount(tag, numName, _simdType, args.length + " * sizeof(" + numName + ")", "                    ")
+                    + reduceBody(_simdType, _reduceType, _numType)
+                    + "\n                }"
+                    + tierEndif(_simdType, "            ")
+                ;
+            }
+
+            const vectorAsserts = args.slice(1).map((arg) => "\n                assert(a.size() == " + arg + ".size());").join("")
+                + (nonEmpty ? "\n                assert(!a.empty());" : "");
+
+            source += kernelGet(tag, numName, name + "Backend", tiers);
+
             source += ""
-                + "\n            __attribute__((target(\"default\")))"
-                + "\n            inline void " + opMeta[_opType].name + "Backend(const " + numMeta[_numType].numName + "* a, const " + numMeta[_numType].numName + "* b, " + numMeta[_numType].numName + "* c, const size_t l) {"
-                + "\n                #ifdef EZSIMD_SHOW_FUNC"
-                + "\n                    EZSIMD_SHOW_FUNC << \"target(\\\"default\\\") " + opMeta[_opType].name + "\\n\";"
-                + "\n                #endif"
-                + "\n                "
-                + "\n                for (size_t i = 0; i < l; i++) {"
-                + "\n                    c[i] = a[i] + b[i];"
-                + "\n                }"
+                + "\n"
+                + "\n            " + numName + " " + name + "(" + vectors + ") {"
+                + vectorAsserts
+                + "\n                return " + kernel + "(" + args.map((arg) => arg + ".data()").join(", ") + ", a.size());"
+                + "\n            }"
+                + "\n            "
+                + "\n            " + numName + " " + name + "(" + pointers + ", const size_t l) {"
+                + (nonEmpty ? "\n                assert(l != 0);" : "")
+                + "\n                return " + kernel + "(" + args.join(", ") + ", l);"
+                + "\n            }"
+                + "\n            "
+                + "\n            " + numName + " " + name + "(Parallel, " + vectors + ") {"
+                + vectorAsserts
+                + "\n                return " + name + "(parallel, " + args.map((arg) => arg + ".data()").join(", ") + ", a.size());"
+                + "\n            }"
+                + "\n            "
+                + "\n            " + numName + " " + name + "(Parallel, " + pointers + ", const size_t l) {"
+                + (nonEmpty ? "\n                assert(l != 0);" : "")
+                + "\n                const auto backend = " + kernel + ";"
+                + "\n                return parallelReduce<" + numName + ">(l,"
+                + "\n                    [=](const size_t begin, const size_t n) {return backend(" + args.map((arg) => arg + " + begin").join(", ") + ", n);},"
+                + "\n                    [](const " + numName + " x, const " + numName + " y) {return " + scalarCombine(_reduceType, "x", "y") + ";}"
+                + "\n                );"
+                + "\n            }"
+                + "\n            "
+                + "\n            " + numName + " " + name + "(" + alignedVectors + ") {"
+                + vectorAsserts
+                + "\n                return " + kernel + "(" + args.map((arg) => arg + ".data()").join(", ") + ", a.size());"
+                + "\n            }"
+                + "\n            "
+                + "\n            " + numName + " " + name + "(Parallel, " + alignedVectors + ") {"
+                + vectorAsserts
+                + "\n                return " + name + "(parallel, " + args.map((arg) => arg + ".data()").join(", ") + ", a.size());"
                 + "\n            }"
+                + "\n        #pragma endregion // " + numName
+                + numEndif(_numType)
+                + "\n"
+            ;
+
+            header += ""
+                + "\n            " + numName + " " + name + "(" + vectors + ");"
+                + "\n            template <size_t S>"
+                + "\n            " + numName + " " + name + "(" + args.map((arg) => "const std::array<" + numName + ", S>& " + arg).join(", ") + ");"
+                + "\n            " + numName + " " + name + "(" + pointers + ", const size_t l);"
+                + "\n            " + numName + " " + name + "(Parallel, " + vectors + ");"
+                + "\n            " + numName + " " + name + "(Parallel, " + pointers + ", const size_t l);"
+                + "\n            " + numName + " " + name + "(" + alignedVectors + ");"
+                + "\n            " + numName + " " + name + "(Parallel, " + alignedVectors + ");"
+                + "\n        #pragma endregion // " + numName
+                + numEndif(_numType)
+                + "\n"
             ;
 
             templ += ""
-                + "\n            __attribute__((target(\"default\")))"
-                + "\n            inline void " + opMeta[_opType].name + "Backend(const " + numMeta[_numType].numName + "* a, const " + numMeta[_numType].numName + "* b, " + numMeta[_numType].numName + "* c, const size_t l);"
+                + "\n            template <size_t S>"
+                + "\n            " + numName + " " + name + "(" + args.map((arg) => "const std::array<" + numName + ", S>& " + arg).join(", ") + ") {"
+                + (nonEmpty ? "\n                static_assert(S != 0, \"" + name + " of an empty array\");" : "")
+                + "\n                return dispatch<op::" + tag + ", " + numName + ">()(" + args.map((arg) => arg + ".data()").join(", ") + ", S);"
+                + "\n            }"
+                + "\n        #pragma endregion // " + numName
+                + numEndif(_numType)
                 + "\n"
             ;
+        }
 
-            for (let k = 0; k < 5; k++) { // for each simdType
-                _simdType = simdType[k];
+        source += ""
+            + "    #pragma endregion // " + name
+        ;
 
-                if (supportedOps[_simdType][_opType][_numType]) {
-                    templ += ""
-                        + "\n            #ifdef " + simdMeta[_simdType].ifdefMacro
-                        + "\n                __attribute__((target(\"" + simdMeta[_simdType].name + "\")))"
-                        + "\n                inline void " + opMeta[_opType].name + "Backend(const " + numMeta[_numType].numName + "* a, const " + numMeta[_numType].numName + "* b, " + numMeta[_numType].numName + "* c, const size_t l);"
-                        + "\n            #endif // " + simdMeta[_simdType].ifdefMacro
-                        + "\n"
-                    ;
+        header += ""
+            + (reduceMeta[_reduceType].capsName
+                ? "        "
+                    + "\n        #define " + reduceMeta[_reduceType].capsName + "(" + args.join(", ") + ") " + name + "(" + args.join(", ") + ", ezsimd::arrayLength(a))"
+                    + "\n"
+                : "")
+            + "    #pragma endregion // " + name
+        ;
 
-                    source += ""
-                        + "\n"
-                        + "\n            #ifdef " + simdMeta[_simdType].ifdefMacro
-                        + "\n                __attribute__((target(\"" + simdMeta[_simdType].name + "\")))"
-                        + "\n                inline void " + opMeta[_opType].name + "Backend(const " + numMeta[_numType].numName + "* a, const " + numMeta[_numType].numName + "* b, " + numMeta[_numType].numName + "* c, const size_t l) {"
-                        + "\n                    #ifdef EZSIMD_SHOW_FUNC"
-                        + "\n                        EZSIMD_SHOW_FUNC << \"target(\\\"" + simdMeta[_simdType].name + "\\\") " + opMeta[_opType].name + "\\n\";"
-                        + "\n                    #endif"
-                        + "\n                    "
-                        + "\n                    size_t i = 0;"
-                        + "\n                    " + simdRegTypenames[_simdType][_numType] + " vec_a;"
-                        + "\n                    " + simdRegTypenames[_simdType][_numType] + " vec_b;"
-                        + "\n                    " + simdRegTypenames[_simdType][_numType] + " vec_c;"
-                        + "\n                    const bool isAlignedA = isAligned(a, " + (simdMeta[_simdType].bitSize / 8) + ");"
-                        + "\n                    const bool isAlignedB = isAligned(b, " + (simdMeta[_simdType].bitSize / 8) + ");"
-                        + "\n                    const bool isAlignedC = isAligned(c, " + (simdMeta[_simdType].bitSize / 8) + ");"
-                        + "\n                    "
-                        + "\n                    for (; i + " + ((simdMeta[_simdType].bitSize / numMeta[_numType].bitSize) - 1) + " < l; i += " + (simdMeta[_simdType].bitSize / numMeta[_numType].bitSize) + ") {"
-                        + "\n                        if (isAlignedA) {"
-                        + "\n                            vec_a = " + functions[_simdType]["PACK_ALIGNED"][_numType] + "(a + i);"
-                        + "\n                        } else {"
-                        + "\n                            vec_a = " + functions[_simdType]["PACK_UNALIGNED"][_numType] + "(a + i);"
-                        + "\n                        }"
-                        + "\n                        "
-                        + "\n                        if (isAlignedB) {"
-                        + "\n                            vec_b = " + functions[_simdType]["PACK_ALIGNED"][_numType] + "(b + i);"
-                        + "\n                        } else {"
-                        + "\n                            vec_b = " + functions[_simdType]["PACK_UNALIGNED"][_numType] + "(b + i);"
-                        + "\n                        }"
-                        + "\n                        "
-                        + "\n                        vec_c = " + functions[_simdType][_opType][_numType] + "(vec_a, vec_b);"
-                        + "\n                        "
-                        + "\n                        if (isAlignedC) {"
-                        + "\n                            " + functions[_simdType]["UNPACK_ALIGNED"][_numType] + "(c + i, vec_c);"
-                        + "\n                        } else {"
-                        + "\n                            " + functions[_simdType]["UNPACK_UNALIGNED"][_numType] + "(c + i, vec_c);"
-                        + "\n                        }"
-                        + "\n                    }"
-                        + "\n                    "
-                        + "\n                    for (; i < l; i++) {"
-                        + "\n                        c[i] = a[i] + b[i];"
-                        + "\n                    }"
-                    ;
+        templ += ""
+            + "    #pragma endregion // " + name
+        ;
+    }
 
-                    if (_simdType == "MMX") {
-                        source += ""
-                            + "\n                    "
-                            + "\n                    _mm_empty();"
-                        ;
-                    }
+    let _widenType;
 
-                    source += ""
-                        + "\n                }"
-                        + "\n            #endif // " + simdMeta[_simdType].ifdefMacro
-                    ;
+    for (let i = 0; i < widenType.length; i++) { // for each widening op
+        _widenType = widenType[i];
+        const meta = widenMeta[_widenType];
+        const name = meta.name;
+        const args = meta.args;
+        const tag = opTag(name);
+
+        source += ""
+            + "\n    "
+            + "\n    #pragma region // " + name
+        ;
+
+        header += ""
+            + "\n    "
+            + "\n    #pragma region // " + name
+        ;
+
+        templ += ""
+            + "\n    "
+            + "\n    #pragma region // " + name
+        ;
+
+        for (let j = 0; j < numType.length; j++) { // for each numType with a wider type
+            _numType = numType[j];
+
+            if (!numMeta[_numType].wider) {
+                continue;
+            }
+
+            const numName = numMeta[_numType].numName;
+            const wideName = numMeta[numMeta[_numType].wider].numName;
+            const pointers = widenPointerParams(_widenType, _numType);
+            const vectors = widenContainerParams(_widenType, _numType, (T) => "std::vector<" + T + ">");
+            const alignedVectors = widenContainerParams(_widenType, _numType, (T) => "aligned_vector<" + T + ">");
+            const arrays = widenContainerParams(_widenType, _numType, (T) => "std::array<" + T + ", S>");
+            const kernel = "Kernel<op::" + tag + ", " + numName + ">::get()";
+            const vectorAsserts = args.slice(1).map((arg) => "\n                assert(a.size() == " + arg + ".size());").join("")
+                + "\n                assert(c.size() >= a.size());";
+            const tiers = [];
+            // a and b are read and c written, narrow reads the wide type instead
+            const bytes = widenMeta[_widenType].narrows
+                ? "sizeof(" + wideName + ") + sizeof(" + numName + ")"
+                : args.length + " * sizeof(" + numName + ") + sizeof(" + wideName + ")";
+
+            source += ""
+                + numIfdef(_numType)
+                + "\n        #pragma region // " + numName
+                + "\n            inline void " + name + "BackendDefault(" + pointers + ", const size_t l) {"
+                + statsCount(tag, numName, "Default", bytes, "                ")
+                + widenScalarLoop(_widenType, _numType, "                ", "size_t i = 0", "l")
+                + "\n            }"
+            ;
+
+            for (let k = 0; k < simdType.length; k++) { // for each simdType
+                _simdType = simdType[k];
+
+                if (!widenSupported(_simdType, _widenType, _numType)) {
+                    continue;
                 }
+
+                tiers.push(_simdType);
+
+                source += ""
+                    + "\n"
+                    + tierIfdef(_simdType, "            ")
+                    + "\n                __attribute__((target(\"" + simdMeta[_simdType].name + "\")))"
+                    + "\n                inline void " + name + "Backend" + _simdType + "(" + pointers + ", const size_t l) {"
+                    + statsCount(tag, numName, _simdType, bytes, "                    ")
+                    + widenBody(_simdType, _widenType, _numType)
+                    + "\n                }"
+                    + tierEndif(_simdType, "            ")
+                ;
             }
 
+            source += kernelGet(tag, numName, name + "Backend", tiers);
+
             source += ""
                 + "\n"
-                + "\n            void " + opMeta[_opType].name + "(const std::vector<" + numMeta[_numType].numName + ">& a, const std::vector<" + numMeta[_numType].numName + ">& b, std::vector<" + numMeta[_numType].numName + ">& c) {"
-                + "\n                assert(a.size() == b.size());"
-                + "\n                assert(c.size() >= a.size());"
-                + "\n                " + opMeta[_opType].name + "Backend(a.data(), b.data(), c.data(), a.size());"
+                + "\n            void " + name + "(" + vectors + ") {"
+                + vectorAsserts
+                + "\n                " + kernel + "(" + args.map((arg) => arg + ".data()").join(", ") + ", c.data(), a.size());"
                 + "\n            }"
                 + "\n            "
-                + "\n            void " + opMeta[_opType].name + "(const " + numMeta[_numType].numName + "* a, const " + numMeta[_numType].numName + "* b, " + numMeta[_numType].numName + "* c, const size_t l) {"
-                + "\n                " + opMeta[_opType].name + "Backend(a, b, c, l);"
+                + "\n            void " + name + "(" + pointers + ", const size_t l) {"
+                + "\n                " + kernel + "(" + args.join(", ") + ", c, l);"
                 + "\n            }"
-                + "\n        #pragma endregion // " + numMeta[_numType].numName
+                + "\n            "
+                + "\n            void " + name + "(Parallel, " + vectors + ") {"
+                + vectorAsserts
+                + "\n                " + name + "(parallel, " + args.map((arg) => arg + ".data()").join(", ") + ", c.data(), a.size());"
+                + "\n            }"
+                + "\n            "
+                + "\n            void " + name + "(Parallel, " + pointers + ", const size_t l) {"
+                + "\n                const auto backend = " + kernel + ";"
+                + "\n                parallelFor<" + wideName + ">(l, [=](const size_t begin, const size_t n) {backend(" + args.map((arg) => arg + " + begin").join(", ") + ", c + begin, n);});"
+                + "\n            }"
+                + "\n            "
+                + "\n            void " + name + "(" + alignedVectors + ") {"
+                + vectorAsserts
+                + "\n                " + kernel + "(" + args.map((arg) => arg + ".data()").join(", ") + ", c.data(), a.size());"
+                + "\n            }"
+                + "\n            "
+                + "\n            void " + name + "(Parallel, " + alignedVectors + ") {"
+                + vectorAsserts
+                + "\n                " + name + "(parallel, " + args.map((arg) => arg + ".data()").join(", ") + ", c.data(), a.size());"
+                + "\n            }"
+                + "\n        #pragma endregion // " + numName
+                + numEndif(_numType)
                 + "\n"
             ;
 
             header += ""
-                + "\n            void " + opMeta[_opType].name + "(const std::vector<" + numMeta[_numType].numName + ">& a, const std::vector<" + numMeta[_numType].numName + ">& b, std::vector<" + numMeta[_numType].numName + ">& c);"
+                + numIfdef(_numType)
+                + "\n        #pragma region // " + numName
+                + kernelDecl(tag, numName, "void", pointers)
+                + "\n            void " + name + "(" + vectors + ");"
                 + "\n            template <size_t S>"
-                + "\n            void " + opMeta[_opType].name + "(const std::array<" + numMeta[_numType].numName + ", S>& a, const std::array<" + numMeta[_numType].numName + ", S>& b, std::array<" + numMeta[_numType].numName +", S>& c);"
-                + "\n            void " + opMeta[_opType].name + "(const " + numMeta[_numType].numName + "* a, const " + numMeta[_numType].numName + "* b, " + numMeta[_numType].numName + "* c, const size_t l);"
-                + "\n        #pragma endregion // " + numMeta[_numType].numName
+                + "\n            void " + name + "(" + arrays + ");"
+                + "\n            void " + name + "(" + pointers + ", const size_t l);"
+                + "\n            void " + name + "(Parallel, " + vectors + ");"
+                + "\n            void " + name + "(Parallel, " + pointers + ", const size_t l);"
+                + "\n            void " + name + "(" + alignedVectors + ");"
+                + "\n            void " + name + "(Parallel, " + alignedVectors + ");"
+                + "\n        #pragma endregion // " + numName
+                + numEndif(_numType)
                 + "\n"
             ;
 
             templ += ""
+                + numIfdef(_numType)
+                + "\n        #pragma region // " + numName
                 + "\n            template <size_t S>"
-                + "\n            void " + opMeta[_opType].name + "(const std::array<" + numMeta[_numType].numName + ", S>& a, const std::array<" + numMeta[_numType].numName + ", S>& b, std::array<" + numMeta[_numType].numName +", S>& c) {"
-                + "\n                " + opMeta[_opType].name + "Backend(a.data(), b.data(), c.data(), S);"
+                + "\n            void " + name + "(" + arrays + ") {"
+                + "\n                dispatch<op::" + tag + ", " + numName + ">()(" + args.map((arg) => arg + ".data()").join(", ") + ", c.data(), S);"
                 + "\n            }"
-                + "\n        #pragma endregion // " + numMeta[_numType].numName 
+                + "\n        #pragma endregion // " + numName
+                + numEndif(_numType)
                 + "\n"
             ;
         }
 
         source += ""
-            + "    #pragma endregion // " + opMeta[_opType].name
+            + "    #pragma endregion // " + name
         ;
 
         header += ""
             + "        "
-            + "\n        #define " + opMeta[_opType].capsName + "(a, b, c) " + opMeta[_opType].name + "(a, b, c, ezsimd::arrayLength(a))"
-            + "\n    #pragma endregion // " + opMeta[_opType].name
+            + "\n        #define " + meta.capsName + "(" + args.join(", ") + ", c) " + name + "(" + args.join(", ") + ", c, ezsimd::arrayLength(a))"
+            + "\n    #pragma endregion // " + name
         ;
 
         templ += ""
-            + "    #pragma endregion // " + opMeta[_opType].name
+            + "    #pragma endregion // " + name
         ;
     }
 
+    source += `
+    
+    #ifdef EZSIMD_STATS
+        struct BackendName {
+            const char* op;
+            const char* type;
+            Tier tier;
+        };
+        
+        // op tag, element type, and instruction set of each backend, at the id it counts its calls under
+        inline const BackendName backendNames[] = {`
+        + statsEntries.map((entry) => "\n            {\"" + entry.tag + "\", \"" + entry.numName + "\", Tier::" + entry.tier + "},").join("")
+        + `
+        };
+        
+        inline size_t backendCount() {
+            return sizeof(backendNames) / sizeof(backendNames[0]);
+        }
+        
+        std::vector<Stat> stats() {
+            StatsRegistry& registry = statsRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            const Counts totals = totalCounts(registry);
+            std::vector<Stat> result;
+            
+            for (size_t id = 0; id < totals.size(); id++) {
+                if (totals[id][0] != registry.baseline[id][0]) {
+                    const BackendName& name = backendNames[id];
+                    result.push_back({name.op, name.type, name.tier, totals[id][0] - registry.baseline[id][0],
+                        totals[id][1] - registry.baseline[id][1], totals[id][2] - registry.baseline[id][2]});
+                }
+            }
+            
+            return result;
+        }
+        
+        void resetStats() {
+            StatsRegistry& registry = statsRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.baseline = totalCounts(registry);
+        }
+    #else
+        std::vector<Stat> stats() {
+            return {};
+        }
+        
+        void resetStats() {}
+    #endif // EZSIMD_STATS`;
+
     source += "\n} // namespace ezsimd";
     header += ""
         + "\n} // namespace ezsimd"
@@ -284,6 +2695,281 @@ namespace ezsimd {
         + "\n#include \"libezsimd.tpp\" // full definitions for templates declared in this file only"
         + "\n// templates declared in ezsimd.hpp are simply defined in ezsimd.hpp"
     ;
+    templ += `
+    
+    #pragma region // aligned_allocator
+        template <typename T, size_t Align>
+        template <typename U>
+        aligned_allocator<T, Align>::aligned_allocator(const aligned_allocator<U, Align>&) noexcept {}
+        
+        template <typename T, size_t Align>
+        T* aligned_allocator<T, Align>::allocate(const size_t n) {
+            if (n > (SIZE_MAX - alignment) / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            
+            const size_t bytes = (n * sizeof(T) + alignment - 1) / alignment * alignment;
+            return static_cast<T*>(::operator new(bytes, std::align_val_t(alignment)));
+        }
+        
+        template <typename T, size_t Align>
+        void aligned_allocator<T, Align>::deallocate(T* ptr, size_t) noexcept {
+            ::operator delete(ptr, std::align_val_t(alignment));
+        }
+        
+        template <typename T, size_t Align>
+        template <typename U>
+        bool aligned_allocator<T, Align>::operator==(const aligned_allocator<U, Align>&) const noexcept {
+            return true;
+        }
+        
+        template <typename T, size_t Align>
+        template <typename U>
+        bool aligned_allocator<T, Align>::operator!=(const aligned_allocator<U, Align>&) const noexcept {
+            return false;
+        }
+    #pragma endregion // aligned_allocator
+    
+    #pragma region // scratch
+        template <typename T>
+        T* Scratch::allocate(const size_t n) {
+            static_assert(alignof(T) <= simdAlignment, "Scratch can't align T");
+            
+            if (n > SIZE_MAX / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            
+            return static_cast<T*>(allocateBytes(n * sizeof(T)));
+        }
+        
+        template <typename T>
+        T* ScratchScope::allocate(const size_t n) {
+            return arena.allocate<T>(n);
+        }
+    #pragma endregion // scratch`;
+
+    // lazy expressions, evaluated with the Fixed specializations of each op
+    templ += `
+    
+    #pragma region // expressions
+        // an array in an expression, read one vector at a time
+        template <typename T>
+        struct ExprArray {
+            using type = T;
+            const T* data;
+            size_t size;
+        };
+        
+        // a single value in an expression, applied to every element like the broadcast overloads
+        template <typename T>
+        struct ExprValue {
+            using type = T;
+            T value;
+        };
+        
+        // a op b on every element, a and b are ExprArray, ExprValue, or other ExprNodes of the same type
+        template <typename Op, typename A, typename B>
+        struct ExprNode {
+            using type = typename A::type;
+            A a;
+            B b;
+        };
+        
+        template <typename E>
+        struct IsExpr : std::false_type {};
+        
+        template <typename T>
+        struct IsExpr<ExprArray<T>> : std::true_type {};
+        
+        template <typename Op, typename A, typename B>
+        struct IsExpr<ExprNode<Op, A, B>> : std::true_type {};
+        
+        template <typename T, typename Alloc>
+        ExprArray<T> expr(const std::vector<T, Alloc>& a) {
+            return {a.data(), a.size()};
+        }
+        
+        template <typename T, size_t S>
+        ExprArray<T> expr(const std::array<T, S>& a) {
+            return {a.data(), S};
+        }
+        
+        template <typename T>
+        ExprArray<T> expr(const T* a, const size_t l) {
+            return {a, l};
+        }
+        
+        // the other operand of + - * / as an expression of element type T
+        template <typename T>
+        inline ExprArray<T> exprOperand(const ExprArray<T>& e) {
+            return e;
+        }
+        
+        template <typename T, typename Op, typename A, typename B>
+        inline ExprNode<Op, A, B> exprOperand(const ExprNode<Op, A, B>& e) {
+            static_assert(std::is_same<T, typename A::type>::value, "every array in an expression must have the same element type");
+            return e;
+        }
+        
+        template <typename T, typename Alloc>
+        inline ExprArray<T> exprOperand(const std::vector<T, Alloc>& a) {
+            return {a.data(), a.size()};
+        }
+        
+        template <typename T, size_t S>
+        inline ExprArray<T> exprOperand(const std::array<T, S>& a) {
+            return {a.data(), S};
+        }
+        
+        template <typename T, typename V, typename = typename std::enable_if<std::is_convertible<V, T>::value>::type>
+        inline ExprValue<T> exprOperand(const V& value) {
+            return {static_cast<T>(value)};
+        }
+        
+        template <typename Op, typename A, typename B>
+        inline auto exprCombine(const A& a, const B& b) {
+            using T = typename std::conditional<IsExpr<A>::value, A, B>::type::type;
+            return ExprNode<Op, decltype(exprOperand<T>(a)), decltype(exprOperand<T>(b))>{exprOperand<T>(a), exprOperand<T>(b)};
+        }
+        
+        // only when one side is already an expression, so + - * / on plain vectors and numbers are left alone
+        template <typename A, typename B, typename = typename std::enable_if<IsExpr<A>::value || IsExpr<B>::value>::type>
+        inline auto operator+(const A& a, const B& b) {
+            return exprCombine<op::Add>(a, b);
+        }
+        
+        template <typename A, typename B, typename = typename std::enable_if<IsExpr<A>::value || IsExpr<B>::value>::type>
+        inline auto operator-(const A& a, const B& b) {
+            return exprCombine<op::Sub>(a, b);
+        }
+        
+        template <typename A, typename B, typename = typename std::enable_if<IsExpr<A>::value || IsExpr<B>::value>::type>
+        inline auto operator*(const A& a, const B& b) {
+            return exprCombine<op::Mul>(a, b);
+        }
+        
+        template <typename A, typename B, typename = typename std::enable_if<IsExpr<A>::value || IsExpr<B>::value>::type>
+        inline auto operator/(const A& a, const B& b) {
+            return exprCombine<op::Div>(a, b);
+        }
+        
+        // element count of an expression, SIZE_MAX for a single value
+        template <typename T>
+        inline size_t exprSize(const ExprArray<T>& e) {
+            return e.size;
+        }
+        
+        template <typename T>
+        inline size_t exprSize(const ExprValue<T>&) {
+            return SIZE_MAX;
+        }
+        
+        template <typename Op, typename A, typename B>
+        inline size_t exprSize(const ExprNode<Op, A, B>& e) {
+            const size_t a = exprSize(e.a);
+            const size_t b = exprSize(e.b);
+            assert(a == b || a == SIZE_MAX || b == SIZE_MAX);
+            return std::min(a, b);
+        }
+        
+        // lanes every op of E has on Isa, 0 if one of them has no Fixed specialization there, SIZE_MAX for arrays and values
+        template <typename Isa, typename E>
+        struct ExprLanes {
+            static constexpr size_t value = SIZE_MAX;
+        };
+        
+        template <typename Isa, typename Op, typename A, typename B>
+        struct ExprLanes<Isa, ExprNode<Op, A, B>> {
+            static constexpr size_t lanes = Fixed<Isa, Op, typename A::type>::lanes;
+            static constexpr size_t a = ExprLanes<Isa, A>::value;
+            static constexpr size_t b = ExprLanes<Isa, B>::value;
+            static constexpr size_t value = lanes != 0 && (a == SIZE_MAX || a == lanes) && (b == SIZE_MAX || b == lanes) ? lanes : 0;
+        };
+        
+        // one vector of the expression at element i, F is the Fixed specialization of the op using it
+        template <typename Isa, typename F, typename T>
+        inline auto exprVector(const ExprArray<T>& e, const size_t i) {
+            return F::load(e.data + i);
+        }
+        
+        template <typename Isa, typename F, typename T>
+        inline auto exprVector(const ExprValue<T>& e, size_t) {
+            return F::set1(e.value);
+        }
+        
+        template <typename Isa, typename F, typename Op, typename A, typename B>
+        inline auto exprVector(const ExprNode<Op, A, B>& e, const size_t i) {
+            using G = Fixed<Isa, Op, typename A::type>;
+            return G::apply(exprVector<Isa, G>(e.a, i), exprVector<Isa, G>(e.b, i));
+        }
+        
+        template <typename T>
+        inline T exprElement(const ExprArray<T>& e, const size_t i) {
+            return e.data[i];
+        }
+        
+        template <typename T>
+        inline T exprElement(const ExprValue<T>& e, size_t) {
+            return e.value;
+        }
+        
+        template <typename Op, typename A, typename B>
+        inline typename A::type exprElement(const ExprNode<Op, A, B>& e, const size_t i) {
+            return Fixed<void, Op, typename A::type>::apply(exprElement(e.a, i), exprElement(e.b, i));
+        }
+        
+        // c[0, l) = e with whole Isa vectors, then the scalar ops for what's left, void is all scalar
+        template <typename Isa, typename Op, typename A, typename B, typename T>
+        inline void exprKernel(const ExprNode<Op, A, B>& e, T* c, const size_t l) {
+            size_t i = 0;
+            
+            if constexpr (!std::is_void<Isa>::value) {
+                using F = Fixed<Isa, Op, T>;
+                for (; i + F::lanes <= l; i += F::lanes) {
+                    F::store(c + i, exprVector<Isa, F>(e, i));
+                }
+            }
+            
+            for (; i < l; i++) {
+                c[i] = exprElement(e, i);
+            }
+        }
+        
+        // the widest instruction set that has every op in e, that this CPU supports, and that maxIsa() allows, starting from Isa
+        template <typename Isa, typename Op, typename A, typename B, typename T>
+        void exprDispatch(const ExprNode<Op, A, B>& e, T* c, const size_t l) {
+            if constexpr (std::is_void<Isa>::value) {
+                exprKernel<void>(e, c, l);
+            } else {
+                if constexpr (ExprLanes<Isa, ExprNode<Op, A, B>>::value != 0) {
+                    if (Isa::tier <= maxIsa() && cpuSupports(Isa::tier)) {
+                        exprKernel<Isa>(e, c, l);
+                        return;
+                    }
+                }
+                
+                exprDispatch<typename NarrowerIsa<Isa>::type>(e, c, l);
+            }
+        }
+        
+        template <typename Op, typename A, typename B>
+        void eval(const ExprNode<Op, A, B>& e, typename A::type* c) {
+            exprDispatch<isa::${fixedTiers[0]}>(e, c, exprSize(e));
+        }
+        
+        template <typename Op, typename A, typename B, typename Alloc>
+        void eval(const ExprNode<Op, A, B>& e, std::vector<typename A::type, Alloc>& c) {
+            assert(c.size() >= exprSize(e));
+            exprDispatch<isa::${fixedTiers[0]}>(e, c.data(), exprSize(e));
+        }
+        
+        template <typename Op, typename A, typename B, size_t S>
+        void eval(const ExprNode<Op, A, B>& e, std::array<typename A::type, S>& c) {
+            assert(S >= exprSize(e));
+            exprDispatch<isa::${fixedTiers[0]}>(e, c.data(), exprSize(e));
+        }
+    #pragma endregion // expressions`;
+
     templ += "\n} // namespace ezsimd";
 
     fs.writeFile(sourcePath, source, (err) => {
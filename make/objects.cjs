@@ -35,7 +35,34 @@ const simdRegTypenames = {
         UINT32: "__m256i",
         UINT64: "__m256i",
     },
-}; // simdRegTypenames
+    FMA: {
+        FLOAT32: "__m256",
+        FLOAT64: "__m256d",
+    },
+    F16C: {
+        FLOAT16: "__m256",
+        BFLOAT16: "__m256",
+        FLOAT32: "__m256", // only for widening half-precision to float, float arithmetic has its own tiers
+    },
+    AVX512: {
+        INT8: "__m512i",
+        INT16: "__m512i",
+        INT32: "__m512i",
+        INT64: "__m512i",
+        UINT8: "__m512i",
+        UINT16: "__m512i",
+        UINT32: "__m512i",
+        UINT64: "__m512i",
+        FLOAT32: "__m512",
+        FLOAT64: "__m512d",
+    },
+    AVX512BF16: {
+        BFLOAT16: "__m512",
+    },
+    AVX512FP16: {
+        FLOAT16: "__m512h",
+    },
+}; // simdRegTypenames, F16C and AVX512BF16 widen half-precision lanes to float
 
 const supportedOps = {
     MMX: {
@@ -51,6 +78,7 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: false,
             FLOAT128: false,
@@ -67,10 +95,45 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: false,
             FLOAT128: false,
         }, // SUB
+        ADDS: {
+            INT8: true,
+            INT16: true,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADDS
+        SUBS: {
+            INT8: true,
+            INT16: true,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUBS
         MUL: {
             INT8: false,
             INT16: true,
@@ -83,6 +146,7 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: false,
             FLOAT128: false,
@@ -99,10 +163,62 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: false,
             FLOAT128: false,
         }, // DIV
+        FMA: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // FMA
+        MIN: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MIN
+        MAX: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MAX
     }, // MMX
     SSE: {
         ADD: {
@@ -117,6 +233,7 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: true,
             FLOAT64: false,
             FLOAT128: false,
@@ -133,10 +250,45 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: true,
             FLOAT64: false,
             FLOAT128: false,
         }, // SUB
+        ADDS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADDS
+        SUBS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUBS
         MUL: {
             INT8: false,
             INT16: false,
@@ -149,6 +301,7 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: true,
             FLOAT64: false,
             FLOAT128: false,
@@ -165,10 +318,62 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: true,
             FLOAT64: false,
             FLOAT128: false,
         }, // DIV
+        FMA: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // FMA
+        MIN: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MIN
+        MAX: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MAX
     }, // SSE
     SSE2: {
         ADD: {
@@ -183,6 +388,7 @@ const supportedOps = {
             UINT64: true,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: true,
             FLOAT128: false,
@@ -199,42 +405,130 @@ const supportedOps = {
             UINT64: true,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: true,
             FLOAT128: false,
         }, // SUB
-        MUL: {
-            INT8: false,
+        ADDS: {
+            INT8: true,
             INT16: true,
             INT32: false,
             INT64: false,
             INT128: false,
-            UINT8: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADDS
+        SUBS: {
+            INT8: true,
+            INT16: true,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
             UINT16: true,
             UINT32: false,
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUBS
+        MUL: {
+            INT8: true,
+            INT16: true,
+            INT32: false,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: false,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: true,
             FLOAT128: false,
         }, // MUL
         DIV: {
-            INT8: false,
-            INT16: false,
-            INT32: false,
+            INT8: true,
+            INT16: true,
+            INT32: true,
             INT64: false,
             INT128: false,
-            UINT8: false,
-            UINT16: false,
-            UINT32: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: true,
             FLOAT128: false,
         }, // DIV
+        FMA: {
+            INT8: true,
+            INT16: true,
+            INT32: false,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: false,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // FMA
+        MIN: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // MIN
+        MAX: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // MAX
     }, // SSE2
     AVX: {
         ADD: {
@@ -249,6 +543,7 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: true,
             FLOAT64: true,
             FLOAT128: false,
@@ -265,11 +560,12 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
+            BFLOAT16: false,
             FLOAT32: true,
             FLOAT64: true,
             FLOAT128: false,
         }, // SUB
-        MUL: {
+        ADDS: {
             INT8: false,
             INT16: false,
             INT32: false,
@@ -281,11 +577,12 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
-            FLOAT32: true,
-            FLOAT64: true,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
             FLOAT128: false,
-        }, // MUL
-        DIV: {
+        }, // ADDS
+        SUBS: {
             INT8: false,
             INT16: false,
             INT32: false,
@@ -297,61 +594,1010 @@ const supportedOps = {
             UINT64: false,
             UINT128: false,
             FLOAT16: false,
-            FLOAT32: true,
-            FLOAT64: true,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
             FLOAT128: false,
-        }, // DIV
-    }, // AVX
-    AVX2: {
-        ADD: {
-            INT8: true,
-            INT16: true,
-            INT32: true,
-            INT64: true,
-            INT128: false,
-            UINT8: true,
+        }, // SUBS
+        MUL: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // MUL
+        DIV: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // DIV
+        FMA: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // FMA
+        MIN: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // MIN
+        MAX: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // MAX
+    }, // AVX
+    AVX2: {
+        ADD: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADD
+        SUB: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUB
+        ADDS: {
+            INT8: true,
+            INT16: true,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADDS
+        SUBS: {
+            INT8: true,
+            INT16: true,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUBS
+        MUL: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MUL
+        DIV: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // DIV
+        FMA: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // FMA
+        MIN: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MIN
+        MAX: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MAX
+    }, // AVX2
+    FMA: {
+        ADD: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADD
+        SUB: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUB
+        ADDS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADDS
+        SUBS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUBS
+        MUL: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MUL
+        DIV: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // DIV
+        FMA: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // FMA
+        MIN: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MIN
+        MAX: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MAX
+    }, // FMA
+    F16C: {
+        ADD: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADD
+        SUB: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUB
+        ADDS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADDS
+        SUBS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUBS
+        MUL: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MUL
+        DIV: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // DIV
+        FMA: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // FMA
+        MIN: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MIN
+        MAX: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MAX
+    }, // F16C
+    AVX512: {
+        ADD: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // ADD
+        SUB: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // SUB
+        ADDS: {
+            INT8: true,
+            INT16: true,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADDS
+        SUBS: {
+            INT8: true,
+            INT16: true,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUBS
+        MUL: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // MUL
+        DIV: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: false,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // DIV
+        FMA: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // FMA
+        MIN: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
+            UINT16: true,
+            UINT32: true,
+            UINT64: true,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // MIN
+        MAX: {
+            INT8: true,
+            INT16: true,
+            INT32: true,
+            INT64: true,
+            INT128: false,
+            UINT8: true,
             UINT16: true,
             UINT32: true,
             UINT64: true,
             UINT128: false,
-            FLOAT16: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: true,
+            FLOAT64: true,
+            FLOAT128: false,
+        }, // MAX
+    }, // AVX512
+    AVX512BF16: {
+        ADD: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADD
+        SUB: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUB
+        ADDS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADDS
+        SUBS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUBS
+        MUL: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MUL
+        DIV: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // DIV
+        FMA: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // FMA
+        MIN: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MIN
+        MAX: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: true,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MAX
+    }, // AVX512BF16
+    AVX512FP16: {
+        ADD: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADD
+        SUB: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUB
+        ADDS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // ADDS
+        SUBS: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: false,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // SUBS
+        MUL: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: false,
+            FLOAT32: false,
+            FLOAT64: false,
+            FLOAT128: false,
+        }, // MUL
+        DIV: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
+            INT128: false,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
+            UINT128: false,
+            FLOAT16: true,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: false,
             FLOAT128: false,
-        }, // ADD
-        SUB: {
-            INT8: true,
-            INT16: true,
-            INT32: true,
-            INT64: true,
+        }, // DIV
+        FMA: {
+            INT8: false,
+            INT16: false,
+            INT32: false,
+            INT64: false,
             INT128: false,
-            UINT8: true,
-            UINT16: true,
-            UINT32: true,
-            UINT64: true,
+            UINT8: false,
+            UINT16: false,
+            UINT32: false,
+            UINT64: false,
             UINT128: false,
-            FLOAT16: false,
+            FLOAT16: true,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: false,
             FLOAT128: false,
-        }, // SUB
-        MUL: {
+        }, // FMA
+        MIN: {
             INT8: false,
-            INT16: true,
-            INT32: true,
+            INT16: false,
+            INT32: false,
             INT64: false,
             INT128: false,
             UINT8: false,
-            UINT16: true,
-            UINT32: true,
+            UINT16: false,
+            UINT32: false,
             UINT64: false,
             UINT128: false,
-            FLOAT16: false,
+            FLOAT16: true,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: false,
             FLOAT128: false,
-        }, // MUL
-        DIV: {
+        }, // MIN
+        MAX: {
             INT8: false,
             INT16: false,
             INT32: false,
@@ -362,12 +1608,13 @@ const supportedOps = {
             UINT32: false,
             UINT64: false,
             UINT128: false,
-            FLOAT16: false,
+            FLOAT16: true,
+            BFLOAT16: false,
             FLOAT32: false,
             FLOAT64: false,
             FLOAT128: false,
-        }, // DIV
-    }, // AVX2
+        }, // MAX
+    }, // AVX512FP16
 }; // supportedOps
 
 const functions = {
@@ -388,6 +1635,22 @@ const functions = {
             UINT16: "[](const uint16_t* ptr) {uint64_t temp; std::memcpy(&temp, ptr, sizeof(temp)); return *reinterpret_cast<__m64*>(&temp);}",
             UINT32: "[](const uint32_t* ptr) {uint64_t temp; std::memcpy(&temp, ptr, sizeof(temp)); return *reinterpret_cast<__m64*>(&temp);}",
         },
+        SET_ZERO: {
+            INT8: "_mm_setzero_si64",
+            INT16: "_mm_setzero_si64",
+            INT32: "_mm_setzero_si64",
+            UINT8: "_mm_setzero_si64",
+            UINT16: "_mm_setzero_si64",
+            UINT32: "_mm_setzero_si64",
+        },
+        SET1: {
+            INT8: "_mm_set1_pi8",
+            INT16: "_mm_set1_pi16",
+            INT32: "_mm_set1_pi32",
+            UINT8: "_mm_set1_pi8",
+            UINT16: "_mm_set1_pi16",
+            UINT32: "_mm_set1_pi32",
+        },
         ADD: {
             INT8: "_mm_add_pi8",
             INT16: "_mm_add_pi16",
@@ -404,6 +1667,18 @@ const functions = {
             UINT16: "_mm_sub_pi16",
             UINT32: "_mm_sub_pi32",
         },
+        ADDS: {
+            INT8: "_mm_adds_pi8",
+            INT16: "_mm_adds_pi16",
+            UINT8: "_mm_adds_pu8",
+            UINT16: "_mm_adds_pu16",
+        },
+        SUBS: {
+            INT8: "_mm_subs_pi8",
+            INT16: "_mm_subs_pi16",
+            UINT8: "_mm_subs_pu8",
+            UINT16: "_mm_subs_pu16",
+        },
         MUL: {
             INT16: "_mm_mullo_pi16",
             UINT16: "_mm_mullo_pi16",
@@ -411,6 +1686,15 @@ const functions = {
         DIV: {
             // no support
         },
+        FMA: {
+            // no support
+        },
+        MIN: {
+            // no support
+        },
+        MAX: {
+            // no support
+        },
         UNPACK_ALIGNED: {
             INT8: "[](int8_t *ptr, const __m64 vec) {*reinterpret_cast<__m64*>(ptr) = vec;}",
             INT16: "[](int16_t *ptr, const __m64 vec) {*reinterpret_cast<__m64*>(ptr) = vec;}",
@@ -435,6 +1719,12 @@ const functions = {
         PACK_UNALIGNED: {
             FLOAT32: "_mm_loadu_ps",
         },
+        SET_ZERO: {
+            FLOAT32: "_mm_setzero_ps",
+        },
+        SET1: {
+            FLOAT32: "_mm_set1_ps",
+        },
         ADD: {
             FLOAT32: "_mm_add_ps",
         },
@@ -447,12 +1737,24 @@ const functions = {
         DIV: {
             FLOAT32: "_mm_div_ps",
         },
+        FMA: {
+            // no support
+        },
+        MIN: {
+            FLOAT32: "_mm_min_ps",
+        },
+        MAX: {
+            FLOAT32: "_mm_max_ps",
+        },
         UNPACK_ALIGNED: {
             FLOAT32: "_mm_store_ps",
         },
         UNPACK_UNALIGNED: {
             FLOAT32: "_mm_storeu_ps",
         },
+        UNPACK_STREAM: {
+            FLOAT32: "_mm_stream_ps",
+        },
     },
     SSE2: { // revisit integer support for SSE versions, might have to add SSE3 section or something
         PACK_ALIGNED: {
@@ -477,6 +1779,28 @@ const functions = {
             UINT64: "[](const uint64_t* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}",
             FLOAT64: "_mm_loadu_pd",
         },
+        SET_ZERO: {
+            INT8: "_mm_setzero_si128",
+            INT16: "_mm_setzero_si128",
+            INT32: "_mm_setzero_si128",
+            INT64: "_mm_setzero_si128",
+            UINT8: "_mm_setzero_si128",
+            UINT16: "_mm_setzero_si128",
+            UINT32: "_mm_setzero_si128",
+            UINT64: "_mm_setzero_si128",
+            FLOAT64: "_mm_setzero_pd",
+        },
+        SET1: {
+            INT8: "_mm_set1_epi8",
+            INT16: "_mm_set1_epi16",
+            INT32: "_mm_set1_epi32",
+            INT64: "_mm_set1_epi64x",
+            UINT8: "_mm_set1_epi8",
+            UINT16: "_mm_set1_epi16",
+            UINT32: "_mm_set1_epi32",
+            UINT64: "_mm_set1_epi64x",
+            FLOAT64: "_mm_set1_pd",
+        },
         ADD: {
             INT8: "_mm_add_epi8",
             INT16: "_mm_add_epi16",
@@ -499,14 +1823,78 @@ const functions = {
             UINT64: "_mm_sub_epi64",
             FLOAT64: "_mm_sub_pd",
         },
+        ADDS: {
+            INT8: "_mm_adds_epi8",
+            INT16: "_mm_adds_epi16",
+            UINT8: "_mm_adds_epu8",
+            UINT16: "_mm_adds_epu16",
+        },
+        SUBS: {
+            INT8: "_mm_subs_epi8",
+            INT16: "_mm_subs_epi16",
+            UINT8: "_mm_subs_epu8",
+            UINT16: "_mm_subs_epu16",
+        },
         MUL: {
+            INT8: "[](const __m128i a, const __m128i b) {const __m128i even = _mm_mullo_epi16(a, b); const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)); return _mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xFF)));}",
             INT16: "_mm_mullo_epi16",
+            INT64: "[](const __m128i a, const __m128i b) {const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32))); return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));}",
+            UINT8: "[](const __m128i a, const __m128i b) {const __m128i even = _mm_mullo_epi16(a, b); const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)); return _mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xFF)));}",
             UINT16: "_mm_mullo_epi16",
+            UINT64: "[](const __m128i a, const __m128i b) {const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32))); return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));}",
             FLOAT64: "_mm_mul_pd",
         },
         DIV: {
+            INT8: "divInt8SSE2",
+            INT16: "divInt16SSE2",
+            INT32: "divInt32SSE2",
+            UINT8: "divUint8SSE2",
+            UINT16: "divUint16SSE2",
+            UINT32: "divUint32SSE2",
             FLOAT64: "_mm_div_pd",
         },
+        DIVISOR: {
+            INT8: "divisorInt8SSE2",
+            INT16: "divisorInt16SSE2",
+            INT32: "divisorInt32SSE2",
+            UINT8: "divisorUint8SSE2",
+            UINT16: "divisorUint16SSE2",
+            UINT32: "divisorUint32SSE2",
+        },
+        DIV_BY: {
+            INT8: "divByInt8SSE2",
+            INT16: "divByInt16SSE2",
+            INT32: "divByInt32SSE2",
+            UINT8: "divByUint8SSE2",
+            UINT16: "divByUint16SSE2",
+            UINT32: "divByUint32SSE2",
+        },
+        FMA: {
+            INT8: "[](const __m128i a, const __m128i b, const __m128i c) {const __m128i even = _mm_mullo_epi16(a, b); const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)); return _mm_add_epi8(_mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xFF))), c);}",
+            INT16: "[](const __m128i a, const __m128i b, const __m128i c) {return _mm_add_epi16(_mm_mullo_epi16(a, b), c);}",
+            INT64: "[](const __m128i a, const __m128i b, const __m128i c) {const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32))); return _mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32)), c);}",
+            UINT8: "[](const __m128i a, const __m128i b, const __m128i c) {const __m128i even = _mm_mullo_epi16(a, b); const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)); return _mm_add_epi8(_mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xFF))), c);}",
+            UINT16: "[](const __m128i a, const __m128i b, const __m128i c) {return _mm_add_epi16(_mm_mullo_epi16(a, b), c);}",
+            UINT64: "[](const __m128i a, const __m128i b, const __m128i c) {const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32))); return _mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32)), c);}",
+        },
+        MIN: {
+            INT8: "[](const __m128i a, const __m128i b) {const __m128i gt = _mm_cmpgt_epi8(a, b); return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));}",
+            INT16: "_mm_min_epi16",
+            INT32: "[](const __m128i a, const __m128i b) {const __m128i gt = _mm_cmpgt_epi32(a, b); return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));}",
+            UINT8: "_mm_min_epu8",
+            UINT16: "[](const __m128i a, const __m128i b) {return _mm_sub_epi16(a, _mm_subs_epu16(a, b));}",
+            UINT32: "[](const __m128i a, const __m128i b) {const __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(a, _mm_set1_epi32(INT32_MIN)), _mm_xor_si128(b, _mm_set1_epi32(INT32_MIN))); return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));}",
+            FLOAT64: "_mm_min_pd",
+        },
+        MAX: {
+            INT8: "[](const __m128i a, const __m128i b) {const __m128i gt = _mm_cmpgt_epi8(a, b); return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));}",
+            INT16: "_mm_max_epi16",
+            INT32: "[](const __m128i a, const __m128i b) {const __m128i gt = _mm_cmpgt_epi32(a, b); return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));}",
+            UINT8: "_mm_max_epu8",
+            UINT16: "[](const __m128i a, const __m128i b) {return _mm_add_epi16(b, _mm_subs_epu16(a, b));}",
+            UINT32: "[](const __m128i a, const __m128i b) {const __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(a, _mm_set1_epi32(INT32_MIN)), _mm_xor_si128(b, _mm_set1_epi32(INT32_MIN))); return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));}",
+            FLOAT64: "_mm_max_pd",
+        },
         UNPACK_ALIGNED: {
             INT8: "[](int8_t* ptr, const __m128i vec) {_mm_store_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
             INT16: "[](int16_t* ptr, const __m128i vec) {_mm_store_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
@@ -529,6 +1917,40 @@ const functions = {
             UINT64: "[](uint64_t* ptr, const __m128i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
             FLOAT64: "_mm_storeu_pd",
         },
+        UNPACK_STREAM: {
+            INT8: "[](int8_t* ptr, const __m128i vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
+            INT16: "[](int16_t* ptr, const __m128i vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
+            INT32: "[](int32_t* ptr, const __m128i vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
+            INT64: "[](int64_t* ptr, const __m128i vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
+            UINT8: "[](uint8_t* ptr, const __m128i vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
+            UINT16: "[](uint16_t* ptr, const __m128i vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
+            UINT32: "[](uint32_t* ptr, const __m128i vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
+            UINT64: "[](uint64_t* ptr, const __m128i vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), vec);}",
+            FLOAT64: "_mm_stream_pd",
+        },
+        WIDEN: {
+            INT8: "[](const int8_t* ptr) {const __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)); return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);}",
+            INT16: "[](const int16_t* ptr) {const __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)); return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);}",
+            INT32: "[](const int32_t* ptr) {const __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)); return _mm_unpacklo_epi32(x, _mm_srai_epi32(x, 31));}",
+            UINT8: "[](const uint8_t* ptr) {return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)), _mm_setzero_si128());}",
+            UINT16: "[](const uint16_t* ptr) {return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)), _mm_setzero_si128());}",
+            UINT32: "[](const uint32_t* ptr) {return _mm_unpacklo_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)), _mm_setzero_si128());}",
+            FLOAT32: "[](const float* ptr) {return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr))));}",
+        },
+        NARROW: {
+            INT8: "[](int8_t* ptr, const __m128i vec) {_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_packus_epi16(_mm_and_si128(vec, _mm_set1_epi16(0xFF)), vec));}",
+            INT16: "[](int16_t* ptr, const __m128i vec) {_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(vec, 16), 16), vec));}",
+            INT32: "[](int32_t* ptr, const __m128i vec) {_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_shuffle_epi32(vec, 0x08));}",
+            UINT8: "[](uint8_t* ptr, const __m128i vec) {_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_packus_epi16(_mm_and_si128(vec, _mm_set1_epi16(0xFF)), vec));}",
+            UINT16: "[](uint16_t* ptr, const __m128i vec) {_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(vec, 16), 16), vec));}",
+            UINT32: "[](uint32_t* ptr, const __m128i vec) {_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_shuffle_epi32(vec, 0x08));}",
+            FLOAT32: "[](float* ptr, const __m128d vec) {_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), _mm_castps_si128(_mm_cvtpd_ps(vec)));}",
+        },
+        MUL_WIDEN: {
+            INT16: "[](const __m128i a, const __m128i b) {return _mm_madd_epi16(a, _mm_and_si128(b, _mm_set1_epi32(0xFFFF)));}",
+            UINT16: "[](const __m128i a, const __m128i b) {return _mm_or_si128(_mm_mullo_epi16(a, b), _mm_slli_epi32(_mm_mulhi_epu16(a, b), 16));}",
+            UINT32: "_mm_mul_epu32",
+        },
     },
     AVX: {
         PACK_ALIGNED: {
@@ -539,6 +1961,14 @@ const functions = {
             FLOAT32: "_mm256_loadu_ps",
             FLOAT64: "_mm256_loadu_pd",
         },
+        SET_ZERO: {
+            FLOAT32: "_mm256_setzero_ps",
+            FLOAT64: "_mm256_setzero_pd",
+        },
+        SET1: {
+            FLOAT32: "_mm256_set1_ps",
+            FLOAT64: "_mm256_set1_pd",
+        },
         ADD: {
             FLOAT32: "_mm256_add_ps",
             FLOAT64: "_mm256_add_pd",
@@ -555,6 +1985,17 @@ const functions = {
             FLOAT32: "_mm256_div_ps",
             FLOAT64: "_mm256_div_pd",
         },
+        FMA: {
+            // no support
+        },
+        MIN: {
+            FLOAT32: "_mm256_min_ps",
+            FLOAT64: "_mm256_min_pd",
+        },
+        MAX: {
+            FLOAT32: "_mm256_max_ps",
+            FLOAT64: "_mm256_max_pd",
+        },
         UNPACK_ALIGNED: {
             FLOAT32: "_mm256_store_ps",
             FLOAT64: "_mm256_store_pd",
@@ -563,6 +2004,24 @@ const functions = {
             FLOAT32: "_mm256_storeu_ps",
             FLOAT64: "_mm256_storeu_pd",
         },
+        UNPACK_STREAM: {
+            FLOAT32: "_mm256_stream_ps",
+            FLOAT64: "_mm256_stream_pd",
+        },
+        PACK_MASKED: {
+            FLOAT32: "[](const float* ptr, const size_t n) {return _mm256_maskload_ps(ptr, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - n)));}",
+            FLOAT64: "[](const double* ptr, const size_t n) {return _mm256_maskload_pd(ptr, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - 2 * n)));}",
+        },
+        UNPACK_MASKED: {
+            FLOAT32: "[](float* ptr, const __m256 vec, const size_t n) {_mm256_maskstore_ps(ptr, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - n)), vec);}",
+            FLOAT64: "[](double* ptr, const __m256d vec, const size_t n) {_mm256_maskstore_pd(ptr, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - 2 * n)), vec);}",
+        },
+        WIDEN: {
+            FLOAT32: "[](const float* ptr) {return _mm256_cvtps_pd(_mm_loadu_ps(ptr));}",
+        },
+        NARROW: {
+            FLOAT32: "[](float* ptr, const __m256d vec) {_mm_storeu_ps(ptr, _mm256_cvtpd_ps(vec));}",
+        },
     },
     AVX2: {
         PACK_ALIGNED: {
@@ -585,6 +2044,26 @@ const functions = {
             UINT32: "[](const uint32_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}",
             UINT64: "[](const uint64_t* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}",
         },
+        SET_ZERO: {
+            INT8: "_mm256_setzero_si256",
+            INT16: "_mm256_setzero_si256",
+            INT32: "_mm256_setzero_si256",
+            INT64: "_mm256_setzero_si256",
+            UINT8: "_mm256_setzero_si256",
+            UINT16: "_mm256_setzero_si256",
+            UINT32: "_mm256_setzero_si256",
+            UINT64: "_mm256_setzero_si256",
+        },
+        SET1: {
+            INT8: "_mm256_set1_epi8",
+            INT16: "_mm256_set1_epi16",
+            INT32: "_mm256_set1_epi32",
+            INT64: "_mm256_set1_epi64x",
+            UINT8: "_mm256_set1_epi8",
+            UINT16: "_mm256_set1_epi16",
+            UINT32: "_mm256_set1_epi32",
+            UINT64: "_mm256_set1_epi64x",
+        },
         ADD: {
             INT8: "_mm256_add_epi8",
             INT16: "_mm256_add_epi16",
@@ -605,14 +2084,81 @@ const functions = {
             UINT32: "_mm256_sub_epi32",
             UINT64: "_mm256_sub_epi64",
         },
+        ADDS: {
+            INT8: "_mm256_adds_epi8",
+            INT16: "_mm256_adds_epi16",
+            UINT8: "_mm256_adds_epu8",
+            UINT16: "_mm256_adds_epu16",
+        },
+        SUBS: {
+            INT8: "_mm256_subs_epi8",
+            INT16: "_mm256_subs_epi16",
+            UINT8: "_mm256_subs_epu8",
+            UINT16: "_mm256_subs_epu16",
+        },
         MUL: {
+            INT8: "[](const __m256i a, const __m256i b) {const __m256i even = _mm256_mullo_epi16(a, b); const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)); return _mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0xFF)));}",
             INT16: "_mm256_mullo_epi16",
             INT32: "_mm256_mullo_epi32",
+            INT64: "[](const __m256i a, const __m256i b) {const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32))); return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));}",
+            UINT8: "[](const __m256i a, const __m256i b) {const __m256i even = _mm256_mullo_epi16(a, b); const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)); return _mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0xFF)));}",
             UINT16: "_mm256_mullo_epi16",
             UINT32: "_mm256_mullo_epi32",
+            UINT64: "[](const __m256i a, const __m256i b) {const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32))); return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));}",
         },
         DIV: {
-            // no support
+            INT8: "divInt8AVX2",
+            INT16: "divInt16AVX2",
+            INT32: "divInt32AVX2",
+            UINT8: "divUint8AVX2",
+            UINT16: "divUint16AVX2",
+            UINT32: "divUint32AVX2",
+        },
+        DIVISOR: {
+            INT8: "divisorInt8AVX2",
+            INT16: "divisorInt16AVX2",
+            INT32: "divisorInt32AVX2",
+            UINT8: "divisorUint8AVX2",
+            UINT16: "divisorUint16AVX2",
+            UINT32: "divisorUint32AVX2",
+        },
+        DIV_BY: {
+            INT8: "divByInt8AVX2",
+            INT16: "divByInt16AVX2",
+            INT32: "divByInt32AVX2",
+            UINT8: "divByUint8AVX2",
+            UINT16: "divByUint16AVX2",
+            UINT32: "divByUint32AVX2",
+        },
+        FMA: {
+            INT8: "[](const __m256i a, const __m256i b, const __m256i c) {const __m256i even = _mm256_mullo_epi16(a, b); const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)); return _mm256_add_epi8(_mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0xFF))), c);}",
+            INT16: "[](const __m256i a, const __m256i b, const __m256i c) {return _mm256_add_epi16(_mm256_mullo_epi16(a, b), c);}",
+            INT32: "[](const __m256i a, const __m256i b, const __m256i c) {return _mm256_add_epi32(_mm256_mullo_epi32(a, b), c);}",
+            INT64: "[](const __m256i a, const __m256i b, const __m256i c) {const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32))); return _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32)), c);}",
+            UINT8: "[](const __m256i a, const __m256i b, const __m256i c) {const __m256i even = _mm256_mullo_epi16(a, b); const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)); return _mm256_add_epi8(_mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0xFF))), c);}",
+            UINT16: "[](const __m256i a, const __m256i b, const __m256i c) {return _mm256_add_epi16(_mm256_mullo_epi16(a, b), c);}",
+            UINT32: "[](const __m256i a, const __m256i b, const __m256i c) {return _mm256_add_epi32(_mm256_mullo_epi32(a, b), c);}",
+            UINT64: "[](const __m256i a, const __m256i b, const __m256i c) {const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32))); return _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32)), c);}",
+        },
+        MIN: {
+            INT8: "_mm256_min_epi8",
+            INT16: "_mm256_min_epi16",
+            INT32: "_mm256_min_epi32",
+            INT64: "[](const __m256i a, const __m256i b) {return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));}",
+            UINT8: "_mm256_min_epu8",
+            UINT16: "_mm256_min_epu16",
+            UINT32: "_mm256_min_epu32",
+            UINT64: "[](const __m256i a, const __m256i b) {return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(_mm256_xor_si256(a, _mm256_set1_epi64x(INT64_MIN)), _mm256_xor_si256(b, _mm256_set1_epi64x(INT64_MIN))));}",
+        },
+        MAX: {
+            INT8: "_mm256_max_epi8",
+            INT16: "_mm256_max_epi16",
+            INT32: "_mm256_max_epi32",
+            INT64: "[](const __m256i a, const __m256i b) {return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));}",
+            UINT8: "_mm256_max_epu8",
+            UINT16: "_mm256_max_epu16",
+            UINT32: "_mm256_max_epu32",
+            UINT64: "[](const __m256i a, const __m256i b) {return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(_mm256_xor_si256(a, _mm256_set1_epi64x(INT64_MIN)), _mm256_xor_si256(b, _mm256_set1_epi64x(INT64_MIN))));}",
         },
         UNPACK_ALIGNED: {
             INT8: "[](int8_t* ptr, const __m256i vec) {_mm256_store_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
@@ -634,40 +2180,588 @@ const functions = {
             UINT32: "[](uint32_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
             UINT64: "[](uint64_t* ptr, const __m256i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
         },
+        UNPACK_STREAM: {
+            INT8: "[](int8_t* ptr, const __m256i vec) {_mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
+            INT16: "[](int16_t* ptr, const __m256i vec) {_mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
+            INT32: "[](int32_t* ptr, const __m256i vec) {_mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
+            INT64: "[](int64_t* ptr, const __m256i vec) {_mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
+            UINT8: "[](uint8_t* ptr, const __m256i vec) {_mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
+            UINT16: "[](uint16_t* ptr, const __m256i vec) {_mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
+            UINT32: "[](uint32_t* ptr, const __m256i vec) {_mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
+            UINT64: "[](uint64_t* ptr, const __m256i vec) {_mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);}",
+        },
+        PACK_MASKED: {
+            INT32: "[](const int32_t* ptr, const size_t n) {return _mm256_maskload_epi32(reinterpret_cast<const int*>(ptr), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - n)));}",
+            INT64: "[](const int64_t* ptr, const size_t n) {return _mm256_maskload_epi64(reinterpret_cast<const long long*>(ptr), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - 2 * n)));}",
+            UINT32: "[](const uint32_t* ptr, const size_t n) {return _mm256_maskload_epi32(reinterpret_cast<const int*>(ptr), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - n)));}",
+            UINT64: "[](const uint64_t* ptr, const size_t n) {return _mm256_maskload_epi64(reinterpret_cast<const long long*>(ptr), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - 2 * n)));}",
+        },
+        UNPACK_MASKED: {
+            INT32: "[](int32_t* ptr, const __m256i vec, const size_t n) {_mm256_maskstore_epi32(reinterpret_cast<int*>(ptr), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - n)), vec);}",
+            INT64: "[](int64_t* ptr, const __m256i vec, const size_t n) {_mm256_maskstore_epi64(reinterpret_cast<long long*>(ptr), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - 2 * n)), vec);}",
+            UINT32: "[](uint32_t* ptr, const __m256i vec, const size_t n) {_mm256_maskstore_epi32(reinterpret_cast<int*>(ptr), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - n)), vec);}",
+            UINT64: "[](uint64_t* ptr, const __m256i vec, const size_t n) {_mm256_maskstore_epi64(reinterpret_cast<long long*>(ptr), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - 2 * n)), vec);}",
+        },
+        WIDEN: {
+            INT8: "[](const int8_t* ptr) {return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}",
+            INT16: "[](const int16_t* ptr) {return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}",
+            INT32: "[](const int32_t* ptr) {return _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}",
+            UINT8: "[](const uint8_t* ptr) {return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}",
+            UINT16: "[](const uint16_t* ptr) {return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}",
+            UINT32: "[](const uint32_t* ptr) {return _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}",
+        },
+        NARROW: {
+            INT8: "[](int8_t* ptr, const __m256i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_and_si256(vec, _mm256_set1_epi16(0xFF)), vec), 0x08)));}",
+            INT16: "[](int16_t* ptr, const __m256i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(vec, _mm256_set1_epi32(0xFFFF)), vec), 0x08)));}",
+            INT32: "[](int32_t* ptr, const __m256i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(vec, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6))));}",
+            UINT8: "[](uint8_t* ptr, const __m256i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_and_si256(vec, _mm256_set1_epi16(0xFF)), vec), 0x08)));}",
+            UINT16: "[](uint16_t* ptr, const __m256i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(vec, _mm256_set1_epi32(0xFFFF)), vec), 0x08)));}",
+            UINT32: "[](uint32_t* ptr, const __m256i vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(vec, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6))));}",
+        },
+        MUL_WIDEN: {
+            INT16: "[](const __m256i a, const __m256i b) {return _mm256_madd_epi16(a, _mm256_and_si256(b, _mm256_set1_epi32(0xFFFF)));}",
+            INT32: "_mm256_mul_epi32",
+            UINT16: "[](const __m256i a, const __m256i b) {return _mm256_or_si256(_mm256_mullo_epi16(a, b), _mm256_slli_epi32(_mm256_mulhi_epu16(a, b), 16));}",
+            UINT32: "_mm256_mul_epu32",
+        },
+    },
+    FMA: {
+        PACK_ALIGNED: {
+            FLOAT32: "_mm256_load_ps",
+            FLOAT64: "_mm256_load_pd",
+        },
+        PACK_UNALIGNED: {
+            FLOAT32: "_mm256_loadu_ps",
+            FLOAT64: "_mm256_loadu_pd",
+        },
+        SET_ZERO: {
+            FLOAT32: "_mm256_setzero_ps",
+            FLOAT64: "_mm256_setzero_pd",
+        },
+        SET1: {
+            FLOAT32: "_mm256_set1_ps",
+            FLOAT64: "_mm256_set1_pd",
+        },
+        ADD: { // no add backends (AVX has them), only used to combine dot accumulators
+            FLOAT32: "_mm256_add_ps",
+            FLOAT64: "_mm256_add_pd",
+        },
+        SUB: {
+            // no support
+        },
+        MUL: {
+            // no support
+        },
+        DIV: {
+            // no support
+        },
+        FMA: {
+            FLOAT32: "_mm256_fmadd_ps",
+            FLOAT64: "_mm256_fmadd_pd",
+        },
+        MIN: {
+            // no support
+        },
+        MAX: {
+            // no support
+        },
+        UNPACK_ALIGNED: {
+            FLOAT32: "_mm256_store_ps",
+            FLOAT64: "_mm256_store_pd",
+        },
+        UNPACK_UNALIGNED: {
+            FLOAT32: "_mm256_storeu_ps",
+            FLOAT64: "_mm256_storeu_pd",
+        },
+        UNPACK_STREAM: {
+            FLOAT32: "_mm256_stream_ps",
+            FLOAT64: "_mm256_stream_pd",
+        },
+        PACK_MASKED: {
+            FLOAT32: "[](const float* ptr, const size_t n) {return _mm256_maskload_ps(ptr, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - n)));}",
+            FLOAT64: "[](const double* ptr, const size_t n) {return _mm256_maskload_pd(ptr, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - 2 * n)));}",
+        },
+        UNPACK_MASKED: {
+            FLOAT32: "[](float* ptr, const __m256 vec, const size_t n) {_mm256_maskstore_ps(ptr, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - n)), vec);}",
+            FLOAT64: "[](double* ptr, const __m256d vec, const size_t n) {_mm256_maskstore_pd(ptr, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMask32 + 8 - 2 * n)), vec);}",
+        },
+    },
+    F16C: {
+        PACK_ALIGNED: {
+            FLOAT16: "[](const _Float16* ptr) {return _mm256_cvtph_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(ptr)));}",
+            BFLOAT16: "[](const bfloat16* ptr) {return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(ptr))), 16));}",
+            FLOAT32: "_mm256_load_ps",
+        },
+        PACK_UNALIGNED: {
+            FLOAT16: "[](const _Float16* ptr) {return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}",
+            BFLOAT16: "[](const bfloat16* ptr) {return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))), 16));}",
+            FLOAT32: "_mm256_loadu_ps",
+        },
+        SET_ZERO: {
+            FLOAT16: "_mm256_setzero_ps",
+            BFLOAT16: "_mm256_setzero_ps",
+        },
+        SET1: {
+            FLOAT16: "[](const _Float16 value) {return _mm256_set1_ps(static_cast<float>(value));}",
+            BFLOAT16: "[](const bfloat16 value) {return _mm256_set1_ps(static_cast<float>(value));}",
+        },
+        ADD: {
+            FLOAT16: "_mm256_add_ps",
+            BFLOAT16: "_mm256_add_ps",
+            FLOAT32: "_mm256_add_ps",
+        },
+        SUB: {
+            FLOAT16: "_mm256_sub_ps",
+            BFLOAT16: "_mm256_sub_ps",
+            FLOAT32: "_mm256_sub_ps",
+        },
+        MUL: {
+            FLOAT16: "_mm256_mul_ps",
+            BFLOAT16: "_mm256_mul_ps",
+            FLOAT32: "_mm256_mul_ps",
+        },
+        DIV: {
+            FLOAT16: "_mm256_div_ps",
+            BFLOAT16: "_mm256_div_ps",
+        },
+        FMA: {
+            // no support, FMA3 isn't part of this tier
+        },
+        MIN: {
+            FLOAT16: "_mm256_min_ps",
+            BFLOAT16: "_mm256_min_ps",
+        },
+        MAX: {
+            FLOAT16: "_mm256_max_ps",
+            BFLOAT16: "_mm256_max_ps",
+        },
+        UNPACK_ALIGNED: {
+            FLOAT16: "[](_Float16* ptr, const __m256 vec) {_mm_store_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));}",
+            BFLOAT16: "[](bfloat16* ptr, const __m256 vec) {_mm_store_si128(reinterpret_cast<__m128i*>(ptr), narrowBf16F16C(vec));}",
+            FLOAT32: "_mm256_store_ps",
+        },
+        UNPACK_UNALIGNED: {
+            FLOAT16: "[](_Float16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));}",
+            BFLOAT16: "[](bfloat16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), narrowBf16F16C(vec));}",
+            FLOAT32: "_mm256_storeu_ps",
+        },
+        UNPACK_STREAM: {
+            FLOAT16: "[](_Float16* ptr, const __m256 vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));}",
+            BFLOAT16: "[](bfloat16* ptr, const __m256 vec) {_mm_stream_si128(reinterpret_cast<__m128i*>(ptr), narrowBf16F16C(vec));}",
+        },
+        WIDEN: {
+            FLOAT16: "[](const _Float16* ptr) {return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));}",
+            BFLOAT16: "[](const bfloat16* ptr) {return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))), 16));}",
+        },
+        NARROW: {
+            FLOAT16: "[](_Float16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));}",
+            BFLOAT16: "[](bfloat16* ptr, const __m256 vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), narrowBf16F16C(vec));}",
+        },
+    },
+    AVX512: {
+        PACK_ALIGNED: {
+            INT8: "[](const int8_t* ptr) {return _mm512_load_si512(ptr);}",
+            INT16: "[](const int16_t* ptr) {return _mm512_load_si512(ptr);}",
+            INT32: "[](const int32_t* ptr) {return _mm512_load_si512(ptr);}",
+            INT64: "[](const int64_t* ptr) {return _mm512_load_si512(ptr);}",
+            UINT8: "[](const uint8_t* ptr) {return _mm512_load_si512(ptr);}",
+            UINT16: "[](const uint16_t* ptr) {return _mm512_load_si512(ptr);}",
+            UINT32: "[](const uint32_t* ptr) {return _mm512_load_si512(ptr);}",
+            UINT64: "[](const uint64_t* ptr) {return _mm512_load_si512(ptr);}",
+            FLOAT32: "_mm512_load_ps",
+            FLOAT64: "_mm512_load_pd",
+        },
+        PACK_UNALIGNED: {
+            INT8: "[](const int8_t* ptr) {return _mm512_loadu_si512(ptr);}",
+            INT16: "[](const int16_t* ptr) {return _mm512_loadu_si512(ptr);}",
+            INT32: "[](const int32_t* ptr) {return _mm512_loadu_si512(ptr);}",
+            INT64: "[](const int64_t* ptr) {return _mm512_loadu_si512(ptr);}",
+            UINT8: "[](const uint8_t* ptr) {return _mm512_loadu_si512(ptr);}",
+            UINT16: "[](const uint16_t* ptr) {return _mm512_loadu_si512(ptr);}",
+            UINT32: "[](const uint32_t* ptr) {return _mm512_loadu_si512(ptr);}",
+            UINT64: "[](const uint64_t* ptr) {return _mm512_loadu_si512(ptr);}",
+            FLOAT32: "_mm512_loadu_ps",
+            FLOAT64: "_mm512_loadu_pd",
+        },
+        SET_ZERO: {
+            INT8: "_mm512_setzero_si512",
+            INT16: "_mm512_setzero_si512",
+            INT32: "_mm512_setzero_si512",
+            INT64: "_mm512_setzero_si512",
+            UINT8: "_mm512_setzero_si512",
+            UINT16: "_mm512_setzero_si512",
+            UINT32: "_mm512_setzero_si512",
+            UINT64: "_mm512_setzero_si512",
+            FLOAT32: "_mm512_setzero_ps",
+            FLOAT64: "_mm512_setzero_pd",
+        },
+        SET1: {
+            INT8: "_mm512_set1_epi8",
+            INT16: "_mm512_set1_epi16",
+            INT32: "_mm512_set1_epi32",
+            INT64: "_mm512_set1_epi64",
+            UINT8: "_mm512_set1_epi8",
+            UINT16: "_mm512_set1_epi16",
+            UINT32: "_mm512_set1_epi32",
+            UINT64: "_mm512_set1_epi64",
+            FLOAT32: "_mm512_set1_ps",
+            FLOAT64: "_mm512_set1_pd",
+        },
+        ADD: {
+            INT8: "_mm512_add_epi8",
+            INT16: "_mm512_add_epi16",
+            INT32: "_mm512_add_epi32",
+            INT64: "_mm512_add_epi64",
+            UINT8: "_mm512_add_epi8",
+            UINT16: "_mm512_add_epi16",
+            UINT32: "_mm512_add_epi32",
+            UINT64: "_mm512_add_epi64",
+            FLOAT32: "_mm512_add_ps",
+            FLOAT64: "_mm512_add_pd",
+        },
+        SUB: {
+            INT8: "_mm512_sub_epi8",
+            INT16: "_mm512_sub_epi16",
+            INT32: "_mm512_sub_epi32",
+            INT64: "_mm512_sub_epi64",
+            UINT8: "_mm512_sub_epi8",
+            UINT16: "_mm512_sub_epi16",
+            UINT32: "_mm512_sub_epi32",
+            UINT64: "_mm512_sub_epi64",
+            FLOAT32: "_mm512_sub_ps",
+            FLOAT64: "_mm512_sub_pd",
+        },
+        ADDS: {
+            INT8: "_mm512_adds_epi8",
+            INT16: "_mm512_adds_epi16",
+            UINT8: "_mm512_adds_epu8",
+            UINT16: "_mm512_adds_epu16",
+        },
+        SUBS: {
+            INT8: "_mm512_subs_epi8",
+            INT16: "_mm512_subs_epi16",
+            UINT8: "_mm512_subs_epu8",
+            UINT16: "_mm512_subs_epu16",
+        },
+        MUL: {
+            INT8: "[](const __m512i a, const __m512i b) {const __m512i even = _mm512_mullo_epi16(a, b); const __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)); return _mm512_or_si512(_mm512_slli_epi16(odd, 8), _mm512_and_si512(even, _mm512_set1_epi16(0xFF)));}",
+            INT16: "_mm512_mullo_epi16",
+            INT32: "_mm512_mullo_epi32",
+            INT64: "_mm512_mullo_epi64",
+            UINT8: "[](const __m512i a, const __m512i b) {const __m512i even = _mm512_mullo_epi16(a, b); const __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)); return _mm512_or_si512(_mm512_slli_epi16(odd, 8), _mm512_and_si512(even, _mm512_set1_epi16(0xFF)));}",
+            UINT16: "_mm512_mullo_epi16",
+            UINT32: "_mm512_mullo_epi32",
+            UINT64: "_mm512_mullo_epi64",
+            FLOAT32: "_mm512_mul_ps",
+            FLOAT64: "_mm512_mul_pd",
+        },
+        DIV: {
+            INT8: "divInt8AVX512",
+            INT16: "divInt16AVX512",
+            INT32: "divInt32AVX512",
+            UINT8: "divUint8AVX512",
+            UINT16: "divUint16AVX512",
+            UINT32: "divUint32AVX512",
+            FLOAT32: "_mm512_div_ps",
+            FLOAT64: "_mm512_div_pd",
+        },
+        DIVISOR: {
+            INT8: "divisorInt8AVX512",
+            INT16: "divisorInt16AVX512",
+            INT32: "divisorInt32AVX512",
+            UINT8: "divisorUint8AVX512",
+            UINT16: "divisorUint16AVX512",
+            UINT32: "divisorUint32AVX512",
+        },
+        DIV_BY: {
+            INT8: "divByInt8AVX512",
+            INT16: "divByInt16AVX512",
+            INT32: "divByInt32AVX512",
+            UINT8: "divByUint8AVX512",
+            UINT16: "divByUint16AVX512",
+            UINT32: "divByUint32AVX512",
+        },
+        FMA: {
+            INT8: "[](const __m512i a, const __m512i b, const __m512i c) {const __m512i even = _mm512_mullo_epi16(a, b); const __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)); return _mm512_add_epi8(_mm512_or_si512(_mm512_slli_epi16(odd, 8), _mm512_and_si512(even, _mm512_set1_epi16(0xFF))), c);}",
+            INT16: "[](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi16(_mm512_mullo_epi16(a, b), c);}",
+            INT32: "[](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi32(_mm512_mullo_epi32(a, b), c);}",
+            INT64: "[](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi64(_mm512_mullo_epi64(a, b), c);}",
+            UINT8: "[](const __m512i a, const __m512i b, const __m512i c) {const __m512i even = _mm512_mullo_epi16(a, b); const __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)); return _mm512_add_epi8(_mm512_or_si512(_mm512_slli_epi16(odd, 8), _mm512_and_si512(even, _mm512_set1_epi16(0xFF))), c);}",
+            UINT16: "[](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi16(_mm512_mullo_epi16(a, b), c);}",
+            UINT32: "[](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi32(_mm512_mullo_epi32(a, b), c);}",
+            UINT64: "[](const __m512i a, const __m512i b, const __m512i c) {return _mm512_add_epi64(_mm512_mullo_epi64(a, b), c);}",
+            FLOAT32: "_mm512_fmadd_ps",
+            FLOAT64: "_mm512_fmadd_pd",
+        },
+        MIN: {
+            INT8: "_mm512_min_epi8",
+            INT16: "_mm512_min_epi16",
+            INT32: "_mm512_min_epi32",
+            INT64: "_mm512_min_epi64",
+            UINT8: "_mm512_min_epu8",
+            UINT16: "_mm512_min_epu16",
+            UINT32: "_mm512_min_epu32",
+            UINT64: "_mm512_min_epu64",
+            FLOAT32: "_mm512_min_ps",
+            FLOAT64: "_mm512_min_pd",
+        },
+        MAX: {
+            INT8: "_mm512_max_epi8",
+            INT16: "_mm512_max_epi16",
+            INT32: "_mm512_max_epi32",
+            INT64: "_mm512_max_epi64",
+            UINT8: "_mm512_max_epu8",
+            UINT16: "_mm512_max_epu16",
+            UINT32: "_mm512_max_epu32",
+            UINT64: "_mm512_max_epu64",
+            FLOAT32: "_mm512_max_ps",
+            FLOAT64: "_mm512_max_pd",
+        },
+        UNPACK_ALIGNED: {
+            INT8: "[](int8_t* ptr, const __m512i vec) {_mm512_store_si512(ptr, vec);}",
+            INT16: "[](int16_t* ptr, const __m512i vec) {_mm512_store_si512(ptr, vec);}",
+            INT32: "[](int32_t* ptr, const __m512i vec) {_mm512_store_si512(ptr, vec);}",
+            INT64: "[](int64_t* ptr, const __m512i vec) {_mm512_store_si512(ptr, vec);}",
+            UINT8: "[](uint8_t* ptr, const __m512i vec) {_mm512_store_si512(ptr, vec);}",
+            UINT16: "[](uint16_t* ptr, const __m512i vec) {_mm512_store_si512(ptr, vec);}",
+            UINT32: "[](uint32_t* ptr, const __m512i vec) {_mm512_store_si512(ptr, vec);}",
+            UINT64: "[](uint64_t* ptr, const __m512i vec) {_mm512_store_si512(ptr, vec);}",
+            FLOAT32: "_mm512_store_ps",
+            FLOAT64: "_mm512_store_pd",
+        },
+        UNPACK_UNALIGNED: {
+            INT8: "[](int8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}",
+            INT16: "[](int16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}",
+            INT32: "[](int32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}",
+            INT64: "[](int64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}",
+            UINT8: "[](uint8_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}",
+            UINT16: "[](uint16_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}",
+            UINT32: "[](uint32_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}",
+            UINT64: "[](uint64_t* ptr, const __m512i vec) {_mm512_storeu_si512(ptr, vec);}",
+            FLOAT32: "_mm512_storeu_ps",
+            FLOAT64: "_mm512_storeu_pd",
+        },
+        UNPACK_STREAM: {
+            INT8: "[](int8_t* ptr, const __m512i vec) {_mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), vec);}",
+            INT16: "[](int16_t* ptr, const __m512i vec) {_mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), vec);}",
+            INT32: "[](int32_t* ptr, const __m512i vec) {_mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), vec);}",
+            INT64: "[](int64_t* ptr, const __m512i vec) {_mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), vec);}",
+            UINT8: "[](uint8_t* ptr, const __m512i vec) {_mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), vec);}",
+            UINT16: "[](uint16_t* ptr, const __m512i vec) {_mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), vec);}",
+            UINT32: "[](uint32_t* ptr, const __m512i vec) {_mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), vec);}",
+            UINT64: "[](uint64_t* ptr, const __m512i vec) {_mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), vec);}",
+            FLOAT32: "_mm512_stream_ps",
+            FLOAT64: "_mm512_stream_pd",
+        },
+        PACK_MASKED: {
+            INT8: "[](const int8_t* ptr, const size_t n) {return _mm512_maskz_loadu_epi8(static_cast<__mmask64>((1ULL << n) - 1), ptr);}",
+            INT16: "[](const int16_t* ptr, const size_t n) {return _mm512_maskz_loadu_epi16(static_cast<__mmask32>((1ULL << n) - 1), ptr);}",
+            INT32: "[](const int32_t* ptr, const size_t n) {return _mm512_maskz_loadu_epi32(static_cast<__mmask16>((1ULL << n) - 1), ptr);}",
+            INT64: "[](const int64_t* ptr, const size_t n) {return _mm512_maskz_loadu_epi64(static_cast<__mmask8>((1ULL << n) - 1), ptr);}",
+            UINT8: "[](const uint8_t* ptr, const size_t n) {return _mm512_maskz_loadu_epi8(static_cast<__mmask64>((1ULL << n) - 1), ptr);}",
+            UINT16: "[](const uint16_t* ptr, const size_t n) {return _mm512_maskz_loadu_epi16(static_cast<__mmask32>((1ULL << n) - 1), ptr);}",
+            UINT32: "[](const uint32_t* ptr, const size_t n) {return _mm512_maskz_loadu_epi32(static_cast<__mmask16>((1ULL << n) - 1), ptr);}",
+            UINT64: "[](const uint64_t* ptr, const size_t n) {return _mm512_maskz_loadu_epi64(static_cast<__mmask8>((1ULL << n) - 1), ptr);}",
+            FLOAT32: "[](const float* ptr, const size_t n) {return _mm512_maskz_loadu_ps(static_cast<__mmask16>((1ULL << n) - 1), ptr);}",
+            FLOAT64: "[](const double* ptr, const size_t n) {return _mm512_maskz_loadu_pd(static_cast<__mmask8>((1ULL << n) - 1), ptr);}",
+        },
+        UNPACK_MASKED: {
+            INT8: "[](int8_t* ptr, const __m512i vec, const size_t n) {_mm512_mask_storeu_epi8(ptr, static_cast<__mmask64>((1ULL << n) - 1), vec);}",
+            INT16: "[](int16_t* ptr, const __m512i vec, const size_t n) {_mm512_mask_storeu_epi16(ptr, static_cast<__mmask32>((1ULL << n) - 1), vec);}",
+            INT32: "[](int32_t* ptr, const __m512i vec, const size_t n) {_mm512_mask_storeu_epi32(ptr, static_cast<__mmask16>((1ULL << n) - 1), vec);}",
+            INT64: "[](int64_t* ptr, const __m512i vec, const size_t n) {_mm512_mask_storeu_epi64(ptr, static_cast<__mmask8>((1ULL << n) - 1), vec);}",
+            UINT8: "[](uint8_t* ptr, const __m512i vec, const size_t n) {_mm512_mask_storeu_epi8(ptr, static_cast<__mmask64>((1ULL << n) - 1), vec);}",
+            UINT16: "[](uint16_t* ptr, const __m512i vec, const size_t n) {_mm512_mask_storeu_epi16(ptr, static_cast<__mmask32>((1ULL << n) - 1), vec);}",
+            UINT32: "[](uint32_t* ptr, const __m512i vec, const size_t n) {_mm512_mask_storeu_epi32(ptr, static_cast<__mmask16>((1ULL << n) - 1), vec);}",
+            UINT64: "[](uint64_t* ptr, const __m512i vec, const size_t n) {_mm512_mask_storeu_epi64(ptr, static_cast<__mmask8>((1ULL << n) - 1), vec);}",
+            FLOAT32: "[](float* ptr, const __m512 vec, const size_t n) {_mm512_mask_storeu_ps(ptr, static_cast<__mmask16>((1ULL << n) - 1), vec);}",
+            FLOAT64: "[](double* ptr, const __m512d vec, const size_t n) {_mm512_mask_storeu_pd(ptr, static_cast<__mmask8>((1ULL << n) - 1), vec);}",
+        },
+        WIDEN: {
+            INT8: "[](const int8_t* ptr) {return _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));}",
+            INT16: "[](const int16_t* ptr) {return _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));}",
+            INT32: "[](const int32_t* ptr) {return _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));}",
+            UINT8: "[](const uint8_t* ptr) {return _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));}",
+            UINT16: "[](const uint16_t* ptr) {return _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));}",
+            UINT32: "[](const uint32_t* ptr) {return _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));}",
+            FLOAT16: "[](const _Float16* ptr) {return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));}",
+            BFLOAT16: "[](const bfloat16* ptr) {return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));}",
+            FLOAT32: "[](const float* ptr) {return _mm512_cvtps_pd(_mm256_loadu_ps(ptr));}",
+        },
+        NARROW: {
+            INT8: "[](int8_t* ptr, const __m512i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm512_cvtepi16_epi8(vec));}",
+            INT16: "[](int16_t* ptr, const __m512i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm512_cvtepi32_epi16(vec));}",
+            INT32: "[](int32_t* ptr, const __m512i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm512_cvtepi64_epi32(vec));}",
+            UINT8: "[](uint8_t* ptr, const __m512i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm512_cvtepi16_epi8(vec));}",
+            UINT16: "[](uint16_t* ptr, const __m512i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm512_cvtepi32_epi16(vec));}",
+            UINT32: "[](uint32_t* ptr, const __m512i vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm512_cvtepi64_epi32(vec));}",
+            FLOAT16: "[](_Float16* ptr, const __m512 vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm512_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));}",
+            FLOAT32: "[](float* ptr, const __m512d vec) {_mm256_storeu_ps(ptr, _mm512_cvtpd_ps(vec));}",
+        },
+        MUL_WIDEN: {
+            INT16: "[](const __m512i a, const __m512i b) {return _mm512_madd_epi16(a, _mm512_and_si512(b, _mm512_set1_epi32(0xFFFF)));}",
+            INT32: "_mm512_mul_epi32",
+            UINT16: "[](const __m512i a, const __m512i b) {return _mm512_or_si512(_mm512_mullo_epi16(a, b), _mm512_slli_epi32(_mm512_mulhi_epu16(a, b), 16));}",
+            UINT32: "_mm512_mul_epu32",
+        },
+    },
+    AVX512BF16: {
+        PACK_ALIGNED: {
+            BFLOAT16: "[](const bfloat16* ptr) {return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_load_si256(reinterpret_cast<const __m256i*>(ptr))), 16));}",
+        },
+        PACK_UNALIGNED: {
+            BFLOAT16: "[](const bfloat16* ptr) {return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))), 16));}",
+        },
+        PACK_MASKED: {
+            BFLOAT16: "[](const bfloat16* ptr, const size_t n) {return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(static_cast<__mmask16>((1U << n) - 1), ptr)), 16));}",
+        },
+        SET_ZERO: {
+            BFLOAT16: "_mm512_setzero_ps",
+        },
+        SET1: {
+            BFLOAT16: "[](const bfloat16 value) {return _mm512_set1_ps(static_cast<float>(value));}",
+        },
+        ADD: {
+            BFLOAT16: "_mm512_add_ps",
+        },
+        SUB: {
+            BFLOAT16: "_mm512_sub_ps",
+        },
+        MUL: {
+            BFLOAT16: "_mm512_mul_ps",
+        },
+        DIV: {
+            BFLOAT16: "_mm512_div_ps",
+        },
+        FMA: {
+            BFLOAT16: "_mm512_fmadd_ps",
+        },
+        MIN: {
+            BFLOAT16: "_mm512_min_ps",
+        },
+        MAX: {
+            BFLOAT16: "_mm512_max_ps",
+        },
+        UNPACK_ALIGNED: {
+            BFLOAT16: "[](bfloat16* ptr, const __m512 vec) {_mm256_store_si256(reinterpret_cast<__m256i*>(ptr), reinterpret_cast<__m256i>(_mm512_cvtneps_pbh(vec)));}",
+        },
+        UNPACK_UNALIGNED: {
+            BFLOAT16: "[](bfloat16* ptr, const __m512 vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reinterpret_cast<__m256i>(_mm512_cvtneps_pbh(vec)));}",
+        },
+        UNPACK_MASKED: {
+            BFLOAT16: "[](bfloat16* ptr, const __m512 vec, const size_t n) {_mm256_mask_storeu_epi16(ptr, static_cast<__mmask16>((1U << n) - 1), reinterpret_cast<__m256i>(_mm512_cvtneps_pbh(vec)));}",
+        },
+        UNPACK_STREAM: {
+            BFLOAT16: "[](bfloat16* ptr, const __m512 vec) {_mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), reinterpret_cast<__m256i>(_mm512_cvtneps_pbh(vec)));}",
+        },
+    },
+    AVX512FP16: {
+        PACK_ALIGNED: {
+            FLOAT16: "_mm512_load_ph",
+        },
+        PACK_UNALIGNED: {
+            FLOAT16: "_mm512_loadu_ph",
+        },
+        PACK_MASKED: {
+            FLOAT16: "[](const _Float16* ptr, const size_t n) {return _mm512_castsi512_ph(_mm512_maskz_loadu_epi16(static_cast<__mmask32>((1ULL << n) - 1), ptr));}",
+        },
+        SET_ZERO: {
+            FLOAT16: "_mm512_setzero_ph",
+        },
+        SET1: {
+            FLOAT16: "_mm512_set1_ph",
+        },
+        ADD: {
+            FLOAT16: "_mm512_add_ph",
+        },
+        SUB: {
+            FLOAT16: "_mm512_sub_ph",
+        },
+        MUL: {
+            FLOAT16: "_mm512_mul_ph",
+        },
+        DIV: {
+            FLOAT16: "_mm512_div_ph",
+        },
+        FMA: {
+            FLOAT16: "_mm512_fmadd_ph",
+        },
+        MIN: {
+            FLOAT16: "_mm512_min_ph",
+        },
+        MAX: {
+            FLOAT16: "_mm512_max_ph",
+        },
+        UNPACK_ALIGNED: {
+            FLOAT16: "_mm512_store_ph",
+        },
+        UNPACK_UNALIGNED: {
+            FLOAT16: "_mm512_storeu_ph",
+        },
+        UNPACK_MASKED: {
+            FLOAT16: "[](_Float16* ptr, const __m512h vec, const size_t n) {_mm512_mask_storeu_epi16(ptr, static_cast<__mmask32>((1ULL << n) - 1), _mm512_castph_si512(vec));}",
+        },
+        UNPACK_STREAM: {
+            FLOAT16: "[](_Float16* ptr, const __m512h vec) {_mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), _mm512_castph_si512(vec));}",
+        },
     },
 }; // functions
 
 const simdMeta = {
-    MMX: {name: "mmx", ifdefMacro: "__MMX__", header: "mmintrin.h", bitSize: 64},
-    SSE: {name: "sse", ifdefMacro: "__SSE__", header: "xmmintrin.h", bitSize: 128},
-    SSE2: {name: "sse2", ifdefMacro: "__SSE2__", header: "emmintrin.h", bitSize: 128},
-    AVX: {name: "avx", ifdefMacro: "__AVX__", header: "immintrin.h", bitSize: 256},
-    AVX2: {name: "avx2", ifdefMacro: "__AVX2__", header: "immintrin.h", bitSize: 256},
-}; // simdMeta
+    MMX: {name: "mmx", ifdefMacro: "__MMX__", header: "mmintrin.h", bitSize: 64, unroll: 2},
+    SSE: {name: "sse", ifdefMacro: "__SSE__", header: "xmmintrin.h", bitSize: 128, unroll: 4},
+    SSE2: {name: "sse2", ifdefMacro: "__SSE2__", header: "emmintrin.h", bitSize: 128, unroll: 4},
+    AVX: {name: "avx", ifdefMacro: "__AVX__", header: "immintrin.h", bitSize: 256, unroll: 4},
+    AVX2: {name: "avx2", ifdefMacro: "__AVX2__", header: "immintrin.h", bitSize: 256, unroll: 4},
+    FMA: {name: "fma", ifdefMacro: "__FMA__", header: "immintrin.h", bitSize: 256, unroll: 4},
+    F16C: {name: "avx2,f16c", ifdefMacro: "EZSIMD_F16C", header: "immintrin.h", bitSize: 128, unroll: 4},
+    AVX512: {name: "avx512f,avx512bw,avx512dq,avx512vl", ifdefMacro: "EZSIMD_AVX512", header: "immintrin.h", bitSize: 512, unroll: 4},
+    AVX512BF16: {name: "avx512f,avx512bw,avx512dq,avx512vl,avx512bf16", ifdefMacro: "EZSIMD_AVX512BF16", header: "immintrin.h", bitSize: 256, unroll: 4},
+    AVX512FP16: {name: "avx512f,avx512bw,avx512dq,avx512vl,avx512fp16", ifdefMacro: "EZSIMD_AVX512FP16", header: "immintrin.h", bitSize: 512, unroll: 4},
+}; // simdMeta, unroll is how many vectors each steady-state loop iteration processes (MMX only has 8 registers), bitSize is the memory one vector covers (F16C and AVX512BF16 widen it to float)
 
 const numMeta = {
-    INT8: {className: "int8", numName: "int8_t", bitSize: 8},
-    INT16: {className: "int16", numName: "int16_t", bitSize: 16},
-    INT32: {className: "int32", numName: "int32_t", bitSize: 32},
+    INT8: {className: "int8", numName: "int8_t", bitSize: 8, wider: "INT16"},
+    INT16: {className: "int16", numName: "int16_t", bitSize: 16, wider: "INT32"},
+    INT32: {className: "int32", numName: "int32_t", bitSize: 32, wider: "INT64"},
     INT64: {className: "int64", numName: "int64_t", bitSize: 64},
     INT128: {className: "int128", numName: "__int128_t", bitSize: 128},
-    UINT8: {className: "uint8", numName: "uint8_t", bitSize: 8},
-    UINT16: {className: "uint16", numName: "uint16_t", bitSize: 16},
-    UINT32: {className: "uint32", numName: "uint32_t", bitSize: 32},
+    UINT8: {className: "uint8", numName: "uint8_t", bitSize: 8, wider: "UINT16"},
+    UINT16: {className: "uint16", numName: "uint16_t", bitSize: 16, wider: "UINT32"},
+    UINT32: {className: "uint32", numName: "uint32_t", bitSize: 32, wider: "UINT64"},
     UINT64: {className: "uint64", numName: "uint64_t", bitSize: 64},
     UINT128: {className: "uint128", numName: "__uint128_t", bitSize: 128},
-    FLOAT16: {className: "float16", numName: "not yet implemented", bitSize: 16},
-    FLOAT32: {className: "float32", numName: "float", bitSize: 32},
+    FLOAT16: {className: "float16", numName: "_Float16", bitSize: 16, wider: "FLOAT32", ifdefMacro: "EZSIMD_FLOAT16"},
+    BFLOAT16: {className: "bfloat16", numName: "bfloat16", bitSize: 16, wider: "FLOAT32"},
+    FLOAT32: {className: "float32", numName: "float", bitSize: 32, wider: "FLOAT64"},
     FLOAT64: {className: "float64", numName: "double", bitSize: 64},
     FLOAT128: {className: "float128", numName: "long double", bitSize: 128},
-}; // numMeta
+}; // numMeta, wider is the type the widening ops turn it into
 
 const opMeta = {
-    ADD: {name: "add", capsName: "ADD", op: "+"},
-    SUB: {name: "sub", capsName: "SUB", op: "-"},
-    MUL: {name: "mul", capsName: "MUL", op: "*"},
-    DIV: {name: "div", capsName: "DIV", op: "/"},
-};
+    ADD: {name: "add", capsName: "ADD", op: "+", args: ["a", "b"], result: "c", broadcast: true},
+    SUB: {name: "sub", capsName: "SUB", op: "-", args: ["a", "b"], result: "c", broadcast: true},
+    ADDS: {name: "adds", capsName: "ADDS", op: "+", scalar: "addSaturate", args: ["a", "b"], result: "c", broadcast: true, integerOnly: true},
+    SUBS: {name: "subs", capsName: "SUBS", op: "-", scalar: "subSaturate", args: ["a", "b"], result: "c", broadcast: true, integerOnly: true},
+    MUL: {name: "mul", capsName: "MUL", op: "*", args: ["a", "b"], result: "c", broadcast: true},
+    DIV: {name: "div", capsName: "DIV", op: "/", args: ["a", "b"], result: "c", broadcast: true},
+    FMA: {name: "fma", capsName: "FMA", op: "*+", args: ["a", "b", "c"], result: "d"}, // d = a * b + c
+}; // opMeta, broadcast ops also get overloads taking the last arg as a single value, scalar replaces op in scalar code
+
+const reduceMeta = {
+    SUM: {name: "sum", capsName: "SUM", args: ["a"], combine: "ADD"},
+    MIN: {name: "min", capsName: null, args: ["a"], combine: "MIN"}, // no MIN/MAX macros, <sys/param.h> and others already define them
+    MAX: {name: "max", capsName: null, args: ["a"], combine: "MAX"},
+    DOT: {name: "dot", capsName: "DOT", args: ["a", "b"], combine: "ADD"}, // sum of a * b
+}; // reduceMeta, combine is the op that merges two partial results
+
+const widenMeta = {
+    ADD_WIDEN: {name: "addWiden", capsName: "ADD_WIDEN", op: "ADD", args: ["a", "b"]},
+    SUB_WIDEN: {name: "subWiden", capsName: "SUB_WIDEN", op: "SUB", args: ["a", "b"]},
+    MUL_WIDEN: {name: "mulWiden", capsName: "MUL_WIDEN", op: "MUL", args: ["a", "b"]},
+    WIDEN: {name: "widen", capsName: "WIDEN", op: null, args: ["a"]},
+    NARROW: {name: "narrow", capsName: "NARROW", op: null, args: ["a"], narrows: true}, // c[i] = a[i] converted to the narrower type
+}; // widenMeta, c is numMeta's wider type of the args and op is applied to the widened args, or the other way around if narrows
 
 module.exports = {
     simdRegTypenames,
@@ -676,4 +2770,6 @@ module.exports = {
     simdMeta,
     numMeta,
     opMeta,
+    reduceMeta,
+    widenMeta,
 };
\ No newline at end of file